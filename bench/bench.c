@@ -0,0 +1,468 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../decoder/kissfft-131.2.0/kiss_fftr.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#define chdir _chdir
+#define getcwd _getcwd
+#define make_dir(p) _mkdir(p)
+#define SEP "\\"
+#else
+#include <unistd.h>
+#include <sys/stat.h>
+#define make_dir(p) mkdir(p, 0755)
+#define SEP "/"
+#endif
+
+#define MAX_SWEEP 8 // Values per swept setting
+
+/* Offline link benchmark. Encodes the payload with every combination of the [Sweep] settings, passes transmit.wav
+   through a simulated speaker -> room -> microphone channel, decodes the result with decoder.exe and reports
+   byte error rate, goodput and the decoder's CPU cost. `bench in.wav out.wav` only runs the channel. */
+typedef struct {
+    // [Programs]
+    char ENCODER[512];
+    char DECODER[512];
+    char PAYLOAD[512];
+    char WORK_DIR[512];
+    // [Sweep]
+    int SAMPLE_RATE;
+    int STEP_SIZE;
+    float DATA_DUR[MAX_SWEEP]; int DATA_DUR_COUNT;
+    float BYTE_GAP[MAX_SWEEP]; int BYTE_GAP_COUNT;
+    int FFT_SIZE[MAX_SWEEP]; int FFT_SIZE_COUNT;
+    // [Channel]
+    float GAIN;       // Speaker drive before clipping
+    float CLIP;       // Hard clip level, fraction of full scale (1 = only the WAV limit)
+    float LOW_CUT;    // Speaker high-pass corner in Hz (0 = off)
+    float HIGH_CUT;   // Speaker low-pass corner in Hz (0 = off)
+    float ECHO_MS;    // One discrete reflection (0 = off)
+    float ECHO_GAIN;
+    float RT60;       // Synthetic reverb decay time in seconds (0 = off)
+    float REVERB_MIX; // Energy of the reverb tail relative to the direct sound
+    char RIR_FILE[512]; // Measured room impulse response (16-bit WAV); replaces Echo and RT60
+    float DRIFT_PPM;  // Receiver sample clock error
+    float SNR_DB;     // White noise at the microphone (0 = off)
+    float PADDING;    // Seconds of noise before and after, so the decoder's noise floor can settle
+    uint32_t SEED;
+} BenchConfig;
+
+#pragma pack(push, 1)
+typedef struct {
+    char riff[4]; uint32_t overall_size; char wave[4]; char fmt_chunk_marker[4];
+    uint32_t length_fmt; uint16_t format_type; uint16_t channels; uint32_t sample_rate;
+    uint32_t byterate; uint16_t block_align; uint16_t bits_per_sample; char data_chunk_header[4]; uint32_t data_size;
+} WavHeader;
+#pragma pack(pop)
+
+int parse_floats(char *list, float *out) {
+    int n = 0;
+    for (char *tok = strtok(list, ","); tok && n < MAX_SWEEP; tok = strtok(NULL, ",")) out[n++] = (float)atof(tok);
+    return n;
+}
+
+// Lightweight INI Parser
+bool load_config(const char *filename, BenchConfig *c) {
+    FILE *file = fopen(filename, "r");
+    if (!file) return false;
+
+    char line[1024];
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] == ';' || line[0] == '#' || line[0] == '[' || line[0] == '\n' || line[0] == '\r') continue;
+
+        char key[64];
+        char val[512];
+        if (sscanf(line, "%63[^=]=%511s", key, val) == 2) {
+            if (strcmp(key, "Encoder") == 0) snprintf(c->ENCODER, sizeof(c->ENCODER), "%s", val);
+            else if (strcmp(key, "Decoder") == 0) snprintf(c->DECODER, sizeof(c->DECODER), "%s", val);
+            else if (strcmp(key, "Payload") == 0) snprintf(c->PAYLOAD, sizeof(c->PAYLOAD), "%s", val);
+            else if (strcmp(key, "WorkDir") == 0) snprintf(c->WORK_DIR, sizeof(c->WORK_DIR), "%s", val);
+            else if (strcmp(key, "SampleRate") == 0) c->SAMPLE_RATE = atoi(val);
+            else if (strcmp(key, "STEP_SIZE") == 0) c->STEP_SIZE = atoi(val);
+            else if (strcmp(key, "DataDur") == 0) c->DATA_DUR_COUNT = parse_floats(val, c->DATA_DUR);
+            else if (strcmp(key, "ByteGap") == 0) c->BYTE_GAP_COUNT = parse_floats(val, c->BYTE_GAP);
+            else if (strcmp(key, "FFT_SIZE") == 0) {
+                float sizes[MAX_SWEEP];
+                c->FFT_SIZE_COUNT = parse_floats(val, sizes);
+                for (int i = 0; i < c->FFT_SIZE_COUNT; i++) c->FFT_SIZE[i] = (int)sizes[i];
+            }
+            else if (strcmp(key, "Gain") == 0) c->GAIN = (float)atof(val);
+            else if (strcmp(key, "Clip") == 0) c->CLIP = (float)atof(val);
+            else if (strcmp(key, "LowCut") == 0) c->LOW_CUT = (float)atof(val);
+            else if (strcmp(key, "HighCut") == 0) c->HIGH_CUT = (float)atof(val);
+            else if (strcmp(key, "EchoMs") == 0) c->ECHO_MS = (float)atof(val);
+            else if (strcmp(key, "EchoGain") == 0) c->ECHO_GAIN = (float)atof(val);
+            else if (strcmp(key, "RT60") == 0) c->RT60 = (float)atof(val);
+            else if (strcmp(key, "ReverbMix") == 0) c->REVERB_MIX = (float)atof(val);
+            else if (strcmp(key, "RirFile") == 0) snprintf(c->RIR_FILE, sizeof(c->RIR_FILE), "%s", val);
+            else if (strcmp(key, "DriftPpm") == 0) c->DRIFT_PPM = (float)atof(val);
+            else if (strcmp(key, "SnrDb") == 0) c->SNR_DB = (float)atof(val);
+            else if (strcmp(key, "Padding") == 0) c->PADDING = (float)atof(val);
+            else if (strcmp(key, "Seed") == 0) c->SEED = (uint32_t)strtoul(val, NULL, 10);
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+// --- WAV I/O (16-bit PCM, first channel only) ---
+float *read_wav(const char *path, size_t *count, int *rate) {
+    FILE *f = fopen(path, "rb");
+    WavHeader h;
+    if (!f || fread(&h, sizeof(h), 1, f) != 1 || memcmp(h.riff, "RIFF", 4) != 0 || h.bits_per_sample != 16 || h.channels < 1) {
+        printf("ERROR: %s is not a 16-bit PCM WAV file.\n", path);
+        if (f) fclose(f);
+        return NULL;
+    }
+    size_t frames = h.data_size / (2u * h.channels);
+    int16_t *raw = malloc(h.data_size ? h.data_size : 1);
+    float *out = malloc((frames ? frames : 1) * sizeof(float));
+    if (!raw || !out) { fclose(f); free(raw); free(out); return NULL; }
+    frames = fread(raw, 2u * h.channels, frames, f);
+    for (size_t i = 0; i < frames; i++) out[i] = raw[i * h.channels] / 32768.0f;
+    free(raw);
+    fclose(f);
+    *count = frames;
+    *rate = (int)h.sample_rate;
+    return out;
+}
+
+bool write_wav(const char *path, const float *x, size_t count, int rate) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+    WavHeader h = {
+        .riff = {'R','I','F','F'}, .wave = {'W','A','V','E'}, .fmt_chunk_marker = {'f','m','t',' '},
+        .length_fmt = 16, .format_type = 1, .channels = 1, .sample_rate = (uint32_t)rate,
+        .byterate = (uint32_t)rate * 2, .block_align = 2, .bits_per_sample = 16,
+        .data_chunk_header = {'d','a','t','a'}, .data_size = (uint32_t)(count * 2),
+    };
+    h.overall_size = 36 + h.data_size;
+    fwrite(&h, sizeof(h), 1, f);
+    for (size_t i = 0; i < count; i++) {
+        float v = x[i] * 32767.0f;
+        int16_t s = (int16_t)(v > 32767.0f ? 32767.0f : (v < -32768.0f ? -32768.0f : v));
+        fwrite(&s, 2, 1, f);
+    }
+    return fclose(f) == 0;
+}
+
+// --- Channel Model ---
+uint32_t g_Rng = 1;
+float rand_uniform(void) { g_Rng ^= g_Rng << 13; g_Rng ^= g_Rng >> 17; g_Rng ^= g_Rng << 5; return (g_Rng >> 8) * (1.0f / 16777216.0f); } // xorshift32
+float rand_gauss(void) { // Box-Muller
+    float u = rand_uniform() + 1e-7f, v = rand_uniform();
+    return sqrtf(-2.0f * logf(u)) * cosf(2.0f * 3.14159265f * v);
+}
+
+// Second order Butterworth section (RBJ cookbook), run in place
+void biquad(float *x, size_t n, int rate, float freq, bool highPass) {
+    float w = 2.0f * 3.14159265f * freq / rate, alpha = sinf(w) / (2.0f * 0.70710678f), cw = cosf(w);
+    float b1 = highPass ? -(1.0f + cw) : (1.0f - cw), b0 = highPass ? (1.0f + cw) / 2.0f : (1.0f - cw) / 2.0f;
+    float a0 = 1.0f + alpha, a1 = -2.0f * cw, a2 = 1.0f - alpha;
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for (size_t i = 0; i < n; i++) {
+        float y = (b0 * x[i] + b1 * x1 + b0 * x2 - a1 * y1 - a2 * y2) / a0;
+        x2 = x1; x1 = x[i]; y2 = y1; y1 = y; x[i] = y;
+    }
+}
+
+// Room impulse response: a measured one from RirFile, or the direct path plus an echo and an exponential noise tail
+float *build_rir(const BenchConfig *c, int rate, size_t *len) {
+    if (c->RIR_FILE[0]) {
+        int rirRate;
+        float *h = read_wav(c->RIR_FILE, len, &rirRate);
+        if (h && rirRate != rate) printf("WARNING: %s is %d Hz, the signal is %d Hz. Using it unscaled.\n", c->RIR_FILE, rirRate, rate);
+        return h;
+    }
+    size_t echo = (size_t)(c->ECHO_MS * 0.001f * rate), tail = (size_t)(c->RT60 * rate);
+    *len = 1 + (echo > tail ? echo : tail);
+    float *h = calloc(*len, sizeof(float));
+    if (!h) return NULL;
+    h[0] = 1.0f;
+    if (echo > 0) h[echo] += c->ECHO_GAIN;
+    if (tail > 0 && c->REVERB_MIX > 0) {
+        // Amplitude falls 60 dB over RT60; scaled so the tail carries ReverbMix of the direct energy
+        double energy = 0;
+        float *t = calloc(tail, sizeof(float));
+        if (!t) { free(h); return NULL; }
+        for (size_t i = 0; i < tail; i++) { t[i] = rand_gauss() * expf(-6.9078f * i / tail); energy += t[i] * t[i]; }
+        float scale = (float)sqrt(c->REVERB_MIX / (energy > 0 ? energy : 1));
+        size_t start = (size_t)(0.002f * rate); // First reflections arrive a couple of ms after the direct sound
+        for (size_t i = start; i < tail && i < *len; i++) h[i] += t[i] * scale;
+        free(t);
+    }
+    return h;
+}
+
+// Overlap-add FFT convolution, so second-long room responses stay cheap. Returns n + hLen - 1 samples.
+float *convolve(const float *x, size_t n, const float *h, size_t hLen, size_t *outLen) {
+    int nfft = 1;
+    while ((size_t)nfft < 2 * hLen) nfft <<= 1;
+    size_t block = nfft - hLen + 1;
+    *outLen = n + hLen - 1;
+    float *y = calloc(*outLen, sizeof(float)), *buf = malloc(nfft * sizeof(float));
+    kiss_fft_cpx *H = malloc((nfft / 2 + 1) * sizeof(kiss_fft_cpx)), *X = malloc((nfft / 2 + 1) * sizeof(kiss_fft_cpx));
+    kiss_fftr_cfg fwd = kiss_fftr_alloc(nfft, 0, NULL, NULL), inv = kiss_fftr_alloc(nfft, 1, NULL, NULL);
+    if (!y || !buf || !H || !X || !fwd || !inv) { free(y); y = NULL; goto done; }
+
+    memset(buf, 0, nfft * sizeof(float));
+    memcpy(buf, h, hLen * sizeof(float));
+    kiss_fftr(fwd, buf, H);
+    for (size_t pos = 0; pos < n; pos += block) {
+        size_t len = n - pos < block ? n - pos : block;
+        memset(buf, 0, nfft * sizeof(float));
+        memcpy(buf, x + pos, len * sizeof(float));
+        kiss_fftr(fwd, buf, X);
+        for (int k = 0; k <= nfft / 2; k++) {
+            float r = X[k].r * H[k].r - X[k].i * H[k].i, i = X[k].r * H[k].i + X[k].i * H[k].r;
+            X[k].r = r / nfft; X[k].i = i / nfft; // kiss_fftri is unscaled
+        }
+        kiss_fftri(inv, X, buf);
+        for (size_t i = 0; i < len + hLen - 1 && pos + i < *outLen; i++) y[pos + i] += buf[i];
+    }
+done:
+    free(buf); free(H); free(X);
+    kiss_fftr_free(fwd); kiss_fftr_free(inv);
+    return y;
+}
+
+/* Speaker (gain, clipping, band limit) -> room (echo / reverb) -> microphone (clock drift, noise), with Padding
+   seconds of silence either side. Returns a new buffer. */
+float *simulate_channel(const BenchConfig *c, const float *in, size_t n, int rate, size_t *outLen) {
+    float *x = malloc((n ? n : 1) * sizeof(float));
+    if (!x) return NULL;
+    for (size_t i = 0; i < n; i++) {
+        float v = in[i] * c->GAIN;
+        x[i] = v > c->CLIP ? c->CLIP : (v < -c->CLIP ? -c->CLIP : v);
+    }
+    if (c->LOW_CUT > 0) biquad(x, n, rate, c->LOW_CUT, true);
+    if (c->HIGH_CUT > 0 && c->HIGH_CUT < rate / 2) biquad(x, n, rate, c->HIGH_CUT, false);
+
+    size_t hLen = 0, roomLen = n;
+    float *h = build_rir(c, rate, &hLen);
+    if (h && hLen > 1) {
+        float *y = convolve(x, n, h, hLen, &roomLen);
+        if (y) { free(x); x = y; } else roomLen = n;
+    }
+    free(h);
+
+    // A receiver clock that runs fast by DriftPpm records each second of audio as slightly more samples
+    size_t pad = (size_t)(c->PADDING * rate);
+    double ratio = 1.0 + c->DRIFT_PPM * 1e-6;
+    size_t driftLen = (size_t)(roomLen * ratio);
+    *outLen = driftLen + 2 * pad;
+    float *out = calloc(*outLen ? *outLen : 1, sizeof(float));
+    if (!out) { free(x); return NULL; }
+    double power = 0;
+    for (size_t i = 0; i < driftLen; i++) {
+        double t = i / ratio;
+        size_t k = (size_t)t;
+        float frac = (float)(t - k);
+        float a = k < roomLen ? x[k] : 0.0f, b = k + 1 < roomLen ? x[k + 1] : 0.0f;
+        out[pad + i] = a + (b - a) * frac;
+        power += out[pad + i] * out[pad + i];
+    }
+    free(x);
+
+    if (c->SNR_DB != 0 && driftLen > 0) {
+        float sigma = (float)sqrt(power / driftLen / pow(10.0, c->SNR_DB / 10.0));
+        for (size_t i = 0; i < *outLen; i++) out[i] += rand_gauss() * sigma;
+    }
+    float peak = 0; // The mic preamp backs off instead of clipping what the room added
+    for (size_t i = 0; i < *outLen; i++) if (fabsf(out[i]) > peak) peak = fabsf(out[i]);
+    if (peak > 0.99f) for (size_t i = 0; i < *outLen; i++) out[i] *= 0.99f / peak;
+    return out;
+}
+
+bool run_channel(const BenchConfig *c, const char *inPath, const char *outPath) {
+    size_t n, outLen;
+    int rate;
+    float *in = read_wav(inPath, &n, &rate);
+    if (!in) return false;
+    float *out = simulate_channel(c, in, n, rate, &outLen);
+    free(in);
+    bool ok = out && write_wav(outPath, out, outLen, rate);
+    free(out);
+    return ok;
+}
+
+// --- Sweep ---
+void absolute_path(char *path, size_t size, const char *base) {
+    bool absolute = path[0] == '/' || path[0] == '\\' || (path[0] && path[1] == ':');
+    if (absolute || !path[0]) return;
+    char tmp[1024];
+    snprintf(tmp, sizeof(tmp), "%s" SEP "%s", base, path);
+    snprintf(path, size, "%s", tmp);
+}
+
+uint8_t *read_file(const char *path, size_t *size) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = malloc(len > 0 ? len : 1);
+    if (data) *size = fread(data, 1, len, f);
+    fclose(f);
+    return data;
+}
+
+typedef struct {
+    bool decoded;       // Saved with a matching checksum and identical to the payload
+    double byteErrors;  // Fraction of payload bytes wrong or missing
+    double txSeconds;   // Length of transmit.wav
+    double goodput;     // Payload bytes per second of transmission, 0 if it failed
+    double cpuPerSec;   // Decoder CPU seconds per second of audio
+} RunResult;
+
+// One encode -> channel -> decode round in <WorkDir>\tx and \rx. Returns false if a tool could not run at all.
+bool run_once(const BenchConfig *c, const char *work, const char *payloadName, const uint8_t *payload, size_t payloadSize,
+              float dataDur, float byteGap, int fftSize, RunResult *r) {
+    char path[1200], cmd[2600];
+    memset(r, 0, sizeof(RunResult));
+    r->byteErrors = 1.0;
+
+    // Encoder frequencies follow the decoder's AutoSpacing layout for this FFT size
+    float bw = (float)c->SAMPLE_RATE / fftSize;
+    snprintf(path, sizeof(path), "%s" SEP "tx" SEP "encoder_config.ini", work);
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "[Payload]\nInputFile=%s\n[Protocol]\nHeaderCrc=1\n[Audio]\nSampleRate=%d\n", payloadName, c->SAMPLE_RATE);
+    fprintf(f, "[Frequencies]\nBaseFreq=%.4f\nBinSpacing=%.4f\nFreqHello=%.4f\nFreqHeader=%.4f\nFreqTerm=%.4f\n", bw * 52.0f, bw * 2.0f, bw * 26.0f, bw * 36.0f, bw * 588.0f);
+    fprintf(f, "[Timing]\nDataDur=%.4f\nByteGap=%.4f\n", dataDur, byteGap);
+    fclose(f);
+
+    // A symbol must fill the FFT window for a few hops to pass the debounce; aim for 3/4 of the clean hops
+    int cleanHops = (int)((dataDur * c->SAMPLE_RATE - fftSize) / c->STEP_SIZE);
+    int debounce = cleanHops * 3 / 4 > 1 ? cleanHops * 3 / 4 : 1;
+    snprintf(path, sizeof(path), "%s" SEP "rx" SEP "decoder_config.ini", work);
+    if (!(f = fopen(path, "w"))) return false;
+    fprintf(f, "[Audio]\nFFT_SIZE=%d\nSTEP_SIZE=%d\n[Protocol]\nAutoSpacing=1\nAutoThreshold=1\nDebounceLimit=%d\nVerbose=0\n", fftSize, c->STEP_SIZE, debounce);
+    fclose(f);
+
+    snprintf(path, sizeof(path), "%s" SEP "tx" SEP "%s", work, payloadName);
+    if (!(f = fopen(path, "wb"))) return false;
+    fwrite(payload, 1, payloadSize, f);
+    fclose(f);
+
+    if (chdir(work) != 0 || chdir("tx") != 0) return false;
+    remove("transmit.wav");
+    snprintf(cmd, sizeof(cmd), "echo y| \"%s\" > encoder.log", c->ENCODER); // Answers the long transmission prompt
+    system(cmd);
+
+    size_t n, outLen;
+    int rate;
+    float *tx = read_wav("transmit.wav", &n, &rate);
+    if (!tx) return false;
+    r->txSeconds = (double)n / rate;
+    float *rx = simulate_channel(c, tx, n, rate, &outLen);
+    free(tx);
+    bool written = rx && write_wav(".." SEP "received.wav", rx, outLen, rate);
+    free(rx);
+    if (!written) return false;
+
+    if (chdir(".." SEP "rx") != 0) return false;
+    char partName[300];
+    snprintf(partName, sizeof(partName), "%s.part", payloadName);
+    remove(payloadName);
+    remove(partName);
+    snprintf(cmd, sizeof(cmd), "\"%s\" .." SEP "received.wav > decoder.log", c->DECODER);
+    system(cmd);
+
+    char line[512];
+    if ((f = fopen("decoder.log", "r"))) {
+        double audio, cpu;
+        while (fgets(line, sizeof(line), f))
+            if (sscanf(line, "OFFLINE: %lf s of audio | %lf s CPU", &audio, &cpu) == 2 && audio > 0) r->cpuPerSec = cpu / audio;
+        fclose(f);
+    }
+
+    // Byte errors are counted position by position in the saved file, or in the .part a failed transfer left behind
+    size_t gotSize = 0;
+    uint8_t *got = read_file(payloadName, &gotSize);
+    bool saved = got != NULL;
+    if (!got) got = read_file(partName, &gotSize);
+    if (got && payloadSize > 0) {
+        size_t wrong = 0;
+        for (size_t i = 0; i < payloadSize; i++) if (i >= gotSize || got[i] != payload[i]) wrong++;
+        r->byteErrors = (double)wrong / payloadSize;
+    } else if (got) r->byteErrors = 0.0;
+    r->decoded = saved && gotSize == payloadSize && r->byteErrors == 0.0;
+    r->goodput = r->decoded && r->txSeconds > 0 ? payloadSize / r->txSeconds : 0.0;
+    free(got);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    BenchConfig cfg = {
+        .ENCODER = ".." SEP "encoder" SEP "encoder.exe", .DECODER = ".." SEP "decoder" SEP "decoder.exe",
+        .PAYLOAD = ".." SEP "encoder" SEP "test.txt", .WORK_DIR = "work",
+        .SAMPLE_RATE = 48000, .STEP_SIZE = 256,
+        .DATA_DUR = {0.086f}, .DATA_DUR_COUNT = 1, .BYTE_GAP = {0.043f}, .BYTE_GAP_COUNT = 1, .FFT_SIZE = {2048}, .FFT_SIZE_COUNT = 1,
+        .GAIN = 1.0f, .CLIP = 1.0f, .PADDING = 1.0f, .SEED = 1,
+    };
+    if (!load_config("bench_config.ini", &cfg)) printf("WARNING: bench_config.ini not found. Using default values.\n");
+    g_Rng = cfg.SEED ? cfg.SEED : 1;
+
+    if (argc == 3) { // bench in.wav out.wav: just put a recording through the channel
+        if (!run_channel(&cfg, argv[1], argv[2])) return 1;
+        printf("Channel output written to %s\n", argv[2]);
+        return 0;
+    }
+
+    char base[1024], work[1200];
+    if (!getcwd(base, sizeof(base))) return 1;
+    absolute_path(cfg.ENCODER, sizeof(cfg.ENCODER), base);
+    absolute_path(cfg.DECODER, sizeof(cfg.DECODER), base);
+    absolute_path(cfg.PAYLOAD, sizeof(cfg.PAYLOAD), base);
+    absolute_path(cfg.RIR_FILE, sizeof(cfg.RIR_FILE), base);
+    snprintf(work, sizeof(work), "%s", cfg.WORK_DIR);
+    absolute_path(work, sizeof(work), base);
+
+    size_t payloadSize = 0;
+    uint8_t *payload = read_file(cfg.PAYLOAD, &payloadSize);
+    if (!payload) { printf("ERROR: Cannot read payload %s\n", cfg.PAYLOAD); return 1; }
+    const char *payloadName = strrchr(cfg.PAYLOAD, SEP[0]);
+    payloadName = payloadName ? payloadName + 1 : cfg.PAYLOAD;
+
+    char dir[1300];
+    make_dir(work);
+    snprintf(dir, sizeof(dir), "%s" SEP "tx", work); make_dir(dir);
+    snprintf(dir, sizeof(dir), "%s" SEP "rx", work); make_dir(dir);
+
+    char csvPath[1100];
+    snprintf(csvPath, sizeof(csvPath), "%s" SEP "results.csv", base);
+    FILE *csv = fopen(csvPath, "w");
+    if (csv) fprintf(csv, "fft_size,data_dur,byte_gap,tx_seconds,decoded,byte_error_rate,goodput_Bps,decoder_cpu_per_s\n");
+
+    printf("\n==================== CHORDCAST BENCH ====================\n");
+    printf("Payload: %s (%zu bytes) | SNR: %.1f dB | RT60: %.2f s | Drift: %.0f ppm | Band: %.0f-%.0f Hz\n",
+           payloadName, payloadSize, cfg.SNR_DB, cfg.RT60, cfg.DRIFT_PPM, cfg.LOW_CUT, cfg.HIGH_CUT);
+    printf("%8s %8s %8s | %7s %7s %9s %12s %10s\n", "FFT", "DataDur", "ByteGap", "TX s", "Result", "ByteErr", "Goodput B/s", "CPU s/s");
+    printf("---------------------------------------------------------------------------------\n");
+
+    for (int a = 0; a < cfg.FFT_SIZE_COUNT; a++)
+    for (int b = 0; b < cfg.DATA_DUR_COUNT; b++)
+    for (int d = 0; d < cfg.BYTE_GAP_COUNT; d++) {
+        RunResult r;
+        if (!run_once(&cfg, work, payloadName, payload, payloadSize, cfg.DATA_DUR[b], cfg.BYTE_GAP[d], cfg.FFT_SIZE[a], &r)) {
+            printf("%8d %8.3f %8.3f | ERROR: encoder or decoder did not run (see %s" SEP "tx" SEP "encoder.log)\n", cfg.FFT_SIZE[a], cfg.DATA_DUR[b], cfg.BYTE_GAP[d], work);
+            chdir(base);
+            continue;
+        }
+        chdir(base);
+        printf("%8d %8.3f %8.3f | %7.2f %7s %8.2f%% %12.2f %10.5f\n", cfg.FFT_SIZE[a], cfg.DATA_DUR[b], cfg.BYTE_GAP[d],
+               r.txSeconds, r.decoded ? "OK" : "FAIL", r.byteErrors * 100.0, r.goodput, r.cpuPerSec);
+        if (csv) fprintf(csv, "%d,%.4f,%.4f,%.3f,%d,%.6f,%.3f,%.6f\n", cfg.FFT_SIZE[a], cfg.DATA_DUR[b], cfg.BYTE_GAP[d],
+                         r.txSeconds, r.decoded, r.byteErrors, r.goodput, r.cpuPerSec);
+    }
+    if (csv) { fclose(csv); printf("\nResults written to %s\n", csvPath); }
+    free(payload);
+    return 0;
+}
@@ -0,0 +1,74 @@
+#ifndef CHORDCAST_CRC32C_H
+#define CHORDCAST_CRC32C_H
+/* CRC-32C (Castagnoli), shared by the encoder and the decoder so both ends compute the same checksum.
+   Each program is a single translation unit, so everything here is static. */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Payload integrity check. Uses the SSE4.2 / ARMv8 crc32c instructions when the CPU has them and a
+   slicing-by-8 table otherwise. crc32c_update() is incremental: start from 0 and feed bytes as they come. */
+#define CRC32C_POLY 0x82F63B78u // Reflected Castagnoli polynomial
+static uint32_t crc32c_table[8][256];
+
+static uint32_t crc32c_sw(uint32_t crc, const uint8_t *p, size_t n) {
+    while (n && ((uintptr_t)p & 7)) { crc = crc32c_table[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8); n--; }
+    for (; n >= 8; p += 8, n -= 8) { // Slicing-by-8: eight table lookups per 8 input bytes (little-endian)
+        uint32_t lo, hi;
+        memcpy(&lo, p, 4); memcpy(&hi, p + 4, 4);
+        lo ^= crc;
+        crc = crc32c_table[7][lo & 0xFF] ^ crc32c_table[6][(lo >> 8) & 0xFF] ^ crc32c_table[5][(lo >> 16) & 0xFF] ^ crc32c_table[4][lo >> 24] ^
+              crc32c_table[3][hi & 0xFF] ^ crc32c_table[2][(hi >> 8) & 0xFF] ^ crc32c_table[1][(hi >> 16) & 0xFF] ^ crc32c_table[0][hi >> 24];
+    }
+    while (n--) crc = crc32c_table[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <nmmintrin.h>
+__attribute__((target("sse4.2"))) static uint32_t crc32c_hw(uint32_t crc, const uint8_t *p, size_t n) {
+    while (n && ((uintptr_t)p & 7)) { crc = _mm_crc32_u8(crc, *p++); n--; }
+#ifdef __x86_64__
+    uint64_t crc64 = crc;
+    for (; n >= 8; p += 8, n -= 8) { uint64_t v; memcpy(&v, p, 8); crc64 = _mm_crc32_u64(crc64, v); }
+    crc = (uint32_t)crc64;
+#endif
+    for (; n >= 4; p += 4, n -= 4) { uint32_t v; memcpy(&v, p, 4); crc = _mm_crc32_u32(crc, v); }
+    while (n--) crc = _mm_crc32_u8(crc, *p++);
+    return crc;
+}
+#define CRC32C_HW_AVAILABLE() __builtin_cpu_supports("sse4.2")
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+static uint32_t crc32c_hw(uint32_t crc, const uint8_t *p, size_t n) {
+    while (n && ((uintptr_t)p & 7)) { crc = __crc32cb(crc, *p++); n--; }
+    for (; n >= 8; p += 8, n -= 8) { uint64_t v; memcpy(&v, p, 8); crc = __crc32cd(crc, v); }
+    while (n--) crc = __crc32cb(crc, *p++);
+    return crc;
+}
+#define CRC32C_HW_AVAILABLE() 1 // Compiled for a CPU that is guaranteed to have the CRC extension
+#else
+#define crc32c_hw crc32c_sw
+#define CRC32C_HW_AVAILABLE() 0
+#endif
+
+static uint32_t (*crc32c_impl)(uint32_t, const uint8_t *, size_t) = crc32c_sw;
+
+// Builds the fallback tables and picks the fastest implementation for this CPU. Call once at startup.
+static void crc32c_init(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) c = (c & 1) ? (c >> 1) ^ CRC32C_POLY : c >> 1;
+        crc32c_table[0][i] = c;
+    }
+    for (int t = 1; t < 8; t++)
+        for (int i = 0; i < 256; i++)
+            crc32c_table[t][i] = (crc32c_table[t - 1][i] >> 8) ^ crc32c_table[0][crc32c_table[t - 1][i] & 0xFF];
+    crc32c_impl = CRC32C_HW_AVAILABLE() ? crc32c_hw : crc32c_sw;
+}
+
+static uint32_t crc32c_update(uint32_t crc, const void *data, size_t len) {
+    return ~crc32c_impl(~crc, (const uint8_t *)data, len);
+}
+
+#endif
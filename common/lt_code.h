@@ -0,0 +1,65 @@
+#ifndef CHORDCAST_LT_CODE_H
+#define CHORDCAST_LT_CODE_H
+/* Fountain (LT) code neighbour sets, shared by the encoder and the decoder. Each program is a single
+   translation unit, so everything here is static. */
+#include <stdint.h>
+#include <math.h>
+
+/* Carousel packets carry either a source block (esi < k, systematic) or the XOR of a pseudo-random set of
+   source blocks drawn from a robust soliton degree distribution. Encoder and decoder must derive the same
+   set from (fileId, esi), so the distribution is built from +, -, *, / and sqrt only. IEEE 754 requires
+   those to be correctly rounded, so every compiler and C library gives the same result; log() carries no
+   such guarantee, hence lt_ln(). */
+#define CAROUSEL_MAX_BLOCKS 8192
+#define LT_C 0.1     // Robust soliton tuning: spike size
+#define LT_DELTA 0.5 // ...and allowed failure probability
+
+static double lt_ln(double x) { // Natural log from +,-,*,/ only, so both ends get bit-identical tables
+    int e = 0;
+    while (x >= 2.0) { x /= 2.0; e++; }
+    while (x < 1.0) { x *= 2.0; e--; }
+    double y = (x - 1.0) / (x + 1.0), y2 = y * y, term = y, sum = 0.0;
+    for (int n = 1; n < 60; n += 2) { sum += term / n; term *= y2; } // ln(x) = 2 atanh((x-1)/(x+1))
+    return 2.0 * sum + e * 0.69314718055994530942;
+}
+
+// cdf[d-1] is the 32-bit threshold for degree d (k entries).
+static void lt_dist_init(uint32_t *cdf, uint32_t k) {
+    double R = LT_C * lt_ln(k / LT_DELTA) * sqrt((double)k);
+    uint32_t spike = (uint32_t)(k / R);
+    if (spike < 1) spike = 1;
+    if (spike > k) spike = k;
+    double total = 0.0;
+    for (int pass = 0; pass < 2; pass++) { // First pass normalises, second fills thresholds
+        double acc = 0.0;
+        for (uint32_t d = 1; d <= k; d++) {
+            double w = (d == 1) ? 1.0 / k : 1.0 / ((double)d * (d - 1)); // Ideal soliton
+            if (d < spike) w += R / ((double)d * k);                       // Robust boost
+            else if (d == spike && R > LT_DELTA) w += R * lt_ln(R / LT_DELTA) / k;
+            acc += w;
+            if (pass == 1) cdf[d - 1] = (d == k) ? UINT32_MAX : (uint32_t)(acc / total * 4294967295.0);
+        }
+        total = acc;
+    }
+}
+
+static uint32_t lt_next(uint32_t *s) { *s ^= *s << 13; *s ^= *s >> 17; *s ^= *s << 5; return *s; } // xorshift32
+
+// Fills out[] with the distinct source blocks XORed into symbol `esi` and returns how many.
+static uint32_t lt_neighbors(const uint32_t *cdf, uint32_t k, uint32_t fileId, uint32_t esi, uint32_t *out) {
+    if (esi < k) { out[0] = esi; return 1; }
+    uint32_t s = fileId ^ (esi * 0x9E3779B9u); // fmix32 so neighbouring esi values start far apart
+    s ^= s >> 16; s *= 0x85EBCA6Bu; s ^= s >> 13; s *= 0xC2B2AE35u; s ^= s >> 16;
+    if (s == 0) s = 1;
+    uint32_t r = lt_next(&s), lo = 0, hi = k - 1;
+    while (lo < hi) { uint32_t mid = (lo + hi) / 2; if (r <= cdf[mid]) hi = mid; else lo = mid + 1; }
+    uint32_t d = lo + 1;
+    for (uint32_t j = k - d; j < k; j++) { // Floyd's sampling: d distinct values without a k-sized scratch set
+        uint32_t t = lt_next(&s) % (j + 1), n = j - (k - d);
+        for (uint32_t i = 0; i < n; i++) if (out[i] == t) { t = j; break; }
+        out[n] = t;
+    }
+    return d;
+}
+
+#endif
@@ -8,12 +8,34 @@
 #include <propsys.h>
 #include <propkey.h>
 #include "kissfft-131.2.0/kiss_fft.h"
+#include "kissfft-131.2.0/kfc.h"
+#include "../common/crc32c.h"
+#include "../common/lt_code.h"
 #include <math.h>
 #include <stdint.h>
+#include <stddef.h>
 #include <signal.h>
+#include <stdarg.h>
+
+/* Every heap call in this file goes through these, so --soak can check that decoding allocates nothing once the
+   first pass has sized the buffers. kissfft's own (plans, and the scratch a shared plan lends out when it is busy)
+   are counted in kiss_fft_allocs when it is built with -DKISS_FFT_COUNT_ALLOCS, as the compile line in README.md
+   does. The C runtime's are not seen, with one exception: each transfer opens a .part file through OpenPartFile,
+   and the runtime allocates that FILE and its buffer. That is the cost of saving the file, not of decoding it, so
+   --soak reports those opens but does not count them. */
+volatile LONG g_HeapCalls = 0;
+void *CountedMalloc(size_t n) { InterlockedIncrement(&g_HeapCalls); return malloc(n); }
+void *CountedCalloc(size_t n, size_t size) { InterlockedIncrement(&g_HeapCalls); return calloc(n, size); }
+#ifdef KISS_FFT_COUNT_ALLOCS
+long kiss_fft_allocs = 0;
+long KissAllocs(void) { return kiss_fft_allocs; }
+#else
+long KissAllocs(void) { return 0; }
+#endif
+volatile LONG g_PartOpens = 0;
+FILE *OpenPartFile(const char *path, const char *mode) { InterlockedIncrement(&g_PartOpens); return fopen(path, mode); }
 
 #define PI 3.14159265358979323846
-#define MAX_FILE_SIZE (1024 * 1024 * 5) // Implemented to prevent buffer overflow (5MB)
 #define RED_TEXT "\033[1;31m"
 #define RESET_TEXT "\033[0m"
 
@@ -25,11 +47,30 @@ bool AUTO_SPACING = true;  // DONT DISABLE UNLESS YOU KNOW WHAT YOU ARE DOING!
 bool AUTO_THRESHOLD = false; // Toggles dynamic noise floor adjustment
 float THRESHOLD = 5.0f;    // Base threshold (overwritten if AutoThreshold is on)
 int DEBOUNCE_LIMIT = 6;
+bool ADAPTIVE_HOP = true;  // Live inputs: hop further while idle when analysis falls behind real time
+bool IDLE_GATE = true;     // While idle, skip the FFT until a cheap energy/Goertzel check hears something
+int STREAMS = 1;           // Transmitters decoded at once, each on its own band
+bool DAEMON = false;       // Service many inputs (device channels, named pipes, spool folder) in one process
+int WORKERS = 4;           // Daemon: DSP threads (0 = run everything on the main thread)
+bool DAEMON_DEVICE = true; // Daemon: treat each channel of the default capture device as its own input
+int SAMPLE_RATE = 48000;   // Daemon without a device: rate every input must use
+char SPOOL_DIR[MAX_PATH] = "";  // Daemon: folder polled for .wav recordings to decode
+char FIFOS[512] = "";      // Daemon: comma separated named pipes (e.g. \\.\pipe\chordcast1) that accept WAV streams
+int DIVERSITY = 0;         // 0 = left channel only, 1 = selection combining, 2 = maximal-ratio combining across all channels
 
 #define REPEAT_IDX 256
 /* Repeat IDX is a dummy value to represent a repeating byte. This avoids blending 
    between repeating frequencies and tells the decoder to repeat the last byte. */
-#define SYNC_MARKER 0xFE 
+#define SYNC_MARKER 0xFE    // Legacy v1 header (8-bit byte sum)
+#define SYNC_MARKER_V2 0xFD // v2 header (CRC-32C)
+#define HDR_FLAG_HEADER_CRC 0x01 // v2 header carries a CRC over itself
+#define HDR_FLAG_FRAMED 0x02     // Payload arrives as CRC-checked blocks behind FREQ_HEADER resync markers
+#define SYNC_MARKER_CAROUSEL 0xFC  // Fountain-coded carousel packet
+#define CAROUSEL_NAME_ESI 0xFFFFFFFFu // Packet carries the file name instead of a symbol
+#define SYNC_MARKER_SESSION 0xFB   // Multi-file session manifest, sent in place of the header
+#define MAX_SESSION_FILES 64
+#define MAX_DIVERSITY_CHANNELS 8
+#define MAX_STREAMS 8
 
 // --- Bin-Dependent Variables (Auto-calculated via mic hz) ---
 float BIN_WIDTH = 0.0f;   // The resolution of each FFT slot
@@ -43,6 +84,40 @@ float FREQ_TERM = 0.0f;   // Termination signal
 volatile bool g_Running = true;
 void SignalHandler(int sig) { g_Running = false; }
 
+// Offline decoding (decoder.exe capture.wav) keeps the .part of a failed transfer so a benchmark can count byte errors
+bool g_KeepPartial = false;
+
+// --bench mode: FFT_SIZE/STEP_SIZE lists to time, where to write the results, allowed slowdown against a baseline
+char BENCH_FFT_SIZES[256] = "";
+char BENCH_STEP_SIZES[256] = "";
+char BENCH_OUTPUT[MAX_PATH] = "bench_results.json";
+float BENCH_TOLERANCE = 10.0f; // Percent
+float BENCH_MIN_NS = 25.0f;     // Slowdowns smaller than this are timer noise, whatever the percentage
+int SOAK_LOAD_THREADS = 2;     // --soak: busy threads competing with the decoder for the CPU
+bool g_LogMuted = false;       // Benchmarks drive the state machine without printing
+
+// DECODER_STATS builds only: where and how often the timing/counter dump is written
+char STATS_FILE[MAX_PATH] = "decoder_stats.json";
+float STATS_INTERVAL = 1.0f; // Seconds
+
+/* Console output from a receiver. Receivers with a label (an input name or stream number) get a [label] line whenever
+   a different one starts printing. The lock keeps lines whole when daemon workers print at the same time, and
+   also serialises SaveTempFile. */
+_Thread_local const char *g_CurrentLabel = "";
+const char *g_LastTalker = NULL;
+CRITICAL_SECTION g_LogLock;
+bool g_LogLockReady = false;
+void RxLog(const char *fmt, ...) {
+    if (g_LogMuted) return;
+    if (g_LogLockReady) EnterCriticalSection(&g_LogLock);
+    if (g_CurrentLabel[0] && g_LastTalker != g_CurrentLabel) { printf("\n[%s]", g_CurrentLabel); g_LastTalker = g_CurrentLabel; }
+    va_list args;
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+    if (g_LogLockReady) LeaveCriticalSection(&g_LogLock);
+}
+
 typedef enum {
     STATE_IDLE,        // Waiting for hello
     STATE_WAIT_HEADER, // Waiting for header after hello
@@ -56,10 +131,993 @@ typedef struct {
     uint32_t fileSize;
     uint8_t checksum;
     uint8_t fileType;
+} ChordHeaderV1; // Still accepted so older transmit.wav files decode
+
+typedef struct {
+    uint8_t syncMarker; 
+    char fileName[32];
+    uint32_t fileSize;
+    uint32_t crc32c;    // CRC-32C of the payload
+    uint8_t flags;      // HDR_FLAG_* bits
+    uint8_t blockSize;  // Payload bytes per block if HDR_FLAG_FRAMED, else 0
+    uint32_t headerCrc; // CRC-32C of every header byte before this field (if HDR_FLAG_HEADER_CRC)
 } ChordHeader;
+
+/* Framed mode block, sent after a FREQ_HEADER marker tone: BlockHeader, `len` payload bytes, then a
+   CRC-32C of both. Block `seq` holds file bytes [seq * blockSize, seq * blockSize + len). */
+typedef struct {
+    uint16_t seq;
+    uint8_t len;
+} BlockHeader;
+
+/* Carousel packet, sent after a FREQ_HEADER marker tone with no HELLO: CarouselHeader, then blockSize bytes of
+   encoded symbol (or 32 bytes of file name for CAROUSEL_NAME_ESI), then a CRC-32C of everything before it. */
+typedef struct {
+    uint8_t syncMarker; // SYNC_MARKER_CAROUSEL
+    uint32_t fileId;    // CRC-32C of the whole file; identifies it and verifies the result
+    uint32_t fileSize;
+    uint8_t blockSize;
+    uint32_t esi;       // Encoding symbol id, selects which blocks are XORed together
+} CarouselHeader;
 #pragma pack(pop) // Reverse alignment settings to previous state
 
-// --- INI Loader ---
+// Closes and deletes a partially received file so failed transfers leave nothing behind.
+void DiscardTempFile(FILE **f, const char *path) {
+    if (*f) { fclose(*f); *f = NULL; remove(path); }
+}
+
+/* Each receiver streams into its own temp file. Every daemon device channel hears the same room, so several
+   receivers can be taking down the same file at once; they must not share one .part. A receiver that shares the
+   console with others (it has a label) gets a tag, e.g. photo.jpg.3.part; a lone receiver keeps photo.jpg.part. */
+#define TEMP_PATH_SIZE 64
+_Thread_local const char *g_CurrentPartTag = "";
+volatile LONG g_ReceiverSerial = 0;
+void MakeTempPath(char *out, size_t size, const char *fileName) {
+    snprintf(out, size, "%s%s.part", fileName, g_CurrentPartTag);
+}
+
+/* Moves a verified temp file onto its final name. When the last file saved had the same name and CRC and is still
+   there, another receiver has just saved this transmission, so the copy is dropped instead of replacing it under
+   whoever is reading it. Sets *duplicate in that case. Returns false if the file could not be saved. */
+char g_LastSavedName[33];
+uint32_t g_LastSavedCrc;
+bool SaveTempFile(const char *tempPath, const char *name, uint32_t crc, bool *duplicate) {
+    if (g_LogLockReady) EnterCriticalSection(&g_LogLock);
+    *duplicate = g_LastSavedName[0] && crc == g_LastSavedCrc && strcmp(name, g_LastSavedName) == 0 &&
+                 GetFileAttributesA(name) != INVALID_FILE_ATTRIBUTES;
+    bool ok = true;
+    if (*duplicate) remove(tempPath);
+    else if ((ok = MoveFileExA(tempPath, name, MOVEFILE_REPLACE_EXISTING))) {
+        snprintf(g_LastSavedName, sizeof(g_LastSavedName), "%s", name);
+        g_LastSavedCrc = crc;
+    }
+    if (g_LogLockReady) LeaveCriticalSection(&g_LogLock);
+    return ok;
+}
+
+// --- Framed Transfer Reassembly ---
+/* Tracks which blocks of a framed transfer have been written to the .part file. If a transfer ends with
+   gaps, the state is kept so a replay of just the missing ranges (encoder SendRanges) fills them in. */
+typedef struct {
+    uint8_t block[sizeof(BlockHeader) + 255 + sizeof(uint32_t)];
+    uint32_t fill;        // Bytes of the current block received so far
+    bool active;          // Marker heard, block not finished yet; bytes outside a block are ignored
+    uint32_t blockCount;
+    uint8_t *received;    // One bit per block; NULL until framed_begin
+    uint8_t *bitmap;      // What received points into, kept from file to file and only grown (bitmapCap bytes)
+    uint32_t bitmapCap;
+    uint32_t receivedCount;
+    uint32_t nextInOrder; // While blocks arrive in order the file CRC is kept running; otherwise it is recomputed at the end
+    uint32_t badBlocks;
+    bool pending;         // Incomplete transfer waiting for a gap-filling replay
+    ChordHeader header;   // ...of this file
+} FramedRx;
+
+void framed_reset(FramedRx *fr) {
+    uint8_t *bitmap = fr->bitmap;
+    uint32_t cap = fr->bitmapCap;
+    memset(fr, 0, sizeof(FramedRx));
+    fr->bitmap = bitmap; fr->bitmapCap = cap;
+}
+
+void framed_free(FramedRx *fr) {
+    free(fr->bitmap);
+    memset(fr, 0, sizeof(FramedRx));
+}
+
+bool framed_begin(FramedRx *fr, const ChordHeader *h) {
+    framed_reset(fr);
+    fr->header = *h;
+    fr->blockCount = (h->fileSize + h->blockSize - 1) / h->blockSize;
+    uint32_t bytes = (fr->blockCount + 7) / 8 + 1;
+    if (bytes > fr->bitmapCap) {
+        uint8_t *grown = CountedMalloc(bytes);
+        if (!grown) return false;
+        free(fr->bitmap);
+        fr->bitmap = grown; fr->bitmapCap = bytes;
+    }
+    memset(fr->bitmap, 0, bytes);
+    fr->received = fr->bitmap;
+    return true;
+}
+
+// Same file as the one we are holding a partial copy of?
+bool framed_matches(const FramedRx *fr, const ChordHeader *h) {
+    return fr->pending && fr->header.fileSize == h->fileSize && fr->header.crc32c == h->crc32c &&
+           fr->header.blockSize == h->blockSize && strcmp(fr->header.fileName, h->fileName) == 0;
+}
+
+void framed_marker(FramedRx *fr) {
+    if (fr->active && fr->fill > 0) fr->badBlocks++; // Previous block never completed: a byte was dropped
+    fr->active = true;
+    fr->fill = 0;
+}
+
+void framed_byte(FramedRx *fr, uint8_t b, FILE *rxFile, uint32_t *runningCrc) {
+    if (!fr->active || !fr->received) return; // Lost sync inside a block; wait for the next marker
+    fr->block[fr->fill++] = b;
+    if (fr->fill < sizeof(BlockHeader)) return;
+
+    BlockHeader bh;
+    memcpy(&bh, fr->block, sizeof(BlockHeader));
+    if (bh.len > fr->header.blockSize) { fr->active = false; fr->badBlocks++; return; } // Corrupt length
+    if (fr->fill < sizeof(BlockHeader) + bh.len + sizeof(uint32_t)) return;
+    fr->active = false;
+
+    uint32_t crc, offset = (uint32_t)bh.seq * fr->header.blockSize;
+    memcpy(&crc, fr->block + sizeof(BlockHeader) + bh.len, sizeof(uint32_t));
+    uint32_t expectedLen = fr->header.fileSize - offset < fr->header.blockSize ? fr->header.fileSize - offset : fr->header.blockSize;
+    if (crc != crc32c_update(0, fr->block, sizeof(BlockHeader) + bh.len) || bh.seq >= fr->blockCount || bh.len != expectedLen) {
+        fr->badBlocks++;
+        return;
+    }
+    if (fr->received[bh.seq / 8] & (1 << (bh.seq % 8))) return; // Already have it
+
+    const uint8_t *payload = fr->block + sizeof(BlockHeader);
+    if (rxFile && (fseek(rxFile, offset, SEEK_SET) != 0 || fwrite(payload, 1, bh.len, rxFile) != bh.len)) return;
+    fr->received[bh.seq / 8] |= 1 << (bh.seq % 8);
+    fr->receivedCount++;
+    if (bh.seq == fr->nextInOrder) { *runningCrc = crc32c_update(*runningCrc, payload, bh.len); fr->nextInOrder++; }
+}
+
+// Prints the missing byte ranges in the form the encoder's SendRanges= accepts. Returns the number of missing blocks.
+uint32_t framed_report_lost(const FramedRx *fr) {
+    uint32_t missing = fr->blockCount - fr->receivedCount;
+    if (missing == 0) return 0;
+    RxLog("         Lost %u of %u blocks. Resend only these bytes by putting this line in encoder_config.ini:\n", missing, fr->blockCount);
+    RxLog("         SendRanges=");
+    bool first = true;
+    for (uint32_t b = 0; b < fr->blockCount; ) {
+        if (fr->received[b / 8] & (1 << (b % 8))) { b++; continue; }
+        uint32_t start = b;
+        while (b < fr->blockCount && !(fr->received[b / 8] & (1 << (b % 8)))) b++;
+        uint32_t endByte = b * fr->header.blockSize;
+        if (endByte > fr->header.fileSize) endByte = fr->header.fileSize;
+        RxLog("%s%u-%u", first ? "" : ",", start * fr->header.blockSize, endByte - 1);
+        first = false;
+    }
+    RxLog("\n");
+    return missing;
+}
+
+// CRC of a file we filled out of order (gap-filling replay), read back once at the end.
+uint32_t crc32c_file(FILE *f, uint32_t size) {
+    uint8_t chunk[4096];
+    uint32_t crc = 0;
+    if (fseek(f, 0, SEEK_SET) != 0) return ~0u;
+    while (size > 0) {
+        size_t n = fread(chunk, 1, size < sizeof(chunk) ? size : sizeof(chunk), f);
+        if (n == 0) break;
+        crc = crc32c_update(crc, chunk, n);
+        size -= (uint32_t)n;
+    }
+    return crc;
+}
+
+// --- Carousel (Fountain) Reassembly ---
+/* Collects carousel packets for one file. Peeling resolves symbols that are down to a single unknown block;
+   when that stalls with enough symbols held, Gaussian elimination over GF(2) finishes the job. Memory is
+   about three times the file size, which is why carousel files are capped at CAROUSEL_MAX_BLOCKS. It is all
+   taken when the first packet arrives and kept for the next file, so packets themselves never allocate. */
+typedef struct {
+    uint8_t *data;   // blockSize bytes, XOR of the blocks still in nbrs
+    uint32_t *nbrs;  // Unknown source blocks this symbol still depends on
+    uint32_t degree;
+} FountainSymbol;
+
+typedef struct { // Buffers that outlive a file; they only ever grow
+    void *mem;                   // cdf, scratch, nbrs, known, blocks, pending and symbol data, see fountain_begin
+    uint32_t *nbrPool, *nbrSpare; // Neighbour lists of the held symbols, see fountain_hold_nbrs
+    uint64_t *elimM;             // fountain_eliminate's matrix and data copies
+    uint8_t *elimD;
+    size_t memCap, nbrCap, elimMCap, elimDCap;
+} FountainStore;
+
+typedef struct {
+    bool active, done, saved;
+    uint32_t fileId, fileSize, k;
+    uint8_t blockSize;
+    char fileName[32];    // Empty until a name packet is heard
+    uint32_t *cdf, *scratch, *nbrs; // nbrs: the neighbours of the packet being fed
+    uint8_t *blocks, *known;
+    uint8_t data[255];    // ...and its payload
+    uint32_t solved, packets;
+    FountainSymbol *pending; // Symbol i keeps its bytes at pending[i].data, a fixed slot
+    uint32_t pendingCount, pendingCap, nbrUsed;
+    uint32_t nextSolveAttempt; // pendingCount at which Gaussian elimination is worth trying again
+    FountainStore store;
+} FountainRx;
+
+void fountain_reset(FountainRx *fr) {
+    FountainStore store = fr->store;
+    memset(fr, 0, sizeof(FountainRx));
+    fr->store = store;
+}
+
+void fountain_free(FountainRx *fr) {
+    free(fr->store.mem); free(fr->store.nbrPool); free(fr->store.nbrSpare); free(fr->store.elimM); free(fr->store.elimD);
+    memset(fr, 0, sizeof(FountainRx));
+}
+
+// Makes *buf hold at least bytes; the old contents are not kept. False if out of memory.
+static bool fountain_reserve(void **buf, size_t *cap, size_t bytes) {
+    if (bytes <= *cap) return true;
+    void *grown = CountedMalloc(bytes);
+    if (!grown) return false;
+    free(*buf);
+    *buf = grown; *cap = bytes;
+    return true;
+}
+
+bool fountain_begin(FountainRx *fr, uint32_t fileId, uint32_t fileSize, uint8_t blockSize) {
+    fountain_reset(fr);
+    fr->fileId = fileId; fr->fileSize = fileSize; fr->blockSize = blockSize;
+    fr->k = fileSize ? (fileSize + blockSize - 1) / blockSize : 1;
+    if (blockSize == 0 || fr->k > CAROUSEL_MAX_BLOCKS) return false;
+    fr->pendingCap = fr->k * 2 + 16;
+    size_t k = fr->k, cap = fr->pendingCap;
+    size_t bytes = cap * sizeof(FountainSymbol) + 3 * k * sizeof(uint32_t) + k + k * blockSize + cap * blockSize;
+    if (!fountain_reserve(&fr->store.mem, &fr->store.memCap, bytes)) return false;
+    uint8_t *p = fr->store.mem; // Widest type first, so every array stays aligned
+    fr->pending = (FountainSymbol *)p; p += cap * sizeof(FountainSymbol);
+    fr->cdf = (uint32_t *)p; p += k * sizeof(uint32_t);
+    fr->scratch = (uint32_t *)p; p += k * sizeof(uint32_t);
+    fr->nbrs = (uint32_t *)p; p += k * sizeof(uint32_t);
+    fr->known = p; p += k;
+    fr->blocks = p; p += k * blockSize;
+    for (size_t i = 0; i < cap; i++) fr->pending[i].data = p + i * blockSize;
+    memset(fr->known, 0, k);
+    memset(fr->blocks, 0, k * blockSize);
+    lt_dist_init(fr->cdf, fr->k);
+    fr->active = true;
+    return true;
+}
+
+// Room for n neighbours of a new held symbol, carved from the pool in arrival order. A full pool is compacted into
+// the spare one, which then takes over; only when the held symbols still leave no room do both grow.
+static uint32_t *fountain_hold_nbrs(FountainRx *fr, uint32_t n) {
+    FountainStore *st = &fr->store;
+    if (fr->nbrUsed + n > st->nbrCap) {
+        size_t live = 0;
+        for (uint32_t i = 0; i < fr->pendingCount; i++) live += fr->pending[i].degree;
+        size_t cap = st->nbrCap;
+        uint32_t *into = st->nbrSpare;
+        if (live + n > cap) {
+            cap = 2 * (live + n) + fr->k;
+            into = CountedMalloc(cap * sizeof(uint32_t));
+            uint32_t *spare = CountedMalloc(cap * sizeof(uint32_t));
+            if (!into || !spare) { free(into); free(spare); return NULL; }
+            free(st->nbrSpare);
+            st->nbrSpare = spare;
+        }
+        uint32_t used = 0;
+        for (uint32_t i = 0; i < fr->pendingCount; i++) {
+            FountainSymbol *sym = &fr->pending[i];
+            memcpy(into + used, sym->nbrs, sym->degree * sizeof(uint32_t));
+            sym->nbrs = into + used;
+            used += sym->degree;
+        }
+        if (cap > st->nbrCap) free(st->nbrPool);
+        else st->nbrSpare = st->nbrPool;
+        st->nbrPool = into;
+        st->nbrCap = cap;
+        fr->nbrUsed = used;
+    }
+    uint32_t *slot = st->nbrPool + fr->nbrUsed;
+    fr->nbrUsed += n;
+    return slot;
+}
+
+// Drops held symbol i by moving the last one into its slot (its data bytes included, the slot's buffer stays put).
+static void fountain_drop(FountainRx *fr, uint32_t i) {
+    uint32_t last = --fr->pendingCount;
+    if (i == last) return;
+    memcpy(fr->pending[i].data, fr->pending[last].data, fr->blockSize);
+    fr->pending[i].nbrs = fr->pending[last].nbrs;
+    fr->pending[i].degree = fr->pending[last].degree;
+}
+static void xor_bytes(uint8_t *dst, const uint8_t *src, size_t n) { for (size_t i = 0; i < n; i++) dst[i] ^= src[i]; }
+
+// Stores a newly known block and peels it out of every held symbol, cascading through any that drop to degree 1.
+static void fountain_solve(FountainRx *fr, uint32_t block, const uint8_t *data) {
+    uint32_t *stack = fr->scratch, top = 0;
+    if (fr->known[block]) return;
+    memcpy(fr->blocks + (size_t)block * fr->blockSize, data, fr->blockSize);
+    fr->known[block] = 1; fr->solved++;
+    stack[top++] = block;
+    while (top > 0) {
+        uint32_t b = stack[--top];
+        for (uint32_t i = 0; i < fr->pendingCount; ) {
+            FountainSymbol *sym = &fr->pending[i];
+            for (uint32_t j = 0; j < sym->degree; j++) {
+                if (sym->nbrs[j] != b) continue;
+                xor_bytes(sym->data, fr->blocks + (size_t)b * fr->blockSize, fr->blockSize);
+                sym->nbrs[j] = sym->nbrs[--sym->degree];
+                break;
+            }
+            if (sym->degree == 1 && !fr->known[sym->nbrs[0]]) {
+                uint32_t nb = sym->nbrs[0];
+                memcpy(fr->blocks + (size_t)nb * fr->blockSize, sym->data, fr->blockSize);
+                fr->known[nb] = 1; fr->solved++;
+                stack[top++] = nb;
+            }
+            if (sym->degree <= 1) { fountain_drop(fr, i); continue; } // Used up
+            i++;
+        }
+    }
+    if (fr->pendingCount == 0) fr->nbrUsed = 0;
+}
+
+// Peeling stalled: solve the remaining unknowns jointly. Works on copies so a rank-deficient attempt changes nothing.
+static void fountain_eliminate(FountainRx *fr) {
+    uint32_t u = 0, *col = fr->scratch; // col[block] = matrix column of each unknown block
+    for (uint32_t b = 0; b < fr->k; b++) col[b] = fr->known[b] ? UINT32_MAX : u++;
+    uint32_t rows = fr->pendingCount, words = (u + 63) / 64;
+    if (u == 0 || rows < u) return;
+    size_t mBytes = (size_t)rows * words * sizeof(uint64_t), dBytes = (size_t)rows * fr->blockSize;
+    if (!fountain_reserve((void **)&fr->store.elimM, &fr->store.elimMCap, mBytes)) return;
+    if (!fountain_reserve((void **)&fr->store.elimD, &fr->store.elimDCap, dBytes)) return;
+    uint64_t *m = fr->store.elimM;
+    uint8_t *d = fr->store.elimD;
+    uint32_t *pivotRow = fr->nbrs; // Free again: the packet that got us here has been stored or dropped
+    memset(m, 0, mBytes);
+    for (uint32_t r = 0; r < rows; r++) {
+        for (uint32_t j = 0; j < fr->pending[r].degree; j++) { uint32_t c = col[fr->pending[r].nbrs[j]]; m[(size_t)r * words + c / 64] |= 1ull << (c % 64); }
+        memcpy(d + (size_t)r * fr->blockSize, fr->pending[r].data, fr->blockSize);
+    }
+    uint32_t rank = 0;
+    for (uint32_t c = 0; c < u; c++) {
+        uint32_t p = rank;
+        while (p < rows && !(m[(size_t)p * words + c / 64] & (1ull << (c % 64)))) p++;
+        if (p == rows) break; // Not enough independent symbols yet
+        if (p != rank) {
+            for (uint32_t w = 0; w < words; w++) { uint64_t t = m[(size_t)p * words + w]; m[(size_t)p * words + w] = m[(size_t)rank * words + w]; m[(size_t)rank * words + w] = t; }
+            for (uint32_t i = 0; i < fr->blockSize; i++) { uint8_t t = d[(size_t)p * fr->blockSize + i]; d[(size_t)p * fr->blockSize + i] = d[(size_t)rank * fr->blockSize + i]; d[(size_t)rank * fr->blockSize + i] = t; }
+        }
+        for (uint32_t r = 0; r < rows; r++) {
+            if (r == rank || !(m[(size_t)r * words + c / 64] & (1ull << (c % 64)))) continue;
+            for (uint32_t w = 0; w < words; w++) m[(size_t)r * words + w] ^= m[(size_t)rank * words + w];
+            xor_bytes(d + (size_t)r * fr->blockSize, d + (size_t)rank * fr->blockSize, fr->blockSize);
+        }
+        pivotRow[c] = rank++;
+    }
+    if (rank == u) { // Fully reduced: pivot row c now holds unknown block c on its own
+        for (uint32_t b = 0; b < fr->k; b++) {
+            if (col[b] == UINT32_MAX) continue;
+            memcpy(fr->blocks + (size_t)b * fr->blockSize, d + (size_t)pivotRow[col[b]] * fr->blockSize, fr->blockSize);
+            fr->known[b] = 1; fr->solved++;
+        }
+        fr->pendingCount = 0; fr->nbrUsed = 0;
+    }
+}
+
+// Feeds one CRC-checked encoded symbol. Returns true once every source block is known.
+bool fountain_symbol(FountainRx *fr, uint32_t esi, const uint8_t *payload) {
+    if (!fr->active || fr->done) return fr->done;
+    fr->packets++;
+    uint32_t *nbrs = fr->nbrs;
+    uint8_t *data = fr->data;
+    uint32_t degree = lt_neighbors(fr->cdf, fr->k, fr->fileId, esi, nbrs);
+    memcpy(data, payload, fr->blockSize);
+    for (uint32_t j = 0; j < degree; ) { // Strip out blocks we already know
+        if (fr->known[nbrs[j]]) { xor_bytes(data, fr->blocks + (size_t)nbrs[j] * fr->blockSize, fr->blockSize); nbrs[j] = nbrs[--degree]; }
+        else j++;
+    }
+    if (degree == 1) fountain_solve(fr, nbrs[0], data);
+    if (degree > 1 && fr->pendingCount < fr->pendingCap) { // Otherwise redundant, solved, or no room
+        uint32_t *held = fountain_hold_nbrs(fr, degree);
+        if (held) {
+            FountainSymbol *sym = &fr->pending[fr->pendingCount++];
+            memcpy(sym->data, data, fr->blockSize);
+            memcpy(held, nbrs, degree * sizeof(uint32_t));
+            sym->nbrs = held; sym->degree = degree;
+        }
+    }
+
+    uint32_t unknown = fr->k - fr->solved;
+    if (unknown > 0 && fr->pendingCount >= unknown && fr->pendingCount >= fr->nextSolveAttempt) {
+        fountain_eliminate(fr);
+        fr->nextSolveAttempt = fr->pendingCount + 1 + unknown / 16; // Back off so big files don't eliminate on every packet
+    }
+    fr->done = (fr->solved == fr->k);
+    return fr->done;
+}
+
+// Handles one complete carousel packet. Saves the file once every block is known and the name has been heard.
+void carousel_packet(FountainRx *fr, const uint8_t *pkt, uint32_t len) {
+    CarouselHeader ch;
+    uint32_t crc;
+    memcpy(&ch, pkt, sizeof(CarouselHeader));
+    memcpy(&crc, pkt + len - sizeof(uint32_t), sizeof(uint32_t));
+    if (crc != crc32c_update(0, pkt, len - sizeof(uint32_t))) { RxLog(RED_TEXT "\n [ERROR] Carousel packet CRC fail, skipped.\n" RESET_TEXT); return; }
+
+    if (!fr->active || fr->fileId != ch.fileId) { // First packet of a (new) broadcast
+        if (!fountain_begin(fr, ch.fileId, ch.fileSize, ch.blockSize)) { RxLog(RED_TEXT "\n [ERROR] Carousel file too large or out of memory.\n" RESET_TEXT); return; }
+        RxLog("\n >> CAROUSEL: file %08X | SIZE: %u bytes in %u blocks\n", ch.fileId, ch.fileSize, fr->k);
+    }
+    if (ch.esi == CAROUSEL_NAME_ESI) {
+        if (!fr->fileName[0]) {
+            memcpy(fr->fileName, pkt + sizeof(CarouselHeader), sizeof(fr->fileName));
+            fr->fileName[sizeof(fr->fileName) - 1] = '\0';
+            RxLog("\n >> FILENAME: %s\n", fr->fileName);
+        }
+    } else if (!fr->done && ch.fileSize == fr->fileSize && ch.blockSize == fr->blockSize) {
+        fountain_symbol(fr, ch.esi, pkt + sizeof(CarouselHeader));
+        RxLog("\n >> PACKET %u: %u/%u blocks recovered\n", fr->packets, fr->solved, fr->k);
+    }
+    if (!fr->done || fr->saved || !fr->fileName[0]) return;
+
+    fr->saved = true; // Later loops of the same broadcast are ignored
+    char tempPath[TEMP_PATH_SIZE];
+    bool duplicate;
+    MakeTempPath(tempPath, sizeof(tempPath), fr->fileName);
+    FILE *f = OpenPartFile(tempPath, "wb");
+    bool written = f && fwrite(fr->blocks, 1, fr->fileSize, f) == fr->fileSize;
+    if (f && fclose(f) != 0) written = false;
+    if (crc32c_update(0, fr->blocks, fr->fileSize) != fr->fileId) {
+        RxLog(RED_TEXT "\n [ERROR] Transmission Failed: Checksum Mismatch after decoding.\n" RESET_TEXT);
+        remove(tempPath);
+    } else if (written && SaveTempFile(tempPath, fr->fileName, fr->fileId, &duplicate)) {
+        RxLog("\n [SUCCESS] %s: %s (%u packets for %u blocks)\n", duplicate ? "Already saved" : "Saved", fr->fileName, fr->packets, fr->k);
+    } else {
+        RxLog(RED_TEXT "\n [ERROR] Write permission denied. Cannot save file.\n" RESET_TEXT);
+        remove(tempPath);
+    }
+}
+
+// --- Multi-File Sessions ---
+/* After one handshake the encoder sends a manifest (file count, then the size and name of each file) and the files
+   back to back, each followed by its CRC-32C. Every file gets its own .part and is renamed the moment its record
+   verifies, so a session cut short still keeps each file that finished. */
+typedef struct {
+    bool active;
+    bool manifestDone;
+    uint8_t manifest[1 + 5 + MAX_SESSION_FILES * (5 + 1 + 31) + sizeof(uint32_t)];
+    uint32_t manifestLen;  // Manifest bytes buffered so far
+    uint32_t count;
+    uint32_t sizes[MAX_SESSION_FILES];
+    char names[MAX_SESSION_FILES][32];
+    uint32_t current;      // File whose record is arriving
+    uint32_t pos;          // Bytes of that record received: payload, then its 4 CRC bytes
+    uint32_t runningCrc;
+    uint8_t crcBytes[sizeof(uint32_t)];
+    FILE *f;
+    char tempPath[TEMP_PATH_SIZE];
+    uint32_t saved, failed;
+} SessionRx;
+
+void session_reset(SessionRx *s) {
+    DiscardTempFile(&s->f, s->tempPath);
+    memset(s, 0, sizeof(SessionRx));
+}
+
+// LEB128 varint. Returns 1 when complete, 0 if more bytes are needed, -1 if it runs past 32 bits.
+static int get_varint(const uint8_t *p, uint32_t len, uint32_t *pos, uint32_t *v) {
+    *v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (*pos >= len) return 0;
+        uint8_t b = p[(*pos)++];
+        *v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) return 1;
+    }
+    return -1;
+}
+
+// Parses the manifest buffered so far. Same return convention as get_varint; 1 also means its CRC checked out.
+static int session_parse(SessionRx *s) {
+    uint32_t pos = 1, len = s->manifestLen, crc;
+    int r = get_varint(s->manifest, len, &pos, &s->count);
+    if (r <= 0) return r;
+    if (s->count == 0 || s->count > MAX_SESSION_FILES) return -1;
+    for (uint32_t i = 0; i < s->count; i++) {
+        if ((r = get_varint(s->manifest, len, &pos, &s->sizes[i])) <= 0) return r;
+        if (pos >= len) return 0;
+        uint8_t n = s->manifest[pos++];
+        if (n >= sizeof(s->names[i])) return -1;
+        if (pos + n > len) return 0;
+        memcpy(s->names[i], s->manifest + pos, n);
+        s->names[i][n] = '\0';
+        for (char *c = s->names[i]; *c; c++) if (*c == '/' || *c == '\\' || *c == ':') *c = '_'; // Stay in this folder
+        if (n == 0) snprintf(s->names[i], sizeof(s->names[i]), "file%u", i + 1);
+        pos += n;
+    }
+    if (pos + sizeof(crc) > len) return 0;
+    memcpy(&crc, s->manifest + pos, sizeof(crc));
+    return crc == crc32c_update(0, s->manifest, pos) ? 1 : -1;
+}
+
+static void session_open(SessionRx *s) {
+    uint32_t size = s->sizes[s->current];
+    s->pos = 0; s->runningCrc = 0;
+    RxLog("\n >> FILE %u/%u: %s | SIZE: %u bytes\n", s->current + 1, s->count, s->names[s->current], size);
+    MakeTempPath(s->tempPath, sizeof(s->tempPath), s->names[s->current]);
+    s->f = OpenPartFile(s->tempPath, "wb");
+    if (s->f && size > 0 && (fseek(s->f, size - 1, SEEK_SET) != 0 || fputc(0, s->f) == EOF || fseek(s->f, 0, SEEK_SET) != 0))
+        DiscardTempFile(&s->f, s->tempPath);
+    if (!s->f) RxLog(RED_TEXT "\n [ERROR] Cannot create %s. Data will not be saved.\n" RESET_TEXT, s->tempPath);
+}
+
+static void session_close(SessionRx *s) {
+    const char *name = s->names[s->current];
+    uint32_t expected;
+    bool duplicate;
+    memcpy(&expected, s->crcBytes, sizeof(expected));
+    bool flushed = s->f && fclose(s->f) == 0;
+    s->f = NULL;
+    if (expected != s->runningCrc) {
+        RxLog(RED_TEXT "\n [ERROR] %s: Checksum Mismatch (Recv: %08X, Calc: %08X)\n" RESET_TEXT, name, expected, s->runningCrc);
+        remove(s->tempPath); s->failed++;
+    } else if (flushed && SaveTempFile(s->tempPath, name, expected, &duplicate)) {
+        RxLog("\n [SUCCESS] %s: %s\n", duplicate ? "Already saved" : "Saved", name);
+        s->saved++;
+    } else {
+        RxLog(RED_TEXT "\n [ERROR] Write permission denied. Cannot save %s.\n" RESET_TEXT, name);
+        remove(s->tempPath); s->failed++;
+    }
+    s->tempPath[0] = '\0';
+}
+
+void session_begin(SessionRx *s) {
+    session_reset(s);
+    s->active = true;
+    s->manifest[s->manifestLen++] = SYNC_MARKER_SESSION;
+}
+
+// Feeds one received byte. Clears s->active if the manifest turns out to be garbage.
+void session_byte(SessionRx *s, uint8_t b) {
+    if (!s->manifestDone) {
+        int r = -1;
+        if (s->manifestLen < sizeof(s->manifest)) {
+            s->manifest[s->manifestLen++] = b;
+            r = session_parse(s);
+        }
+        if (r < 0) { RxLog(RED_TEXT "\n [ERROR] Session manifest invalid. Resetting...\n" RESET_TEXT); s->active = false; return; }
+        if (r == 0) return;
+        s->manifestDone = true;
+        RxLog("\n >> SESSION: %u files\n", s->count);
+        session_open(s);
+        return;
+    }
+    if (s->current >= s->count) return; // Trailing noise after the last record
+    uint32_t size = s->sizes[s->current];
+    if (s->pos < size) {
+        s->runningCrc = crc32c_update(s->runningCrc, &b, 1);
+        if (s->f) fputc(b, s->f);
+    } else s->crcBytes[s->pos - size] = b;
+    if (++s->pos == size + sizeof(uint32_t)) {
+        session_close(s);
+        if (++s->current < s->count) session_open(s);
+    }
+}
+
+// TERM: whatever is still open never completed. Files that already verified stay saved.
+void session_finish(SessionRx *s) {
+    if (!s->manifestDone) RxLog(RED_TEXT "\n [ERROR] Transmission Failed: Session manifest incomplete\n" RESET_TEXT);
+    else {
+        if (s->current < s->count) {
+            RxLog(RED_TEXT "\n [ERROR] Transmission Incomplete: %u of %u files missing\n", s->count - s->current, s->count);
+            for (uint32_t i = s->current; i < s->count; i++) RxLog("         %s\n", s->names[i]);
+            RxLog(RESET_TEXT);
+        }
+        RxLog("\n >> SESSION: saved %u of %u files\n", s->saved, s->count);
+    }
+    session_reset(s);
+}
+
+// --- Diversity Combining ---
+/* Fills chMag (FFT_SIZE/2 bins per channel) from nCh channel histories, each a circular buffer of FFT_SIZE samples
+   laid out one after another. Real channels are transformed two at a time, one in the real part and one in the
+   imaginary part, then separated using conjugate symmetry, so four channels cost two FFTs. */
+void ChannelSpectra(kiss_fft_cfg cfg, const float *history, int writeIdx, int nCh, kiss_fft_cpx *in, kiss_fft_cpx *out, float *chMag) {
+    int half = FFT_SIZE / 2;
+    for (int c = 0; c < nCh; c += 2) {
+        const float *a = history + c * FFT_SIZE;
+        const float *b = (c + 1 < nCh) ? a + FFT_SIZE : NULL;
+        for (int j = 0; j < FFT_SIZE; j++) {
+            int idx = (writeIdx + j) % FFT_SIZE;
+            in[j].r = a[idx];
+            in[j].i = b ? b[idx] : 0.0f;
+        }
+        kiss_fft(cfg, in, out);
+
+        float *ma = chMag + c * half, *mb = chMag + (c + 1) * half;
+        for (int k = 1; k < half; k++) {
+            kiss_fft_cpx z = out[k], w = out[FFT_SIZE - k];
+            if (!b) { ma[k] = sqrtf(z.r * z.r + z.i * z.i); continue; }
+            float xr = z.r + w.r, xi = z.i - w.i; // Z[k] + conj(Z[N-k]) = 2A[k]
+            float yr = z.r - w.r, yi = z.i + w.i; // Z[k] - conj(Z[N-k]) = 2iB[k]
+            ma[k] = 0.5f * sqrtf(xr * xr + xi * xi);
+            mb[k] = 0.5f * sqrtf(yr * yr + yi * yi);
+        }
+    }
+}
+
+/* Merges per-channel magnitudes into one per bin. Each channel keeps a noise floor (mean bin magnitude, tracked while
+   nothing is being received) and a peak level (strongest bin, smoothed). Maximal-ratio sums power weighted by
+   (peak/noise)^2 / noise^2, so a quiet, noisy mic adds little; selection uses only the channel with the best
+   peak-to-noise ratio. Output stays on the single-channel scale so THRESHOLD still applies. */
+void CombineChannels(const float *chMag, int nCh, float *chNoise, float *chPeak, bool quiet, float *mag) {
+    int half = FFT_SIZE / 2;
+    float w[MAX_DIVERSITY_CHANNELS], wSum = 0.0f;
+    int best = 0;
+    for (int c = 0; c < nCh; c++) {
+        const float *m = chMag + c * half;
+        float sum = 0.0f, peak = 0.0f;
+        for (int k = 1; k < half; k++) { sum += m[k]; if (m[k] > peak) peak = m[k]; }
+        if (quiet || chNoise[c] <= 0.0f) {
+            float mean = sum / (half - 1);
+            chNoise[c] = chNoise[c] > 0.0f ? chNoise[c] * 0.95f + mean * 0.05f : mean;
+        }
+        chPeak[c] = chPeak[c] * 0.9f + peak * 0.1f;
+        float noise = chNoise[c] + 1e-12f, snr = chPeak[c] / noise;
+        w[c] = snr * snr / (noise * noise);
+        wSum += w[c];
+        if (chPeak[c] * chNoise[best] > chPeak[best] * chNoise[c]) best = c;
+    }
+    if (DIVERSITY == 1) {
+        memcpy(mag + 1, chMag + best * half + 1, (half - 1) * sizeof(float));
+        return;
+    }
+    for (int k = 1; k < half; k++) {
+        float acc = 0.0f;
+        for (int c = 0; c < nCh; c++) { float m = chMag[c * half + k]; acc += w[c] * m * m; }
+        mag[k] = sqrtf(acc / wSum);
+    }
+}
+
+// Frequencies of one transmitter's band. A single stream uses the whole spectrum; several split it between them.
+typedef struct {
+    float baseFreq, binSpacing, freqHello, freqHeader, freqTerm;
+    int loBin, hiBin; // Peak search range [loBin, hiBin)
+} BandPlan;
+
+// True if freq sits on one of our tones (protocol or data grid) rather than somewhere random like room noise.
+bool IsProtocolTone(const BandPlan *band, float freq) {
+    if (fabs(freq - band->freqHello) < BIN_WIDTH * 1.5f || fabs(freq - band->freqHeader) < BIN_WIDTH * 1.5f || fabs(freq - band->freqTerm) < BIN_WIDTH * 2.5f) return true;
+    float idx = (freq - band->baseFreq) / band->binSpacing;
+    return idx > -0.5f && idx < REPEAT_IDX + 0.5f && fabsf(idx - floorf(idx + 0.5f)) * band->binSpacing < BIN_WIDTH * 0.5f;
+}
+
+/* Lays out n bands side by side between bin 20 and just below Nyquist. Each band is HELLO, HEADER, then 257 data
+   tones and TERM, with the data spacing as wide as the band allows. TERM sits well clear of the top data tone, as in
+   the single-stream layout, since it is acted on without debouncing. Fails if the FFT has too few bins for n. */
+bool PlanBands(BandPlan *bands, int n) {
+    int width = (FFT_SIZE / 2 - 28) / n;
+    int spacing = (width - 39) / 256; // 12 bins of protocol tones below the data, TERM 24 above, 3 spare before the next band
+    if (spacing < 1) return false;
+    for (int s = 0; s < n; s++) {
+        int b0 = 20 + s * width;
+        bands[s].freqHello = BIN_WIDTH * b0;
+        bands[s].freqHeader = BIN_WIDTH * (b0 + 6);
+        bands[s].baseFreq = BIN_WIDTH * (b0 + 12);
+        bands[s].binSpacing = BIN_WIDTH * spacing;
+        bands[s].freqTerm = BIN_WIDTH * (b0 + 12 + 256 * spacing + 24);
+        bands[s].loBin = b0 - 2;
+        bands[s].hiBin = b0 + width - 2;
+    }
+    return true;
+}
+
+// --- Per-Stream Receiver ---
+/* Everything one transmission needs: band, threshold, protocol state and output file. Each stream gets its own so
+   several transmitters on different bands decode side by side off the same FFT. */
+typedef struct {
+    int id;
+    BandPlan band;
+    float threshold;
+    float smoothedNoise; // Adaptive Threshold: rolling noise floor of this band
+    float lastMag, lastFreq; // This hop's peak, for the monitor line
+    ProtocolState state;
+    int stableCount, lastByte, processedByte, lastValidByte;
+    int dropCount;
+    int silenceFrames;   // Frames of silence after which a marker-only session (carousel) drops back to IDLE
+
+    /* Payload bytes are streamed straight into a temp file next to the final one instead of being held in RAM,
+       so memory stays constant no matter how large the transfer is. Only the header is buffered. */
+    ChordHeader header;
+    unsigned char headerBytes[sizeof(CarouselHeader) + 255 + sizeof(uint32_t)]; // Big enough for a ChordHeader or a whole carousel packet
+    FILE *rxFile;
+    char tempPath[TEMP_PATH_SIZE];
+    char partTag[16];    // Makes tempPath unique when other receivers may be taking down the same file
+    uint8_t runningSum;  // Checksums updated as each payload byte arrives, so TERM doesn't need another pass
+    uint32_t runningCrc;
+    uint32_t headerLen;  // Depends on which sync marker opened the transfer
+    uint32_t bufPtr;
+    bool headerDone;
+    bool legacyHeader;
+    uint8_t legacyChecksum;
+    bool framedMode;
+    FramedRx framed;
+    FountainRx fountain;
+    bool awaitMarker;    // A carousel packet just ended; ignore bytes until the next marker tone
+    bool sessionMode;    // Multi-file session: bytes go to the session instead of a single header and payload
+    SessionRx session;
+    char label[96];      // Output prefix when several inputs or streams share the console
+    uint32_t saved, failed; // Single-file transfers that ended at TERM, for --soak
+} Receiver;
+
+void ReceiverInit(Receiver *rx, int id, const BandPlan *band, int silenceFrames) {
+    memset(rx, 0, sizeof(Receiver)); //Makes sure no data is left from previous runs, prevents dirty memory issues in header struct.
+    rx->id = id;
+    rx->band = *band;
+    rx->threshold = THRESHOLD;
+    rx->smoothedNoise = 1.0f; // Start low, will adapt quickly
+    rx->state = STATE_IDLE;
+    rx->lastByte = rx->processedByte = rx->lastValidByte = -1;
+    rx->silenceFrames = silenceFrames;
+}
+
+void ReceiverFree(Receiver *rx) {
+    DiscardTempFile(&rx->rxFile, rx->tempPath); // Ctrl+C mid-transfer leaves no partial file
+    framed_free(&rx->framed);
+    fountain_free(&rx->fountain);
+    session_reset(&rx->session);
+}
+
+// Strongest bin inside the band. Returns its magnitude and stores its frequency in *freq.
+float BandPeak(const BandPlan *band, const float *spectrum, float *freq) {
+    float maxM = 0; int maxI = 0;
+    for (int k = band->loBin; k < band->hiBin; k++)
+        if (spectrum[k] > maxM) { maxM = spectrum[k]; maxI = k; }
+
+    *freq = maxI * BIN_WIDTH;
+    // Scaled for Rectangular Window (Raw)
+    return maxM * 2.0f;
+}
+
+// --- ADAPTIVE THRESHOLD LOGIC ---
+void UpdateThreshold(Receiver *rx, float maxM, float freq) {
+    // Strong peaks right on one of our tones are a transmission (e.g. a carousel joined mid-stream), not room noise
+    if (rx->state == STATE_IDLE && !(maxM > rx->threshold && IsProtocolTone(&rx->band, freq))) {
+        // Low pass filter to create a rolling average of the noise floor
+        rx->smoothedNoise = (rx->smoothedNoise * 0.95f) + (maxM * 0.05f);
+        
+        if (AUTO_THRESHOLD) {
+            // Require signal to be 3x the noise floor
+            rx->threshold = rx->smoothedNoise * 3.0f;
+            // Clamp to a safe minimum to prevent hardware hiss triggering
+            if (rx->threshold < 2.0f) rx->threshold = 2.0f;
+        }
+    }
+}
+
+// Protocol state machine for one hop, given the band's peak after the threshold update
+void ReceiverDecide(Receiver *rx, float maxM, float freq) {
+    g_CurrentLabel = rx->label;
+    g_CurrentPartTag = rx->partTag;
+    int curByte = -1;
+    rx->lastMag = maxM; rx->lastFreq = freq;
+
+    if (maxM > rx->threshold) {
+        float rawIdx = (freq - rx->band.baseFreq) / rx->band.binSpacing;
+        curByte = (int)(rawIdx + 0.5f); // Round to nearest integer to prevent smearing
+    }
+
+    // 1. TERMINATION
+    if (rx->state == STATE_READ_DATA && maxM > (rx->threshold * 0.7f) && fabs(freq - rx->band.freqTerm) < (BIN_WIDTH * 2.5f)) {
+        RxLog("\n >> TERMINATION DETECTED.");
+        if (rx->sessionMode) { session_finish(&rx->session); rx->sessionMode = false; }
+        else if (rx->headerDone) {
+            /* Checksum was accumulated byte by byte while receiving, so there is nothing left to sum here */
+            uint32_t expected = rx->legacyHeader ? rx->legacyChecksum : rx->header.crc32c;
+            uint32_t calculated = rx->legacyHeader ? rx->runningSum : rx->runningCrc;
+            uint32_t expectedTotalBytes = rx->headerLen + rx->header.fileSize;
+            bool incomplete = rx->bufPtr < expectedTotalBytes;
+            bool duplicate;
+            if (rx->framedMode) {
+                if (rx->framed.active && rx->framed.fill > 0) rx->framed.badBlocks++; // Block cut off by the terminator
+                rx->framed.active = false;
+                incomplete = rx->framed.receivedCount < rx->framed.blockCount;
+                // Gaps were filled out of order by a replay, so the running CRC can't cover the file; read it back once
+                if (!incomplete && rx->framed.nextInOrder != rx->framed.blockCount && rx->rxFile) { fflush(rx->rxFile); calculated = crc32c_file(rx->rxFile, rx->header.fileSize); }
+                RxLog("\n >> BLOCKS: %u/%u good | %u rejected", rx->framed.receivedCount, rx->framed.blockCount, rx->framed.badBlocks);
+            }
+            bool flushed = rx->rxFile && fclose(rx->rxFile) == 0;
+            rx->rxFile = NULL;
+
+            if (incomplete && rx->framedMode) {
+                // Keep the good blocks on disk; a replay of just the missing ranges completes the file
+                RxLog(RED_TEXT "\n [ERROR] Transmission Incomplete: kept good blocks in %s\n", rx->tempPath);
+                framed_report_lost(&rx->framed);
+                RxLog("         >> ADVICE: Replay with that SendRanges line while this decoder keeps running.\n" RESET_TEXT);
+                rx->framed.pending = true;
+                rx->tempPath[0] = '\0';
+            }
+            else if (incomplete) {
+                RxLog(RED_TEXT "\n [ERROR] Transmission Failed: Incomplete Data\n");
+                RxLog("         Expected: %u bytes | Received: %u bytes\n", expectedTotalBytes, rx->bufPtr);
+                RxLog("         >> ADVICE: Signal lost. Increase sound volume or refer to README to fix dropping bytes.\n" RESET_TEXT);
+            }
+            else if (calculated != expected) {
+                RxLog(RED_TEXT "\n [ERROR] Transmission Failed: Checksum Mismatch (Recv: %08X, Calc: %08X)\n", expected, calculated);
+                RxLog("         >> ADVICE: Data corrupted. Reduce background noise or volume (to prevent clipping).\n" RESET_TEXT);
+            } 
+            else if (flushed && SaveTempFile(rx->tempPath, rx->header.fileName, calculated, &duplicate)) {
+                // Atomic rename: the final name only ever holds a complete, verified file
+                RxLog("\n [SUCCESS] %s: %s\n", duplicate ? "Already saved" : "Saved", rx->header.fileName);
+                rx->saved++;
+                rx->tempPath[0] = '\0';
+                if (rx->framedMode) framed_reset(&rx->framed);
+            } else {
+                RxLog(RED_TEXT "\n [ERROR] Write permission denied. Cannot save file.\n" RESET_TEXT);
+            }
+            if (rx->tempPath[0]) rx->failed++;
+            if (rx->tempPath[0] && !g_KeepPartial) remove(rx->tempPath); // Drop the partial file on any failure
+        }
+        rx->state = STATE_IDLE; rx->processedByte = -1; rx->stableCount = 0; return;
+    }
+
+    // 2. STABILITY
+    if (maxM < rx->threshold) {
+        if (++rx->dropCount >= 6) { rx->processedByte = -1; rx->stableCount = 0; }
+        // Carousels have no terminator: once a marker-only session goes quiet, go back to monitoring
+        if (rx->state == STATE_READ_DATA && !rx->headerDone && rx->dropCount == rx->silenceFrames) {
+            rx->state = STATE_IDLE;
+            RxLog("\n >> SIGNAL LOST. Monitoring...\n");
+        }
+    } else {
+        rx->dropCount = 0; // Signal back, reset drop timer
+        if (curByte != rx->lastByte) { rx->stableCount = 0; rx->lastByte = curByte; }
+        else { rx->stableCount++; }
+    }
+
+    // 3. STATE MACHINE, ensures proper sequencing of hello, header, data, and termination signals. Also handles byte processing and debouncing.
+    if (maxM > rx->threshold) {
+        if (rx->state == STATE_IDLE) {
+            if (fabs(freq - rx->band.freqHello) < (BIN_WIDTH * 1.5f)) {
+                rx->state = STATE_WAIT_HEADER;
+                RxLog("\n >> HANDSHAKE (Mag: %.2f)", maxM);
+            } else if (fabs(freq - rx->band.freqHeader) < (BIN_WIDTH * 1.5f) && rx->stableCount >= DEBOUNCE_LIMIT) {
+                // Marker with no HELLO: a carousel broadcast we joined part way through
+                rx->state = STATE_READ_DATA;
+                rx->bufPtr = 0; rx->headerDone = false; rx->awaitMarker = false; rx->processedByte = curByte;
+                RxLog("\n >> MARKER LOCKED. Listening for packets...\n");
+            }
+        } else if (rx->state == STATE_WAIT_HEADER) {
+            if (fabs(freq - rx->band.freqHeader) < (BIN_WIDTH * 1.5f)) {
+                rx->state = STATE_READ_DATA;
+                rx->bufPtr = 0; rx->headerDone = false; rx->processedByte = -1; rx->awaitMarker = false;
+                DiscardTempFile(&rx->rxFile, rx->tempPath); // A new transfer abandons any unfinished one
+                session_reset(&rx->session); rx->sessionMode = false;
+                RxLog("\n >> SYNC LOCKED. Receiving Data...\n");
+            }
+        } else if (rx->state == STATE_READ_DATA) {
+            if (rx->stableCount >= DEBOUNCE_LIMIT && curByte != rx->processedByte) {
+                rx->processedByte = curByte; // Lock this frequency
+                if (fabs(freq - rx->band.freqHeader) < (BIN_WIDTH * 1.5f)) { // Block marker: resync point in framed transfers
+                    if (rx->headerDone && rx->framedMode) framed_marker(&rx->framed);
+                    else if (!rx->headerDone) { rx->bufPtr = 0; rx->awaitMarker = false; } // Carousel packet boundary; drop any half-heard packet
+                    return;
+                }
+                int byteToProcess = (curByte == REPEAT_IDX) ? rx->lastValidByte : curByte;
+                if (curByte >= 0 && curByte <= 255) rx->lastValidByte = curByte;
+
+                if (rx->bufPtr == 0) { // The sync marker tells us which header layout follows
+                    if (rx->awaitMarker) return;
+                    if ((uint8_t)byteToProcess == SYNC_MARKER_V2) rx->headerLen = sizeof(ChordHeader);
+                    else if ((uint8_t)byteToProcess == SYNC_MARKER) rx->headerLen = sizeof(ChordHeaderV1);
+                    else if ((uint8_t)byteToProcess == SYNC_MARKER_CAROUSEL) rx->headerLen = sizeof(CarouselHeader);
+                    else if ((uint8_t)byteToProcess == SYNC_MARKER_SESSION) { // Manifest is variable length; SessionRx buffers it
+                        rx->sessionMode = true;
+                        session_begin(&rx->session);
+                        rx->bufPtr = 1;
+                        if (VERBOSE_MODE) RxLog("[%02X]", (uint8_t)byteToProcess);
+                        return;
+                    }
+                    else return;
+                }
+
+                if (rx->sessionMode) {
+                    session_byte(&rx->session, (uint8_t)byteToProcess);
+                    rx->bufPtr++;
+                    if (VERBOSE_MODE) RxLog("[%02X]", (uint8_t)byteToProcess);
+                    if (!rx->session.active) { rx->sessionMode = false; rx->bufPtr = 0; } // Bad manifest: wait for a sync marker again
+                    return;
+                }
+
+                if (byteToProcess >= -1) { //Simply logic to check for valid byte range
+                    unsigned char b = (unsigned char)byteToProcess;
+                    if (!rx->headerDone) rx->headerBytes[rx->bufPtr] = b;
+                    else if (rx->framedMode) framed_byte(&rx->framed, b, rx->rxFile, &rx->runningCrc);
+                    else if (rx->bufPtr - rx->headerLen < rx->header.fileSize) {
+                        // Stream payload to disk; bytes past fileSize are counted but never written
+                        rx->runningSum += b;
+                        rx->runningCrc = crc32c_update(rx->runningCrc, &b, 1);
+                        if (rx->rxFile) fputc(b, rx->rxFile);
+                    }
+                    rx->bufPtr++;
+                    if (VERBOSE_MODE) RxLog("[%02X]", b);
+
+                    if (rx->headerBytes[0] == SYNC_MARKER_CAROUSEL) { // Self-contained packet: no payload phase
+                        if (rx->bufPtr >= sizeof(CarouselHeader)) {
+                            CarouselHeader ch;
+                            memcpy(&ch, rx->headerBytes, sizeof(CarouselHeader));
+                            uint32_t packetLen = sizeof(CarouselHeader) + (ch.esi == CAROUSEL_NAME_ESI ? sizeof(rx->header.fileName) : ch.blockSize) + sizeof(uint32_t);
+                            if (rx->bufPtr == packetLen) { carousel_packet(&rx->fountain, rx->headerBytes, packetLen); rx->bufPtr = 0; rx->awaitMarker = true; }
+                        }
+                        return;
+                    }
+
+                    if (!rx->headerDone && rx->bufPtr == rx->headerLen) {
+                        rx->legacyHeader = (rx->headerBytes[0] == SYNC_MARKER);
+                        if (rx->legacyHeader) { // Translate v1 into the current layout, keeping its 8-bit sum aside
+                            ChordHeaderV1 v1;
+                            memcpy(&v1, rx->headerBytes, sizeof(ChordHeaderV1));
+                            memset(&rx->header, 0, sizeof(ChordHeader));
+                            rx->header.syncMarker = v1.syncMarker;
+                            memcpy(rx->header.fileName, v1.fileName, sizeof(rx->header.fileName));
+                            rx->header.fileSize = v1.fileSize;
+                            rx->legacyChecksum = v1.checksum;
+                        } else memcpy(&rx->header, rx->headerBytes, sizeof(ChordHeader));
+                        rx->header.fileName[sizeof(rx->header.fileName) - 1] = '\0'; // Never trust a received string to be terminated
+
+                        rx->framedMode = !rx->legacyHeader && (rx->header.flags & HDR_FLAG_FRAMED);
+                        if (!rx->legacyHeader && (rx->header.flags & HDR_FLAG_HEADER_CRC) &&
+                            crc32c_update(0, rx->headerBytes, offsetof(ChordHeader, headerCrc)) != rx->header.headerCrc) {
+                            // Reject now rather than after minutes of payload sent to a garbage name/size
+                            RxLog(RED_TEXT "\n [ERROR] Header CRC Fail. Resetting...\n" RESET_TEXT);
+                            rx->bufPtr = 0;
+                        } else if (rx->framedMode && rx->header.blockSize == 0) {
+                            RxLog(RED_TEXT "\n [ERROR] Framed header with no block size. Resetting...\n" RESET_TEXT);
+                            rx->bufPtr = 0;
+                        } else if (rx->framedMode && framed_matches(&rx->framed, &rx->header)) {
+                            // Replay of a file we have a partial copy of: reopen it and only fill the gaps
+                            rx->headerDone = true;
+                            MakeTempPath(rx->tempPath, sizeof(rx->tempPath), rx->header.fileName);
+                            rx->rxFile = OpenPartFile(rx->tempPath, "r+b");
+                            rx->framed.pending = false; rx->framed.active = false;
+                            rx->framed.nextInOrder = UINT32_MAX; // Out-of-order from here on; verified by reading back at TERM
+                            RxLog("\n >> RESUMING: %s | %u of %u blocks missing\n", rx->header.fileName, rx->framed.blockCount - rx->framed.receivedCount, rx->framed.blockCount);
+                            if (!rx->rxFile) RxLog(RED_TEXT "\n [ERROR] Cannot reopen %s. Data will not be saved.\n" RESET_TEXT, rx->tempPath);
+                        } else {
+                            rx->headerDone = true;
+                            rx->runningSum = 0; rx->runningCrc = 0;
+                            RxLog("\n >> FILENAME: %s | SIZE: %u bytes%s\n", rx->header.fileName, rx->header.fileSize, rx->framedMode ? " | FRAMED" : "");
+                            if (rx->framed.pending) framed_reset(&rx->framed); // A different file drops any pending gap-fill
+                            if (rx->framedMode && !framed_begin(&rx->framed, &rx->header)) RxLog(RED_TEXT "\n [ERROR] Memory allocation failed. Blocks will be dropped.\n" RESET_TEXT);
+
+                            // Preallocate the temp file at full size up front so the disk space is reserved before any audio is spent
+                            MakeTempPath(rx->tempPath, sizeof(rx->tempPath), rx->header.fileName);
+                            rx->rxFile = OpenPartFile(rx->tempPath, "wb");
+                            if (rx->rxFile && rx->header.fileSize > 0 && (fseek(rx->rxFile, rx->header.fileSize - 1, SEEK_SET) != 0 || fputc(0, rx->rxFile) == EOF || fseek(rx->rxFile, 0, SEEK_SET) != 0))
+                                DiscardTempFile(&rx->rxFile, rx->tempPath);
+                            if (!rx->rxFile) RxLog(RED_TEXT "\n [ERROR] Cannot create %s. Data will not be saved.\n" RESET_TEXT, rx->tempPath);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Runs one stream's protocol state machine on this hop's spectrum, looking only at the bins of its own band.
+void ReceiverStep(Receiver *rx, const float *spectrum) {
+    float freq;
+    float maxM = BandPeak(&rx->band, spectrum, &freq);
+    UpdateThreshold(rx, maxM, freq);
+    ReceiverDecide(rx, maxM, freq);
+}
+
 bool load_config(const char* filename) {
     FILE* file = fopen(filename, "r");
     if (!file) return false;
@@ -71,7 +1129,19 @@ bool load_config(const char* filename) {
 
         char key[64];
         float value;
-        if (sscanf(line, "%63[^=]=%f", key, &value) == 2) {
+        char text[256];
+        if (sscanf(line, "%63[^=]=%255[^\r\n]", key, text) == 2 && (strcmp(key, "SpoolDir") == 0 || strcmp(key, "Fifos") == 0 ||
+            strncmp(key, "Bench", 5) == 0 || strcmp(key, "StatsFile") == 0)) {
+            if (strcmp(key, "SpoolDir") == 0) snprintf(SPOOL_DIR, sizeof(SPOOL_DIR), "%s", text);
+            else if (strcmp(key, "Fifos") == 0) snprintf(FIFOS, sizeof(FIFOS), "%s", text);
+            else if (strcmp(key, "BenchFftSizes") == 0) snprintf(BENCH_FFT_SIZES, sizeof(BENCH_FFT_SIZES), "%s", text);
+            else if (strcmp(key, "BenchStepSizes") == 0) snprintf(BENCH_STEP_SIZES, sizeof(BENCH_STEP_SIZES), "%s", text);
+            else if (strcmp(key, "BenchOutput") == 0) snprintf(BENCH_OUTPUT, sizeof(BENCH_OUTPUT), "%s", text);
+            else if (strcmp(key, "BenchTolerance") == 0) BENCH_TOLERANCE = (float)atof(text);
+            else if (strcmp(key, "BenchMinNs") == 0) BENCH_MIN_NS = (float)atof(text);
+            else if (strcmp(key, "StatsFile") == 0) snprintf(STATS_FILE, sizeof(STATS_FILE), "%s", text);
+        }
+        else if (sscanf(line, "%63[^=]=%f", key, &value) == 2) {
             if (strcmp(key, "FFT_SIZE") == 0) FFT_SIZE = (int)value;
             else if (strcmp(key, "STEP_SIZE") == 0) STEP_SIZE = (int)value;
             else if (strcmp(key, "AutoSpacing") == 0) AUTO_SPACING = (bool)value;
@@ -79,6 +1149,16 @@ bool load_config(const char* filename) {
             else if (strcmp(key, "Verbose") == 0) VERBOSE_MODE = (bool)value;
             else if (strcmp(key, "Threshold") == 0) THRESHOLD = value;
             else if (strcmp(key, "DebounceLimit") == 0) DEBOUNCE_LIMIT = (int)value;
+            else if (strcmp(key, "AdaptiveHop") == 0) ADAPTIVE_HOP = (bool)value;
+            else if (strcmp(key, "IdleGate") == 0) IDLE_GATE = (bool)value;
+            else if (strcmp(key, "SoakLoadThreads") == 0) SOAK_LOAD_THREADS = (int)value;
+            else if (strcmp(key, "Diversity") == 0) DIVERSITY = (int)value;
+            else if (strcmp(key, "Streams") == 0) STREAMS = (int)value;
+            else if (strcmp(key, "Daemon") == 0) DAEMON = (bool)value;
+            else if (strcmp(key, "Workers") == 0) WORKERS = (int)value;
+            else if (strcmp(key, "DaemonDevice") == 0) DAEMON_DEVICE = (bool)value;
+            else if (strcmp(key, "SampleRate") == 0) SAMPLE_RATE = (int)value;
+            else if (strcmp(key, "StatsInterval") == 0) STATS_INTERVAL = value;
             else if (strcmp(key, "BaseFreq") == 0) BASE_FREQ = value;
             else if (strcmp(key, "BinSpacing") == 0) BIN_SPACING = value;
             else if (strcmp(key, "FreqHello") == 0) FREQ_HELLO = value;
@@ -90,7 +1170,7 @@ bool load_config(const char* filename) {
     return true;
 }
 
-void PrintConfig(int sampleRate) {
+void PrintConfig(int sampleRate, const BandPlan *bands, int streamCount) {
     // 1. Calculate the time it takes to fill the buffer once (Acoustic Fill)
     float windowTimeMs = ((float)FFT_SIZE / sampleRate) * 1000.0f;
     
@@ -109,12 +1189,15 @@ void PrintConfig(int sampleRate) {
     
     printf("[Audio]\n");
     printf("SampleRate=%d\n", sampleRate);
-    printf("\n[Frequencies]\n");
-    printf("BaseFreq=%.3f\n", BASE_FREQ);
-    printf("BinSpacing=%.3f\n", BIN_SPACING);
-    printf("FreqHello=%.3f\n", FREQ_HELLO);
-    printf("FreqHeader=%.3f\n", FREQ_HEADER);
-    printf("FreqTerm=%.3f\n", FREQ_TERM);
+    for (int s = 0; s < streamCount; s++) { // Several streams: each transmitter's .ini gets its own band
+        printf("\n[Frequencies]\n");
+        if (streamCount > 1) printf("; Stream %d of %d\n", s + 1, streamCount);
+        printf("BaseFreq=%.3f\n", bands[s].baseFreq);
+        printf("BinSpacing=%.3f\n", bands[s].binSpacing);
+        printf("FreqHello=%.3f\n", bands[s].freqHello);
+        printf("FreqHeader=%.3f\n", bands[s].freqHeader);
+        printf("FreqTerm=%.3f\n", bands[s].freqTerm);
+    }
     
     printf("\n[Timing]\n");
     printf("; Optimized for %dms Window + %dms Debounce\n", (int)windowTimeMs, (int)debounceTimeMs);
@@ -128,264 +1211,1319 @@ void PrintConfig(int sampleRate) {
     printf("============================================\n\n");
 }
 
-int main(void) {
-    // 1. Declare ALL variables at the top to prevent 'goto' bypass errors
-    IMMDeviceEnumerator *pEnum = NULL;
-    IMMDevice *pDev = NULL;
-    IAudioClient *pCl = NULL;
-    IAudioCaptureClient *pCap = NULL;
-    WAVEFORMATEX *pwfx = NULL;
-    kiss_fft_cfg cfg = NULL;
-    HRESULT hr;
-
-    // Pointers for dynamic memory allocation
-    kiss_fft_cpx *in = NULL;
-    kiss_fft_cpx *out = NULL;
-    float *slidingBuffer = NULL;
-    unsigned char *fileBuffer = NULL;
-
-    int stableCount = 0, lastByte = -1, processedByte = -1, lastValidByte = -1;
-    ProtocolState state = STATE_IDLE;
-    uint32_t bufPtr = 0;
-    bool headerDone = false;
-    ChordHeader header;
-    
-    // Adaptive Threshold Variables
-    float smoothedNoise = 1.0f; // Start low, will adapt quickly
+// --- Instrumentation ---
+double g_TicksToNs = 0.0; // Set from QueryPerformanceFrequency in main
+double NowNs(void) {
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    return (double)t.QuadPart * g_TicksToNs;
+}
 
-    if (!load_config("decoder_config.ini")) { //Ensuring config exist.
-        printf(RED_TEXT "ERROR: decoder_config.ini not found. Using default values.\n" RESET_TEXT);
+/* Build with -DDECODER_STATS to time every hop stage and count packets, overruns and state changes. The numbers are
+   written to StatsFile every StatsInterval seconds for an outside monitor to read. Without the flag STATS() drops
+   its argument, so release builds don't get a single extra instruction in the loop. */
+#ifdef DECODER_STATS
+#define STATS(...) __VA_ARGS__
+#else
+#define STATS(...)
+#endif
+
+#ifdef DECODER_STATS
+/* Log-linear latency histogram (HDR style): 8 buckets per power of two, so any percentile is within ~12% of the
+   truth, from 1 ns to ~18 minutes in 2.5 KB. Recording is a few shifts and one increment. */
+#define HIST_SUB_BITS 3
+#define HIST_SUB (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS (HIST_SUB + 38 * HIST_SUB)
+
+typedef struct {
+    uint64_t count, sumNs, maxNs;
+    uint64_t buckets[HIST_BUCKETS];
+} LatencyHist;
+
+enum { TIMING_FILL, TIMING_FFT, TIMING_MAGNITUDE, TIMING_RECEIVERS, TIMING_HOP, TIMING_COUNT };
+const char *TIMING_NAMES[TIMING_COUNT] = { "fill", "fft", "magnitude", "receivers", "hop" };
+const char *STATE_NAMES[3] = { "idle", "wait_header", "read_data" };
+
+typedef struct {
+    char name[64];
+    uint64_t hops;           // FFT frames analysed
+    uint64_t packets;        // Capture packets (or file/pipe chunks) fed in
+    uint64_t overruns;       // Packets the audio engine flagged as a discontinuity: samples were lost
+    uint64_t deadlineMisses; // Hops that took longer than STEP_SIZE samples of real time
+    uint64_t gatedHops;      // Idle hops answered by the gate without an FFT
+    uint64_t wakes;          // Times the gate heard something and started the full analysis
+    uint64_t transitions[3][3];
+    double budgetNs;         // Real time one hop covers
+    LatencyHist timing[TIMING_COUNT];
+} DecoderStats;
+
+void HistRecord(LatencyHist *h, double ns) {
+    uint64_t v = ns > 0 ? (uint64_t)ns : 0;
+    int idx;
+    if (v < HIST_SUB) idx = (int)v;
+    else {
+        int e = HIST_SUB_BITS;
+        while ((v >> (e + 1)) != 0) e++; // e = index of the top bit
+        idx = HIST_SUB + (e - HIST_SUB_BITS) * HIST_SUB + (int)((v >> (e - HIST_SUB_BITS)) - HIST_SUB);
+        if (idx >= HIST_BUCKETS) idx = HIST_BUCKETS - 1;
     }
+    h->buckets[idx]++;
+    h->count++;
+    h->sumNs += v;
+    if (v > h->maxNs) h->maxNs = v;
+}
 
-    // Declaring COM interfaces and variables to NULL for cleanup later
-    CoInitialize(NULL);
+// Upper edge of the bucket holding the p-th fraction of samples
+double HistPercentile(const LatencyHist *h, double p) {
+    if (h->count == 0) return 0.0;
+    uint64_t target = (uint64_t)(p * h->count), seen = 0;
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen > target) {
+            if (i < HIST_SUB) return i + 1;
+            int e = (i - HIST_SUB) / HIST_SUB + HIST_SUB_BITS, sub = (i - HIST_SUB) % HIST_SUB;
+            return (double)((uint64_t)(HIST_SUB + sub + 1) << (e - HIST_SUB_BITS));
+        }
+    }
+    return (double)h->maxNs;
+}
 
-    signal(SIGINT, SignalHandler); // Allow Ctrl+C to trigger cleanup
+// Writes s as a quoted JSON string. Input names are pipe and spool paths, so backslashes are the common case.
+void WriteJsonString(FILE *f, const char *s) {
+    fputc('"', f);
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') fprintf(f, "\\%c", c);
+        else if (c < 0x20) fprintf(f, "\\u%04x", c);
+        else fputc(c, f);
+    }
+    fputc('"', f);
+}
 
-    // --- INITIALIZE AUDIO CAPTURE ---
-    hr = CoCreateInstance(&CLSID_MMDeviceEnumerator, NULL, CLSCTX_ALL, &IID_IMMDeviceEnumerator, (void **)&pEnum);
-    if (FAILED(hr)) goto cleanup;
-    hr = IMMDeviceEnumerator_GetDefaultAudioEndpoint(pEnum, eCapture, eConsole, &pDev);
-    if (FAILED(hr)) goto cleanup;
-    hr = IMMDevice_Activate(pDev, &IID_IAudioClient, CLSCTX_ALL, NULL, (void **)&pCl);
-    if (FAILED(hr)) goto cleanup;
-    hr = IAudioClient_GetMixFormat(pCl, &pwfx);
-    if (FAILED(hr)) goto cleanup;
-    hr = IAudioClient_Initialize(pCl, AUDCLNT_SHAREMODE_SHARED, 0, 10000000, 0, pwfx, NULL);
-    if (FAILED(hr)) goto cleanup;
-    hr = IAudioClient_GetService(pCl, &IID_IAudioCaptureClient, (void **)&pCap);
-    if (FAILED(hr)) goto cleanup;
-    hr = IAudioClient_Start(pCl);
+void WriteStatsEntry(FILE *f, const DecoderStats *st, bool last) {
+    fprintf(f, "    {\"name\": ");
+    WriteJsonString(f, st->name[0] ? st->name : "default");
+    fprintf(f, ", \"hops\": %llu, \"packets\": %llu, \"overruns\": %llu, \"deadline_misses\": %llu,\n",
+            (unsigned long long)st->hops, (unsigned long long)st->packets,
+            (unsigned long long)st->overruns, (unsigned long long)st->deadlineMisses);
+    fprintf(f, "     \"gated_hops\": %llu, \"wakes\": %llu,\n", (unsigned long long)st->gatedHops, (unsigned long long)st->wakes);
+    fprintf(f, "     \"transitions\": {");
+    bool first = true;
+    for (int a = 0; a < 3; a++)
+        for (int b = 0; b < 3; b++)
+            if (st->transitions[a][b]) {
+                char key[32];
+                snprintf(key, sizeof(key), "%s>%s", STATE_NAMES[a], STATE_NAMES[b]);
+                fprintf(f, "%s", first ? "" : ", ");
+                WriteJsonString(f, key);
+                fprintf(f, ": %llu", (unsigned long long)st->transitions[a][b]);
+                first = false;
+            }
+    fprintf(f, "},\n     \"stages_ns\": {\n");
+    for (int t = 0; t < TIMING_COUNT; t++) {
+        const LatencyHist *h = &st->timing[t];
+        fprintf(f, "       ");
+        WriteJsonString(f, TIMING_NAMES[t]);
+        fprintf(f, ": {\"count\": %llu, \"mean\": %.1f, \"p50\": %.0f, \"p99\": %.0f, \"p999\": %.0f, \"max\": %llu}%s\n",
+                (unsigned long long)h->count, h->count ? (double)h->sumNs / h->count : 0.0,
+                HistPercentile(h, 0.50), HistPercentile(h, 0.99), HistPercentile(h, 0.999), (unsigned long long)h->maxNs,
+                t == TIMING_COUNT - 1 ? "" : ",");
+    }
+    fprintf(f, "     }}%s\n", last ? "" : ",");
+}
+
+/* Written to a temp file and renamed over StatsFile, so a reader never sees half a dump. Counters are read while
+   workers may be updating them; a value can be one hop stale, never torn (64-bit aligned stores). */
+void WriteStats(DecoderStats *const *stats, int count, int sampleRate) {
+    char tmp[MAX_PATH + 8];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", STATS_FILE);
+    FILE *f = fopen(tmp, "w");
+    if (!f) return;
+    fprintf(f, "{\n  \"step_size\": %d,\n  \"fft_size\": %d,\n  \"budget_ns\": %.0f,\n  \"inputs\": [\n",
+            STEP_SIZE, FFT_SIZE, 1e9 * STEP_SIZE / sampleRate);
+    for (int i = 0; i < count; i++) WriteStatsEntry(f, stats[i], i == count - 1);
+    fprintf(f, "  ]\n}\n");
+    if (fclose(f) == 0) MoveFileExA(tmp, STATS_FILE, MOVEFILE_REPLACE_EXISTING);
+}
+#endif
+
+// --- Decoder Context ---
+/* Everything one audio input needs: its sample history, hop counter, FFT scratch and the receivers listening to it.
+   Nothing in here is shared, so different inputs can be analysed on different threads at the same time. */
+typedef struct {
+    kiss_fft_cfg plan;     // Shared, read-only
+    int nCh;               // Channels analysed
+    float *slidingBuffer;  // nCh circular histories of FFT_SIZE samples
+    int writeIdx, stepCounter, uiThrottle;
+    kiss_fft_cpx *in, *out;
+    float *spectrum;       // Bin magnitudes of the current hop, shared by every stream
+    float *chMag;          // Diversity mode: per-channel bin magnitudes
+    float chNoise[MAX_DIVERSITY_CHANNELS], chPeak[MAX_DIVERSITY_CHANNELS];
+    bool lastFrameQuiet;
+    bool showMonitor;      // Print the MONITORING line (interactive mode only)
+    int streamCount;
+    Receiver *receivers;
+    char name[64];
+
+    /* Real-time headroom. The caller reports how much captured audio is still waiting; the decoder measures its own
+       CPU time per second of audio. Under load it hops further while every stream is idle and, at the next level,
+       skips every other hop of a symbol that every stream has already locked on to. */
+    bool adaptive;         // Off for offline decoding, where there is no deadline
+    int sampleRate;
+    double backlogMs;      // Set by the caller before each DecoderFeed
+    double busyNs;         // Analysis time since the last check
+    uint32_t audioFrames;  // Audio fed since the last check
+    double load;           // Last second's analysis time / audio time
+    int level;             // 0 normal, 1 idle hop x2, 2 idle hop x4 + locked-symbol skipping
+    int calmSeconds;       // Consecutive quiet checks before stepping back down
+    int adaptations;
+    bool allIdle, skipToggle;
+
+    /* Idle gate. While every stream is idle and nothing has been heard for a second, hops skip the FFT. Each sample
+       only updates a wideband energy sum and Goertzel filters on every stream's HELLO and marker tones (over
+       FFT_SIZE-sample windows, so they see what that bin of the FFT would). A jump in energy or a tone near the
+       threshold wakes the full analysis; HELLO lasts 5 symbols, far longer than it takes to notice. */
+    bool gated;
+    float *gateCoeff;      // 2 per stream: HELLO, HEADER
+    float *gateState;      // Goertzel s1, s2 per tone per channel
+    int gateFill;          // Samples in the current Goertzel window
+    bool gateTone;         // Last window had a tone within reach of its stream's threshold
+    double blockEnergy, energyFloor;
+    int gateHops;          // One second of hops: how long to stay awake, and how often to refresh the noise floor
+    int gateHold, gateRefresh;
+    STATS(DecoderStats stats;)
+} Decoder;
+
+// name labels this input's output ("" for the single interactive input). Returns false if out of memory.
+bool DecoderInit(Decoder *d, const char *name, int nCh, const BandPlan *bands, int streamCount, int sampleRate, bool showMonitor) {
+    memset(d, 0, sizeof(Decoder));
+    // KissFFT Setup: https://github.com/mborgerding/kissfft. Plans are read-only after they are built, so kfc hands
+    // every input with the same FFT size the same one (Stockham engine when the CPU has the vector butterflies)
+    d->plan = kfc_get(FFT_SIZE, 0);
+    d->nCh = nCh;
+    d->streamCount = streamCount;
+    d->showMonitor = showMonitor;
+    d->lastFrameQuiet = true;
+    d->allIdle = true;
+    d->sampleRate = sampleRate;
+    snprintf(d->name, sizeof(d->name), "%s", name);
+    STATS(snprintf(d->stats.name, sizeof(d->stats.name), "%s", name));
+    STATS(d->stats.budgetNs = 1e9 * STEP_SIZE / sampleRate);
+
+    // Allocate memory dynamically to prevent "transfer of control bypasses initialization" errors
+    d->in = CountedMalloc(sizeof(kiss_fft_cpx) * FFT_SIZE); // FFT input buffer
+    d->out = CountedMalloc(sizeof(kiss_fft_cpx) * FFT_SIZE); // FFT output buffer
+    d->slidingBuffer = CountedCalloc((size_t)nCh * FFT_SIZE, sizeof(float)); // Sliding window buffer for audio samples, one per analysed channel
+    d->spectrum = CountedCalloc(FFT_SIZE / 2, sizeof(float));
+    if (nCh > 1) d->chMag = CountedCalloc((size_t)nCh * (FFT_SIZE / 2), sizeof(float));
+    d->receivers = CountedCalloc(streamCount, sizeof(Receiver));
+    d->gateCoeff = CountedMalloc(sizeof(float) * 2 * streamCount);
+    d->gateState = CountedCalloc((size_t)2 * streamCount * nCh * 2, sizeof(float));
+    if (!d->plan || !d->in || !d->out || !d->slidingBuffer || !d->spectrum || (nCh > 1 && !d->chMag) || !d->receivers ||
+        !d->gateCoeff || !d->gateState) return false;
+    d->gateHops = sampleRate / STEP_SIZE;
+    for (int s = 0; s < streamCount; s++) {
+        d->gateCoeff[2 * s] = 2.0f * cosf(2.0f * (float)PI * bands[s].freqHello / (BIN_WIDTH * FFT_SIZE));
+        d->gateCoeff[2 * s + 1] = 2.0f * cosf(2.0f * (float)PI * bands[s].freqHeader / (BIN_WIDTH * FFT_SIZE));
+    }
+
+    for (int s = 0; s < streamCount; s++) {
+        Receiver *rx = &d->receivers[s];
+        ReceiverInit(rx, s, &bands[s], 2 * sampleRate / STEP_SIZE); // 2 seconds of silence
+        if (name[0] && streamCount > 1) snprintf(rx->label, sizeof(rx->label), "%s / Stream %d", name, s + 1);
+        else if (name[0]) snprintf(rx->label, sizeof(rx->label), "%s", name);
+        else if (streamCount > 1) snprintf(rx->label, sizeof(rx->label), "Stream %d", s + 1);
+        if (rx->label[0]) snprintf(rx->partTag, sizeof(rx->partTag), ".%ld", (long)InterlockedIncrement(&g_ReceiverSerial));
+    }
+    return true;
+}
+
+void DecoderFree(Decoder *d) {
+    if (d->receivers) {
+        for (int s = 0; s < d->streamCount; s++) {
+            if (g_LastTalker == d->receivers[s].label) g_LastTalker = NULL;
+            ReceiverFree(&d->receivers[s]);
+        }
+        free(d->receivers);
+    }
+    if (d->plan) kfc_put(d->plan);
+    if (d->in) free(d->in);
+    if (d->out) free(d->out);
+    if (d->slidingBuffer) free(d->slidingBuffer);
+    if (d->spectrum) free(d->spectrum);
+    if (d->chMag) free(d->chMag);
+    if (d->gateCoeff) free(d->gateCoeff);
+    if (d->gateState) free(d->gateState);
+    memset(d, 0, sizeof(Decoder));
+}
+
+// Unrolls the circular history into the FFT input, oldest sample first
+void FillWindow(const float *history, int writeIdx, kiss_fft_cpx *in) {
+    for (int j = 0; j < FFT_SIZE; j++) {
+        // HANNING REMOVED: Direct assignment of raw signal
+        in[j].r = history[(writeIdx + j) % FFT_SIZE];
+        in[j].i = 0.0f; // Imaginary part 0 for single stream analysis
+    }
+}
+
+void MagnitudeSpectrum(const kiss_fft_cpx *out, float *spectrum) {
+    // We only scan the first half because the second is mirrored (Nyquist Theorem)
+    for (int k = 1; k < FFT_SIZE / 2; k++)
+        spectrum[k] = sqrtf(out[k].r * out[k].r + out[k].i * out[k].i);
+}
+
+// --- Idle Gate ---
+// One sample through the gate. Runs for every sample while gated, so it is kept to a few multiply-adds.
+void GateSample(Decoder *d, const float *frame) {
+    int tones = 2 * d->streamCount;
+    for (int c = 0; c < d->nCh; c++) {
+        float x = frame[c];
+        d->blockEnergy += x * x;
+        float *st = &d->gateState[c * tones * 2];
+        for (int t = 0; t < tones; t++, st += 2) {
+            float s0 = x + d->gateCoeff[t] * st[0] - st[1];
+            st[1] = st[0]; st[0] = s0;
+        }
+    }
+    if (++d->gateFill < FFT_SIZE) return;
+
+    // Window complete: each filter now holds that tone's FFT bin. Scaled like BandPeak so thresholds compare.
+    d->gateFill = 0;
+    for (int s = 0; s < d->streamCount; s++) {
+        Receiver *rx = &d->receivers[s];
+        rx->lastMag = 0.0f;
+        for (int t = 2 * s; t < 2 * s + 2; t++) {
+            for (int c = 0; c < d->nCh; c++) {
+                float *st = &d->gateState[(c * tones + t) * 2];
+                float power = st[0] * st[0] + st[1] * st[1] - d->gateCoeff[t] * st[0] * st[1];
+                float mag = 2.0f * sqrtf(power > 0.0f ? power : 0.0f);
+                if (mag > rx->lastMag) { rx->lastMag = mag; rx->lastFreq = t == 2 * s ? rx->band.freqHello : rx->band.freqHeader; }
+                st[0] = st[1] = 0.0f;
+            }
+        }
+        // Half the threshold: a window that straddles the start of the tone only catches part of it
+        if (rx->lastMag > rx->threshold * 0.5f) d->gateTone = true;
+    }
+}
+
+// Start gating from a clean Goertzel window and energy block
+void GateReset(Decoder *d) {
+    memset(d->gateState, 0, sizeof(float) * 2 * d->streamCount * d->nCh * 2);
+    d->gateFill = 0;
+    d->gateTone = false;
+    d->blockEnergy = 0.0;
+    d->gateRefresh = 0;
+}
+
+// Called once per gated hop. True if the block was loud enough (6 dB over the idle floor) or a tone was heard.
+bool GateWake(Decoder *d) {
+    double energy = d->blockEnergy;
+    d->blockEnergy = 0.0;
+    bool wake = d->gateTone || (d->energyFloor > 0.0 && energy > 4.0 * d->energyFloor + 1e-9);
+    if (!wake) d->energyFloor = d->energyFloor > 0.0 ? d->energyFloor * 0.95 + energy * 0.05 : energy;
+    return wake;
+}
+
+// Status line while idle, roughly every 150 ms
+void MonitorLine(Decoder *d) {
+    if (!d->showMonitor || ++d->uiThrottle < 15) return;
+    if (d->streamCount == 1) {
+        printf(" MONITORING: Noise: %5.2f | Threshold: %5.2f | Freq: %7.2f\r", d->receivers[0].lastMag, d->receivers[0].threshold, d->receivers[0].lastFreq);
+    } else {
+        printf(" MONITORING:");
+        for (int s = 0; s < d->streamCount; s++) printf(" [%d] %5.2f/%5.2f", s + 1, d->receivers[s].lastMag, d->receivers[s].threshold);
+        printf("\r");
+    }
+    d->uiThrottle = 0;
+}
+
+// True when every stream is mid-symbol on a tone it has already accepted, so the next hops can only repeat it
+bool AllLocked(const Decoder *d) {
+    for (int s = 0; s < d->streamCount; s++) {
+        const Receiver *rx = &d->receivers[s];
+        if (rx->state != STATE_READ_DATA || rx->stableCount < DEBOUNCE_LIMIT || rx->processedByte != rx->lastByte) return false;
+    }
+    return true;
+}
+
+// Once a second of audio: compare analysis time and backlog against the budget, step the load level up or down
+void CheckHeadroom(Decoder *d) {
+    double audioNs = d->audioFrames * 1e9 / d->sampleRate;
+    d->load = d->busyNs / audioNs;
+    d->busyNs = 0; d->audioFrames = 0;
+
+    int level = d->level;
+    if ((d->load > 0.8 || d->backlogMs > 200.0) && level < 2) { level++; d->calmSeconds = 0; }
+    else if (d->load < 0.4 && d->backlogMs < 50.0) { if (++d->calmSeconds >= 3 && level > 0) { level--; d->calmSeconds = 0; } }
+    else d->calmSeconds = 0;
+    if (level == d->level) return;
+
+    static const char *LEVEL_NAMES[3] = { "full rate", "idle hop x2", "idle hop x4, skipping locked hops" };
+    d->level = level;
+    d->adaptations++;
+    g_CurrentLabel = d->name;
+    RxLog("\n >> HEADROOM: load %.0f%% | backlog %.0f ms -> %s\n", d->load * 100.0, d->backlogMs, LEVEL_NAMES[level]);
+}
+
+// Feeds frames of audio, channel c of frame i at samples[i * stride + c]. Runs a hop every STEP_SIZE frames.
+void DecoderFeed(Decoder *d, const float *samples, uint32_t frames, int stride) {
+    int nCh = d->nCh;
+    STATS(d->stats.packets++);
+    if (d->adaptive && (d->audioFrames += frames) >= (uint32_t)d->sampleRate) CheckHeadroom(d);
+    for (uint32_t i = 0; i < frames; i++) {
+        for (int c = 0; c < nCh; c++) d->slidingBuffer[c * FFT_SIZE + d->writeIdx] = samples[i * stride + c]; // Left channel only unless Diversity is on
+        d->writeIdx = (d->writeIdx + 1) % FFT_SIZE; // Circular wrap around buffer
+        if (d->gated) GateSample(d, &samples[i * stride]);
+
+        // Audio analyzed every STEP_SIZE to manage CPU usage; under load, idle listening hops further (HELLO lasts 5 symbols)
+        int step = d->allIdle && d->level > 0 ? STEP_SIZE << d->level : STEP_SIZE;
+        if (++d->stepCounter < step) continue;
+        d->stepCounter = 0;
+        if (d->level == 2 && AllLocked(d) && (d->skipToggle = !d->skipToggle)) continue; // Same tone as last hop, nothing new
+        if (d->gated) {
+            if (GateWake(d)) { d->gated = false; d->gateHold = d->gateHops; STATS(d->stats.wakes++); }
+            else if (++d->gateRefresh < d->gateHops) { STATS(d->stats.gatedHops++); MonitorLine(d); continue; }
+            else d->gateRefresh = 0; // One full hop a second keeps the noise floor and threshold current
+        }
+        double hopStart = d->adaptive ? NowNs() : 0.0;
+        STATS(double t0 = NowNs(); double t1 = t0, t2);
+        if (nCh > 1) {
+            // Every channel hears the tone; combining them lifts it above noise that differs per mic
+            ChannelSpectra(d->plan, d->slidingBuffer, d->writeIdx, nCh, d->in, d->out, d->chMag);
+            STATS(t2 = NowNs());
+            CombineChannels(d->chMag, nCh, d->chNoise, d->chPeak, d->lastFrameQuiet, d->spectrum);
+        } else {
+            FillWindow(d->slidingBuffer, d->writeIdx, d->in);
+            STATS(t1 = NowNs());
+            // Converts mic position over time into signal strength over frequency
+            kiss_fft(d->plan, d->in, d->out);
+            STATS(t2 = NowNs());
+            MagnitudeSpectrum(d->out, d->spectrum);
+        }
+        STATS(double t3 = NowNs());
+
+        // One FFT per hop no matter how many streams: each picks the peak within its own band
+        bool allIdle = true;
+        d->lastFrameQuiet = true;
+        for (int s = 0; s < d->streamCount; s++) {
+            Receiver *rx = &d->receivers[s];
+            STATS(ProtocolState before = rx->state);
+            ReceiverStep(rx, d->spectrum);
+            STATS(if (rx->state != before) d->stats.transitions[before][rx->state]++);
+            if (rx->state != STATE_IDLE) allIdle = false;
+            if (rx->lastMag >= rx->threshold) d->lastFrameQuiet = false;
+        }
+        d->allIdle = allIdle;
+        if (!allIdle) d->gateHold = d->gateHops;
+        else if (d->gateHold > 0) d->gateHold--;
+        bool gate = IDLE_GATE && allIdle && d->gateHold == 0;
+        if (gate && !d->gated) GateReset(d);
+        d->gated = gate;
+        if (d->adaptive) d->busyNs += NowNs() - hopStart;
+#ifdef DECODER_STATS
+        double t4 = NowNs();
+        DecoderStats *st = &d->stats;
+        st->hops++;
+        if (t1 > t0) HistRecord(&st->timing[TIMING_FILL], t1 - t0); // Diversity fills inside ChannelSpectra
+        HistRecord(&st->timing[TIMING_FFT], t2 - t1);
+        HistRecord(&st->timing[TIMING_MAGNITUDE], t3 - t2);
+        HistRecord(&st->timing[TIMING_RECEIVERS], t4 - t3);
+        HistRecord(&st->timing[TIMING_HOP], t4 - t0);
+        if (t4 - t0 > st->budgetNs) st->deadlineMisses++;
+#endif
+
+        if (allIdle) MonitorLine(d);
+    }
+}
+
+// --- Audio Capture ---
+typedef struct {
+    IMMDeviceEnumerator *pEnum;
+    IMMDevice *pDev;
+    IAudioClient *pCl;
+    IAudioCaptureClient *pCap;
+    WAVEFORMATEX *pwfx;
+} Capture;
+
+bool OpenCapture(Capture *c) {
+    HRESULT hr = CoCreateInstance(&CLSID_MMDeviceEnumerator, NULL, CLSCTX_ALL, &IID_IMMDeviceEnumerator, (void **)&c->pEnum);
+    if (FAILED(hr)) return false;
+    hr = IMMDeviceEnumerator_GetDefaultAudioEndpoint(c->pEnum, eCapture, eConsole, &c->pDev);
+    if (FAILED(hr)) return false;
+    hr = IMMDevice_Activate(c->pDev, &IID_IAudioClient, CLSCTX_ALL, NULL, (void **)&c->pCl);
+    if (FAILED(hr)) return false;
+    hr = IAudioClient_GetMixFormat(c->pCl, &c->pwfx);
+    if (FAILED(hr)) return false;
+    hr = IAudioClient_Initialize(c->pCl, AUDCLNT_SHAREMODE_SHARED, 0, 10000000, 0, c->pwfx, NULL);
+    if (FAILED(hr)) return false;
+    hr = IAudioClient_GetService(c->pCl, &IID_IAudioCaptureClient, (void **)&c->pCap);
+    if (FAILED(hr)) return false;
+    hr = IAudioClient_Start(c->pCl);
     if (hr == AUDCLNT_E_DEVICE_INVALIDATED) {
         printf(RED_TEXT "ERROR: Audio device was unplugged or changed.\n" RESET_TEXT);
-        goto cleanup;
+        return false;
     } else if (FAILED(hr)) {
         printf(RED_TEXT "ERROR: Failed to start audio stream (0x%08lX)\n" RESET_TEXT, (long)hr);
-        goto cleanup;
+        return false;
     }
+    return true;
+}
+
+void CloseCapture(Capture *c) {
+    if (c->pCl) IAudioClient_Stop(c->pCl);
+    if (c->pCap) IAudioCaptureClient_Release(c->pCap);
+    if (c->pCl) IAudioClient_Release(c->pCl);
+    if (c->pDev) IMMDevice_Release(c->pDev);
+    if (c->pEnum) IMMDevice_Release(c->pEnum);
+    if (c->pwfx) CoTaskMemFree(c->pwfx);
+    memset(c, 0, sizeof(Capture));
+}
 
+// Captured audio the OS is holding for us, i.e. how far the decoder is behind real time
+double CaptureBacklogMs(const Capture *cap) {
+    UINT32 padding = 0;
+    if (FAILED(IAudioClient_GetCurrentPadding(cap->pCl, &padding))) return 0.0;
+    return padding * 1000.0 / cap->pwfx->nSamplesPerSec;
+}
+
+// Works out every stream's frequencies for this sample rate. False if the streams don't fit in the FFT.
+bool SetupBands(int sampleRate, BandPlan *bands) {
     // --- AUTO SPACING LOGIC ---
     // Calculates bin alignment to eliminate spectral leakage (smearing into adjacent bins)
-    BIN_WIDTH = (float)pwfx->nSamplesPerSec / FFT_SIZE;
+    BIN_WIDTH = (float)sampleRate / FFT_SIZE;
     if (AUTO_SPACING) {
-        BIN_SPACING = BIN_WIDTH * 2.0f;  
-        FREQ_HELLO = BIN_WIDTH * 26.0f;  
-        FREQ_HEADER = BIN_WIDTH * 36.0f; 
-        BASE_FREQ = BIN_WIDTH * 52.0f;   
-        FREQ_TERM = BIN_WIDTH * 588.0f;  
+        BIN_SPACING = BIN_WIDTH * 2.0f;
+        FREQ_HELLO = BIN_WIDTH * 26.0f;
+        FREQ_HEADER = BIN_WIDTH * 36.0f;
+        BASE_FREQ = BIN_WIDTH * 52.0f;
+        FREQ_TERM = BIN_WIDTH * 588.0f;
     }
 
-    PrintConfig(pwfx->nSamplesPerSec);
+    if (STREAMS < 1) STREAMS = 1;
+    if (STREAMS > MAX_STREAMS) STREAMS = MAX_STREAMS;
+    if (STREAMS == 1) {
+        bands[0] = (BandPlan){ BASE_FREQ, BIN_SPACING, FREQ_HELLO, FREQ_HEADER, FREQ_TERM, 1, FFT_SIZE / 2 };
+    } else if (!PlanBands(bands, STREAMS)) {
+        printf(RED_TEXT "ERROR: FFT_SIZE=%d has too few bins for %d streams. Raise FFT_SIZE.\n" RESET_TEXT, FFT_SIZE, STREAMS);
+        return false;
+    }
+    return true;
+}
 
-    // KissFFT Setup: https://github.com/mborgerding/kissfft
-    cfg = kiss_fft_alloc(FFT_SIZE, 0, NULL, NULL);
+// --- Daemon Mode ---
+#define MAX_INPUTS 64
+#define MAX_WORKERS 32
+#define PIPE_BUFFER (1 << 16)
+#define FILE_CHUNK_FRAMES 8192 // Spool files are read as fast as the workers keep up, this much per tick
 
-    // Allocate memory dynamically to prevent "transfer of control bypasses initialization" errors
-    in = malloc(sizeof(kiss_fft_cpx) * FFT_SIZE); // FFT input buffer
-    out = malloc(sizeof(kiss_fft_cpx) * FFT_SIZE); // FFT output buffer
-    slidingBuffer = calloc(FFT_SIZE, sizeof(float)); // Sliding window buffer for audio samples
-    fileBuffer = calloc(1, MAX_FILE_SIZE);
+typedef enum { INPUT_DEVICE, INPUT_FIFO, INPUT_SPOOL } InputKind;
 
-    if (!in || !out || !slidingBuffer || !fileBuffer) {
-        printf(RED_TEXT "ERROR: Memory allocation failed.\n" RESET_TEXT);
-        goto cleanup;
+/* One daemon input. Pipes and spool files carry a 16-bit PCM WAV stream (header first), e.g. transmit.wav or a
+   recording; device inputs are one channel each of the capture device. */
+typedef struct {
+    InputKind kind;
+    char path[MAX_PATH];
+    Decoder dec;
+    HANDLE pipe;            // INPUT_FIFO: server end of the named pipe
+    FILE *file;             // INPUT_SPOOL
+    uint8_t header[44];     // WAV header of the current pipe connection
+    int headerFill;
+    int channels;           // Interleaved channels in the stream
+    uint8_t *raw;           // Bytes read but not yet a whole frame
+    size_t rawFill;
+    float *chunk;           // This tick's samples for DecoderFeed
+    const float *feed;
+    uint32_t frames;
+    int stride;
+    bool finished;          // INPUT_SPOOL: end of file reached
+} Input;
+
+/* Fixed pool of DSP threads. Each tick the main thread hands over every input that has new audio and waits until all
+   of them are processed. An input is only ever in one job at a time, so its decoder needs no locking. */
+typedef struct {
+    HANDLE threads[MAX_WORKERS];
+    int count;
+    CRITICAL_SECTION lock;
+    CONDITION_VARIABLE wake, done;
+    Input **jobs;
+    int jobCount, nextJob, remaining;
+    bool stop;
+} WorkerPool;
+
+DWORD WINAPI WorkerMain(LPVOID arg) {
+    WorkerPool *pool = (WorkerPool *)arg;
+    EnterCriticalSection(&pool->lock);
+    while (true) {
+        while (!pool->stop && pool->nextJob >= pool->jobCount) SleepConditionVariableCS(&pool->wake, &pool->lock, INFINITE);
+        if (pool->stop) break;
+        Input *in = pool->jobs[pool->nextJob++];
+        LeaveCriticalSection(&pool->lock);
+        DecoderFeed(&in->dec, in->feed, in->frames, in->stride);
+        EnterCriticalSection(&pool->lock);
+        if (--pool->remaining == 0) WakeConditionVariable(&pool->done);
+    }
+    LeaveCriticalSection(&pool->lock);
+    return 0;
+}
+
+void PoolStart(WorkerPool *pool, int count) {
+    memset(pool, 0, sizeof(WorkerPool));
+    InitializeCriticalSection(&pool->lock);
+    InitializeConditionVariable(&pool->wake);
+    InitializeConditionVariable(&pool->done);
+    if (count > MAX_WORKERS) count = MAX_WORKERS;
+    for (int i = 0; i < count; i++) {
+        pool->threads[pool->count] = CreateThread(NULL, 0, WorkerMain, pool, 0, NULL);
+        if (pool->threads[pool->count]) pool->count++;
+    }
+}
+
+// Processes every job and returns once all are done. With no worker threads the main thread does the work.
+void PoolRun(WorkerPool *pool, Input **jobs, int jobCount) {
+    if (jobCount == 0) return;
+    if (pool->count == 0) {
+        for (int i = 0; i < jobCount; i++) DecoderFeed(&jobs[i]->dec, jobs[i]->feed, jobs[i]->frames, jobs[i]->stride);
+        return;
     }
+    EnterCriticalSection(&pool->lock);
+    pool->jobs = jobs; pool->jobCount = jobCount; pool->nextJob = 0; pool->remaining = jobCount;
+    WakeAllConditionVariable(&pool->wake);
+    while (pool->remaining > 0) SleepConditionVariableCS(&pool->done, &pool->lock, INFINITE);
+    pool->jobCount = 0;
+    LeaveCriticalSection(&pool->lock);
+}
+
+void PoolStop(WorkerPool *pool) {
+    EnterCriticalSection(&pool->lock);
+    pool->stop = true;
+    WakeAllConditionVariable(&pool->wake);
+    LeaveCriticalSection(&pool->lock);
+    for (int i = 0; i < pool->count; i++) { WaitForSingleObject(pool->threads[i], INFINITE); CloseHandle(pool->threads[i]); }
+    DeleteCriticalSection(&pool->lock);
+}
+
+void FreeInput(Input *in) {
+    DecoderFree(&in->dec);
+    if (in->pipe && in->pipe != INVALID_HANDLE_VALUE) CloseHandle(in->pipe);
+    if (in->file) fclose(in->file);
+    if (in->raw) free(in->raw);
+    if (in->chunk) free(in->chunk);
+    free(in);
+}
 
+Input *NewInput(InputKind kind, const char *path, const BandPlan *bands, int sampleRate) {
+    Input *in = CountedCalloc(1, sizeof(Input));
+    if (!in) return NULL;
+    in->kind = kind;
+    snprintf(in->path, sizeof(in->path), "%s", path);
+    if (kind != INPUT_DEVICE) {
+        in->raw = CountedMalloc(PIPE_BUFFER);
+        in->chunk = CountedMalloc(PIPE_BUFFER / 2 * sizeof(float));
+    }
+    if (!DecoderInit(&in->dec, path, 1, bands, STREAMS, sampleRate, false) || (kind != INPUT_DEVICE && (!in->raw || !in->chunk))) {
+        printf(RED_TEXT "ERROR: Memory allocation failed for %s.\n" RESET_TEXT, path);
+        FreeInput(in);
+        return NULL;
+    }
+    in->dec.adaptive = ADAPTIVE_HOP && kind != INPUT_SPOOL; // Spool files have no deadline
+    return in;
+}
+
+// Checks a 16-bit PCM WAV header against the daemon's sample rate. Returns the channel count, or 0 if unusable.
+int ParseWavHeader(const uint8_t *h, const char *name, int sampleRate) {
+    int channels = h[22] | (h[23] << 8);
+    int rate = h[24] | (h[25] << 8) | (h[26] << 16) | (h[27] << 24);
+    int bits = h[34] | (h[35] << 8);
+    if (memcmp(h, "RIFF", 4) != 0 || memcmp(h + 8, "WAVE", 4) != 0 || bits != 16 || channels < 1) {
+        printf(RED_TEXT "\n [ERROR] %s: not a 16-bit PCM WAV stream.\n" RESET_TEXT, name);
+        return 0;
+    }
+    if (rate != sampleRate) {
+        printf(RED_TEXT "\n [ERROR] %s: %d Hz, but this daemon runs at %d Hz.\n" RESET_TEXT, name, rate, sampleRate);
+        return 0;
+    }
+    return channels;
+}
+
+// Turns whole frames of in->raw into floats for this tick and keeps any partial frame for next time.
+void ConvertRaw(Input *in) {
+    size_t frameBytes = (size_t)in->channels * 2;
+    uint32_t frames = (uint32_t)(in->rawFill / frameBytes);
+    for (size_t i = 0; i < (size_t)frames * in->channels; i++) {
+        int16_t v;
+        memcpy(&v, in->raw + i * 2, 2);
+        in->chunk[i] = v / 32768.0f;
+    }
+    size_t used = (size_t)frames * frameBytes;
+    memmove(in->raw, in->raw + used, in->rawFill - used);
+    in->rawFill -= used;
+    in->feed = in->chunk; in->frames = frames; in->stride = in->channels;
+}
+
+// Non-blocking read of whatever a pipe client has written. A disconnect ends that stream and listens for the next.
+bool ReadFifo(Input *in, int sampleRate) {
+    if (!ConnectNamedPipe(in->pipe, NULL) && GetLastError() != ERROR_PIPE_CONNECTED) return false; // No client yet
+    DWORD got = 0;
+    uint8_t *dst = in->headerFill < 44 ? in->header + in->headerFill : in->raw + in->rawFill;
+    DWORD want = in->headerFill < 44 ? (DWORD)(44 - in->headerFill) : (DWORD)(PIPE_BUFFER - in->rawFill);
+    if (!ReadFile(in->pipe, dst, want, &got, NULL)) {
+        if (GetLastError() == ERROR_BROKEN_PIPE) { // Writer finished: reset for the next connection
+            DisconnectNamedPipe(in->pipe);
+            in->headerFill = 0; in->rawFill = 0; in->channels = 0;
+        }
+        return false;
+    }
+    if (in->headerFill < 44) {
+        in->headerFill += got;
+        if (in->headerFill == 44 && (in->channels = ParseWavHeader(in->header, in->path, sampleRate)) == 0) {
+            DisconnectNamedPipe(in->pipe);
+            in->headerFill = 0;
+        }
+        return false;
+    }
+    in->rawFill += got;
+    ConvertRaw(in);
+    return in->frames > 0;
+}
+
+bool ReadSpool(Input *in) {
+    size_t want = (size_t)FILE_CHUNK_FRAMES * in->channels * 2;
+    if (want > PIPE_BUFFER - in->rawFill) want = PIPE_BUFFER - in->rawFill;
+    size_t got = fread(in->raw + in->rawFill, 1, want, in->file);
+    if (got == 0) { in->finished = true; return false; }
+    in->rawFill += got;
+    ConvertRaw(in);
+    return in->frames > 0;
+}
 
-    memset(&header, 0, sizeof(ChordHeader)); //Makes sure no data is left from previous runs, prevents dirty memory issues in header struct.
+bool IsOpenSpool(Input **inputs, int count, const char *path) {
+    for (int i = 0; i < count; i++) if (inputs[i]->kind == INPUT_SPOOL && strcmp(inputs[i]->path, path) == 0) return true;
+    return false;
+}
+
+// Opens any new .wav files in the spool folder. Drop finished recordings in (write elsewhere, then move them in).
+void ScanSpool(Input **inputs, int *count, const BandPlan *bands, int sampleRate) {
+    char pattern[MAX_PATH + 8];
+    WIN32_FIND_DATAA fd;
+    snprintf(pattern, sizeof(pattern), "%s\\*.wav", SPOOL_DIR);
+    HANDLE h = FindFirstFileA(pattern, &fd);
+    if (h == INVALID_HANDLE_VALUE) return;
+    do {
+        char path[2 * MAX_PATH];
+        if (fd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) continue;
+        snprintf(path, sizeof(path), "%s\\%s", SPOOL_DIR, fd.cFileName);
+        if (*count >= MAX_INPUTS || IsOpenSpool(inputs, *count, path)) continue;
+
+        FILE *f = fopen(path, "rb");
+        uint8_t header[44];
+        int channels = f && fread(header, 1, 44, f) == 44 ? ParseWavHeader(header, path, sampleRate) : 0;
+        Input *in = channels ? NewInput(INPUT_SPOOL, path, bands, sampleRate) : NULL;
+        if (!in) { // Unusable: move it aside so it isn't retried every scan
+            if (f) fclose(f);
+            char failed[2 * MAX_PATH + 8];
+            snprintf(failed, sizeof(failed), "%s.bad", path);
+            MoveFileExA(path, failed, MOVEFILE_REPLACE_EXISTING);
+            continue;
+        }
+        in->file = f;
+        in->channels = channels;
+        inputs[(*count)++] = in;
+        printf("\n >> SPOOL: decoding %s\n", path);
+    } while (FindNextFileA(h, &fd));
+    FindClose(h);
+}
+
+// Finished spool files go to <SpoolDir>\done so they are not decoded twice.
+void RetireSpool(Input *in) {
+    char doneDir[MAX_PATH + 8], donePath[2 * MAX_PATH];
+    const char *base = strrchr(in->path, '\\');
+    snprintf(doneDir, sizeof(doneDir), "%s\\done", SPOOL_DIR);
+    CreateDirectoryA(doneDir, NULL);
+    snprintf(donePath, sizeof(donePath), "%s%s", doneDir, base ? base : "\\input.wav");
+    fclose(in->file); in->file = NULL;
+    if (!MoveFileExA(in->path, donePath, MOVEFILE_REPLACE_EXISTING)) remove(in->path);
+    printf("\n >> SPOOL: finished %s\n", in->path);
+}
+
+/* Services every configured input in one process: one Decoder per input, DSP on the worker pool, one shared FFT plan.
+   Runs until Ctrl+C. */
+int RunDaemon(void) {
+    Capture cap;
+    memset(&cap, 0, sizeof(Capture));
+    BandPlan bands[MAX_STREAMS];
+    Input *inputs[MAX_INPUTS];
+    Input *jobs[MAX_INPUTS];
+    int inputCount = 0, deviceInputs = 0;
+    int sampleRate = SAMPLE_RATE;
+    WorkerPool pool;
+    bool poolStarted = false;
+
+    if (DAEMON_DEVICE) {
+        if (OpenCapture(&cap)) sampleRate = cap.pwfx->nSamplesPerSec;
+        else { printf(RED_TEXT "ERROR: No capture device. Continuing with pipes and spool folder only.\n" RESET_TEXT); CloseCapture(&cap); }
+    }
+    if (!SetupBands(sampleRate, bands)) goto cleanup;
+    PrintConfig(sampleRate, bands, STREAMS);
+
+    if (cap.pCap) {
+        for (int c = 0; c < cap.pwfx->nChannels && inputCount < MAX_INPUTS; c++) {
+            char name[32];
+            snprintf(name, sizeof(name), "Device ch%d", c + 1);
+            if ((inputs[inputCount] = NewInput(INPUT_DEVICE, name, bands, sampleRate)) != NULL) inputCount++;
+        }
+        deviceInputs = inputCount;
+    }
+    char fifoList[sizeof(FIFOS)];
+    snprintf(fifoList, sizeof(fifoList), "%s", FIFOS);
+    for (char *tok = strtok(fifoList, ","); tok && inputCount < MAX_INPUTS; tok = strtok(NULL, ",")) {
+        HANDLE pipe = CreateNamedPipeA(tok, PIPE_ACCESS_INBOUND, PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_NOWAIT, 1, 0, PIPE_BUFFER, 0, NULL);
+        if (pipe == INVALID_HANDLE_VALUE) { printf(RED_TEXT "ERROR: Cannot create pipe %s\n" RESET_TEXT, tok); continue; }
+        Input *in = NewInput(INPUT_FIFO, tok, bands, sampleRate);
+        if (!in) { CloseHandle(pipe); continue; }
+        in->pipe = pipe;
+        inputs[inputCount++] = in;
+    }
+
+    InitializeCriticalSection(&g_LogLock);
+    g_LogLockReady = true;
+    PoolStart(&pool, WORKERS);
+    poolStarted = true;
+    printf("DAEMON: %d device channel(s), %d pipe(s), spool folder: %s | %d worker(s)\n\n",
+           deviceInputs, inputCount - deviceInputs, SPOOL_DIR[0] ? SPOOL_DIR : "(none)", pool.count);
+
+    DWORD lastScan = 0;
+    STATS(DWORD lastDump = 0);
     while (g_Running) {
+        bool busy = false;
+
+        // All channels of a device packet are decoded in parallel, straight out of the capture buffer
         UINT32 pSize = 0;
-        IAudioCaptureClient_GetNextPacketSize(pCap, &pSize); // Get size of next packet
+        if (cap.pCap) IAudioCaptureClient_GetNextPacketSize(cap.pCap, &pSize);
         if (pSize > 0) {
             BYTE *pData; UINT32 nRead; DWORD flags;
-            IAudioCaptureClient_GetBuffer(pCap, &pData, &nRead, &flags, NULL, NULL);
-            float *samples = (float *)pData; // Stores from pData in float format (32bit float stereo)
-
-            for (UINT32 i = 0; i < nRead; i++) {
-                static int writeIdx = 0;
-                slidingBuffer[writeIdx] = samples[i * pwfx->nChannels]; // Take left channel only (mono)
-                writeIdx = (writeIdx + 1) % FFT_SIZE; // Circular wrap around buffer
-
-                static int stepCounter = 0;
-                if (++stepCounter >= STEP_SIZE) { // Audio analyzed every STEP_SIZE to manage CPU usage
-                    stepCounter = 0;
-                    for (int j = 0; j < FFT_SIZE; j++) {
-                        // HANNING REMOVED: Direct assignment of raw signal
-                        in[j].r = slidingBuffer[(writeIdx + j) % FFT_SIZE]; 
-                        in[j].i = 0.0f; // Imaginary part 0 for single stream analysis
-                    }
-                    
-                    // Converts mic position over time into signal strength over frequency
-                    kiss_fft(cfg, in, out);
-
-                    float maxM = 0; int maxI = 0;
-                    for (int k = 1; k < FFT_SIZE / 2; k++) {
-                        // We only scan the first half because the second is mirrored (Nyquist Theorem)
-                        float m = sqrtf(out[k].r * out[k].r + out[k].i * out[k].i);
-                        if (m > maxM) { maxM = m; maxI = k; }
-                    }
+            IAudioCaptureClient_GetBuffer(cap.pCap, &pData, &nRead, &flags, NULL, NULL);
+            double backlogMs = CaptureBacklogMs(&cap);
+            for (int i = 0; i < deviceInputs; i++) {
+                inputs[i]->dec.backlogMs = backlogMs;
+                inputs[i]->feed = (float *)pData + i;
+                inputs[i]->frames = nRead;
+                inputs[i]->stride = cap.pwfx->nChannels;
+                STATS(if (flags & AUDCLNT_BUFFERFLAGS_DATA_DISCONTINUITY) inputs[i]->dec.stats.overruns++);
+            }
+            PoolRun(&pool, inputs, deviceInputs);
+            IAudioCaptureClient_ReleaseBuffer(cap.pCap, nRead); // Release buffer to OS
+            busy = true;
+        }
 
-                    // Scaled for Rectangular Window (Raw)
-                    maxM *= 2.0f; 
-
-                    float freq = maxI * BIN_WIDTH;
-                    int curByte = -1;
-
-                    // --- ADAPTIVE THRESHOLD LOGIC ---
-                    if (state == STATE_IDLE) {
-                        // Low pass filter to create a rolling average of the noise floor
-                        smoothedNoise = (smoothedNoise * 0.95f) + (maxM * 0.05f);
-                        
-                        if (AUTO_THRESHOLD) {
-                            // Require signal to be 3x the noise floor
-                            THRESHOLD = smoothedNoise * 3.0f;
-                            // Clamp to a safe minimum to prevent hardware hiss triggering
-                            if (THRESHOLD < 2.0f) THRESHOLD = 2.0f;
-                        }
-                    }
-                    
-                    if (maxM > THRESHOLD) {
-                        float rawIdx = (freq - BASE_FREQ) / BIN_SPACING;
-                        curByte = (int)(rawIdx + 0.5f); // Round to nearest integer to prevent smearing
-                    }
+        int jobCount = 0;
+        for (int i = deviceInputs; i < inputCount; i++) {
+            Input *in = inputs[i];
+            if (in->kind == INPUT_FIFO ? ReadFifo(in, sampleRate) : ReadSpool(in)) jobs[jobCount++] = in;
+        }
+        PoolRun(&pool, jobs, jobCount);
+        if (jobCount > 0) busy = true;
 
-                    // --- UI THROTTLING LOGIC ---
-                    static int uiThrottle = 0;
-                    if (++uiThrottle >= 15) { // Only update UI approx every 150ms
-                        if (state == STATE_IDLE) {
-                            printf(" MONITORING: Noise: %5.2f | Threshold: %5.2f | Freq: %7.2f\r", maxM, THRESHOLD, freq);                        }
-                        uiThrottle = 0;
-                    }
+        for (int i = deviceInputs; i < inputCount; i++) {
+            if (!inputs[i]->finished) continue;
+            RetireSpool(inputs[i]);
+            FreeInput(inputs[i]);
+            inputs[i--] = inputs[--inputCount];
+        }
+        if (SPOOL_DIR[0] && GetTickCount() - lastScan >= 1000) {
+            ScanSpool(inputs, &inputCount, bands, sampleRate);
+            lastScan = GetTickCount();
+        }
+#ifdef DECODER_STATS
+        if (GetTickCount() - lastDump >= (DWORD)(STATS_INTERVAL * 1000)) {
+            DecoderStats *all[MAX_INPUTS];
+            for (int i = 0; i < inputCount; i++) all[i] = &inputs[i]->dec.stats;
+            WriteStats(all, inputCount, sampleRate);
+            lastDump = GetTickCount();
+        }
+#endif
+        if (!busy) Sleep(5); // No data, rest CPU
+    }
+#ifdef DECODER_STATS
+    DecoderStats *all[MAX_INPUTS] = { NULL };
+    for (int i = 0; i < inputCount; i++) all[i] = &inputs[i]->dec.stats;
+    WriteStats(all, inputCount, sampleRate);
+#endif
 
-                    // 1. TERMINATION
-                    if (state == STATE_READ_DATA && maxM > (THRESHOLD * 0.7f) && fabs(freq - FREQ_TERM) < (BIN_WIDTH * 2.5f)) {
-                        printf("\n >> TERMINATION DETECTED.");
-                        if (headerDone) {
-                            /* Calculate checksum to check for dropped/corrupted packets */
-                            uint8_t calcSum = 0;
-                            uint32_t dataStartOffset = sizeof(ChordHeader);
-                            
-                            // Only sum up to what we actually received to prevent reading garbage memory
-                            for (uint32_t j = 0; j < header.fileSize && (dataStartOffset + j) < bufPtr; j++)
-                                calcSum += fileBuffer[dataStartOffset + j];
-
-                            uint32_t expectedTotalBytes = sizeof(ChordHeader) + header.fileSize;
-
-                            if (bufPtr < expectedTotalBytes) {
-                                printf(RED_TEXT "\n [ERROR] Transmission Failed: Incomplete Data\n");
-                                printf("         Expected: %u bytes | Received: %u bytes\n", expectedTotalBytes, bufPtr);
-                                printf("         >> ADVICE: Signal lost. Increase sound volume or refer to README to fix dropping bytes.\n" RESET_TEXT);
-                            }
-                            else if (calcSum != header.checksum) {
-                                printf(RED_TEXT "\n [ERROR] Transmission Failed: Checksum Mismatch (Recv: %d, Calc: %d)\n", header.checksum, calcSum);
-                                printf("         >> ADVICE: Data corrupted. Reduce background noise or volume (to prevent clipping).\n" RESET_TEXT);
-                            } 
-                            else {
-                                FILE *f = fopen(header.fileName, "wb");
-                                if (f) { 
-                                    fwrite(fileBuffer + sizeof(ChordHeader), 1, header.fileSize, f); 
-                                    fclose(f); 
-                                    printf("\n [SUCCESS] Saved: %s\n", header.fileName);
-                                } else {
-                                    printf(RED_TEXT "\n [ERROR] Write permission denied. Cannot save file.\n" RESET_TEXT);
-                                }
-                            }
-                        }
-                        state = STATE_IDLE; processedByte = -1; stableCount = 0; continue;
-                    }
+cleanup:
+    if (poolStarted) PoolStop(&pool);
+    for (int i = 0; i < inputCount; i++) FreeInput(inputs[i]);
+    CloseCapture(&cap);
+    if (g_LogLockReady) { g_LogLockReady = false; DeleteCriticalSection(&g_LogLock); }
+    return 0;
+}
 
-                    // 2. STABILITY
-                    static int dropCount = 0;
-                    if (maxM < THRESHOLD) {
-                        if (++dropCount >= 6) { processedByte = -1; stableCount = 0; }
-                    } else {
-                        dropCount = 0; // Signal back, reset drop timer
-                        if (curByte != lastByte) { stableCount = 0; lastByte = curByte; }
-                        else { stableCount++; }
-                    }
+// Seconds of CPU (user + kernel) this process has used so far
+double ProcessCpuSeconds(void) {
+    FILETIME created, exited, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) return 0.0;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime; k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime; u.HighPart = user.dwHighDateTime;
+    return (double)(k.QuadPart + u.QuadPart) * 1e-7; // FILETIME counts 100 ns ticks
+}
 
-                    // 3. STATE MACHINE, ensures proper sequencing of hello, header, data, and termination signals. Also handles byte processing and debouncing.
-                    if (maxM > THRESHOLD) {
-                        if (state == STATE_IDLE) {
-                            if (fabs(freq - FREQ_HELLO) < (BIN_WIDTH * 1.5f)) {
-                                state = STATE_WAIT_HEADER;
-                                printf("\n >> HANDSHAKE (Mag: %.2f)", maxM);
-                            }
-                        } else if (state == STATE_WAIT_HEADER) {
-                            if (fabs(freq - FREQ_HEADER) < (BIN_WIDTH * 1.5f)) {
-                                state = STATE_READ_DATA;
-                                bufPtr = 0; headerDone = false; processedByte = -1;
-                                printf("\n >> SYNC LOCKED. Receiving Data...\n");
-                            }
-                        } else if (state == STATE_READ_DATA) {
-                            if (stableCount >= DEBOUNCE_LIMIT && curByte != processedByte) {
-                                processedByte = curByte; // Lock this frequency
-                                int byteToProcess = (curByte == REPEAT_IDX) ? lastValidByte : curByte;
-                                if (curByte >= 0 && curByte <= 255) lastValidByte = curByte;
-
-                                if (bufPtr == 0 && (uint8_t)byteToProcess != SYNC_MARKER) continue;
-
-                                if (bufPtr < MAX_FILE_SIZE && byteToProcess >= -1) { //Simply logic to check for valid byte range and prevent overflow
-                                    fileBuffer[bufPtr++] = (unsigned char)byteToProcess;
-                                    if (VERBOSE_MODE) printf("[%02X]", (unsigned char)byteToProcess);
-
-                                    if (!headerDone && bufPtr == sizeof(ChordHeader)) {
-                                        memcpy(&header, fileBuffer, sizeof(ChordHeader));
-                                        if (header.syncMarker != SYNC_MARKER) {
-                                            printf(RED_TEXT "\n [ERROR] Sync Marker Fail (0x%02X). Resetting...\n" RESET_TEXT, header.syncMarker);
-                                            bufPtr = 0;
-                                        } else {
-                                            headerDone = true;
-                                            printf("\n >> FILENAME: %s | SIZE: %u bytes\n", header.fileName, header.fileSize);
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+/* Decodes a recorded 16-bit PCM WAV as fast as the CPU allows instead of listening to the device, then prints one
+   OFFLINE line with the decode cost. This is what bench/ drives; it also makes any recording reproducible. */
+int DecodeFile(const char *path) {
+    Decoder dec;
+    BandPlan bands[MAX_STREAMS];
+    uint8_t header[44];
+    int16_t *raw = NULL;
+    float *samples = NULL;
+    uint64_t totalFrames = 0;
+    int channels = 0, rate = 0, nCh = 1;
+    memset(&dec, 0, sizeof(Decoder));
+
+    FILE *f = fopen(path, "rb");
+    if (!f || fread(header, 1, 44, f) != 44) {
+        printf(RED_TEXT "ERROR: Cannot read %s\n" RESET_TEXT, path);
+        goto cleanup;
+    }
+    rate = header[24] | (header[25] << 8) | (header[26] << 16) | (header[27] << 24);
+    if ((channels = ParseWavHeader(header, path, rate)) == 0 || !SetupBands(rate, bands)) goto cleanup;
+    PrintConfig(rate, bands, STREAMS);
+
+    if (DIVERSITY) nCh = channels < MAX_DIVERSITY_CHANNELS ? channels : MAX_DIVERSITY_CHANNELS;
+    raw = CountedMalloc((size_t)FILE_CHUNK_FRAMES * channels * sizeof(int16_t));
+    samples = CountedMalloc((size_t)FILE_CHUNK_FRAMES * channels * sizeof(float));
+    if (!raw || !samples || !DecoderInit(&dec, "", nCh, bands, STREAMS, rate, false)) {
+        printf(RED_TEXT "ERROR: Memory allocation failed.\n" RESET_TEXT);
+        goto cleanup;
+    }
+    g_KeepPartial = true;
+
+    double cpuStart = ProcessCpuSeconds();
+    size_t frames;
+    while (g_Running && (frames = fread(raw, (size_t)channels * sizeof(int16_t), FILE_CHUNK_FRAMES, f)) > 0) {
+        for (size_t i = 0; i < frames * channels; i++) samples[i] = raw[i] / 32768.0f;
+        DecoderFeed(&dec, samples, (uint32_t)frames, channels);
+        totalFrames += frames;
+    }
+    double cpu = ProcessCpuSeconds() - cpuStart;
+    double audio = (double)totalFrames / rate;
+    printf("\nOFFLINE: %.3f s of audio | %.3f s CPU | %.5f CPU s per audio s\n", audio, cpu, audio > 0 ? cpu / audio : 0.0);
+    STATS(DecoderStats *one = &dec.stats; WriteStats(&one, 1, rate));
+
+cleanup:
+    if (f) fclose(f);
+    if (raw) free(raw);
+    if (samples) free(samples);
+    DecoderFree(&dec);
+    return 0;
+}
+
+// --- Soak Test ---
+/* decoder.exe --soak transmit.wav [minutes] plays the recording in a loop (each pass followed by 2 s of faint noise)
+   into an adaptive decoder at exactly real time, with SoakLoadThreads busy threads fighting it for the CPU. Audio that
+   waits more than a second is dropped, as a full WASAPI buffer would. PASS means every pass was saved and no audio
+   was lost, and that nothing was allocated after the first pass: every later pass reuses what the first one sized.
+   "Allocated" is what CountedMalloc and kissfft's counter see; the .part file each pass opens is reported apart. */
+#define SOAK_CHUNK_FRAMES 480 // 10 ms at 48 kHz, a typical WASAPI packet
+#define SOAK_GAP_SECONDS 2
+
+volatile bool g_SoakLoadRunning = false;
+
+DWORD WINAPI SoakLoadMain(LPVOID arg) {
+    (void)arg;
+    volatile double x = 1.0;
+    while (g_SoakLoadRunning) x = x * 1.0000001 + 1e-9;
+    return 0;
+}
+
+int RunSoak(const char *path, double minutes) {
+    Decoder dec;
+    BandPlan bands[MAX_STREAMS];
+    HANDLE load[MAX_WORKERS];
+    uint8_t header[44];
+    int16_t *raw = NULL;
+    float *chunk = NULL;
+    int loadCount = 0, channels = 0, rate = 0, nCh = 1, exitCode = 1;
+    memset(&dec, 0, sizeof(Decoder));
+
+    FILE *f = fopen(path, "rb");
+    if (!f || fread(header, 1, 44, f) != 44) {
+        printf(RED_TEXT "ERROR: Cannot read %s\n" RESET_TEXT, path);
+        goto cleanup;
+    }
+    rate = header[24] | (header[25] << 8) | (header[26] << 16) | (header[27] << 24);
+    if ((channels = ParseWavHeader(header, path, rate)) == 0 || !SetupBands(rate, bands)) goto cleanup;
+    fseek(f, 0, SEEK_END);
+    uint64_t wavFrames = (uint64_t)(ftell(f) - 44) / (channels * sizeof(int16_t));
+    fseek(f, 44, SEEK_SET);
+    raw = CountedMalloc(wavFrames * channels * sizeof(int16_t));
+    chunk = CountedMalloc((size_t)SOAK_CHUNK_FRAMES * channels * sizeof(float));
+    if (DIVERSITY) nCh = channels < MAX_DIVERSITY_CHANNELS ? channels : MAX_DIVERSITY_CHANNELS;
+    if (!raw || !chunk || !DecoderInit(&dec, "soak", nCh, bands, STREAMS, rate, false)) {
+        printf(RED_TEXT "ERROR: Memory allocation failed.\n" RESET_TEXT);
+        goto cleanup;
+    }
+    if (fread(raw, channels * sizeof(int16_t), wavFrames, f) != wavFrames || wavFrames == 0) {
+        printf(RED_TEXT "ERROR: Cannot read %s\n" RESET_TEXT, path);
+        goto cleanup;
+    }
+    dec.adaptive = ADAPTIVE_HOP;
+    VERBOSE_MODE = false; // Hours of byte-by-byte output would cost more than the decoding
+
+    uint64_t loopFrames = wavFrames + (uint64_t)SOAK_GAP_SECONDS * rate;
+    uint64_t loops = (uint64_t)ceil(minutes * 60.0 * rate / loopFrames);
+    if (loops < 1) loops = 1;
+    uint64_t endFrame = loops * loopFrames; // Always finish the pass in progress
+    printf("SOAK: %s x %llu pass(es), %.1f min at real time, %d load thread(s)\n\n", path, (unsigned long long)loops,
+           endFrame / (double)rate / 60.0, SOAK_LOAD_THREADS);
+
+    g_SoakLoadRunning = true;
+    for (int i = 0; i < SOAK_LOAD_THREADS && loadCount < MAX_WORKERS; i++)
+        if ((load[loadCount] = CreateThread(NULL, 0, SoakLoadMain, NULL, 0, NULL)) != NULL) loadCount++;
+
+    uint64_t pos = 0, lost = 0;
+    uint32_t overruns = 0, noise = 12345;
+    long heapAfterFirst = -1, kissAfterFirst = 0; // g_HeapCalls and KissAllocs() once the first pass is through
+    LONG opensAfterFirst = 0;
+    double maxBacklogMs = 0.0, startNs = NowNs();
+    while (g_Running && pos < endFrame) {
+        uint64_t produced = (uint64_t)((NowNs() - startNs) * 1e-9 * rate);
+        if (produced > endFrame) produced = endFrame;
+        uint64_t backlog = produced - pos;
+        if (backlog > (uint64_t)rate) { // Capture buffer full: the oldest audio is gone
+            lost += backlog - rate;
+            pos += backlog - rate;
+            backlog = rate;
+            overruns++;
+        }
+        if (backlog < SOAK_CHUNK_FRAMES && produced < endFrame) { Sleep(1); continue; }
+
+        uint32_t frames = backlog < SOAK_CHUNK_FRAMES ? (uint32_t)backlog : SOAK_CHUNK_FRAMES;
+        for (uint32_t i = 0; i < frames; i++) {
+            uint64_t at = (pos + i) % loopFrames;
+            for (int c = 0; c < channels; c++) {
+                noise = noise * 1664525u + 1013904223u;
+                float hiss = ((int32_t)noise >> 8) * (1e-3f / 8388608.0f);
+                chunk[i * channels + c] = at < wavFrames ? raw[at * channels + c] / 32768.0f : hiss;
             }
-            IAudioCaptureClient_ReleaseBuffer(pCap, nRead); // Release buffer to OS
-        } else Sleep(1); // No data, rest CPU
+        }
+        dec.backlogMs = backlog * 1000.0 / rate;
+        if (dec.backlogMs > maxBacklogMs) maxBacklogMs = dec.backlogMs;
+        DecoderFeed(&dec, chunk, frames, channels);
+        pos += frames;
+        if (heapAfterFirst < 0 && pos >= loopFrames) {
+            heapAfterFirst = g_HeapCalls; kissAfterFirst = KissAllocs(); opensAfterFirst = g_PartOpens;
+        }
     }
 
+    g_SoakLoadRunning = false;
+    for (int i = 0; i < loadCount; i++) { WaitForSingleObject(load[i], INFINITE); CloseHandle(load[i]); }
+
+    uint32_t saved = 0, failed = 0;
+    for (int s = 0; s < dec.streamCount; s++) { saved += dec.receivers[s].saved; failed += dec.receivers[s].failed; }
+    uint64_t expected = loops * dec.streamCount;
+    long kissCalls = heapAfterFirst < 0 ? 0 : KissAllocs() - kissAfterFirst;
+    long heapCalls = heapAfterFirst < 0 ? 0 : g_HeapCalls - heapAfterFirst + kissCalls;
+    long partOpens = heapAfterFirst < 0 ? 0 : g_PartOpens - opensAfterFirst;
+    bool pass = g_Running && saved == expected && lost == 0 && heapCalls == 0;
+    printf("\nSOAK: %llu/%llu saved | %u failed | %llu frames lost in %u overrun(s) | max backlog %.0f ms | "
+           "%d adaptation(s), last load %.0f%% | %ld allocation(s) after the first pass, %ld in kissfft | "
+           "%ld .part open(s), not counted\n", (unsigned long long)saved, (unsigned long long)expected, failed,
+           (unsigned long long)lost, overruns, maxBacklogMs, dec.adaptations, dec.load * 100.0, heapCalls, kissCalls,
+           partOpens);
+#ifndef KISS_FFT_COUNT_ALLOCS
+    printf("SOAK: kissfft allocations are not counted in this build (compile with -DKISS_FFT_COUNT_ALLOCS)\n");
+#endif
+    printf(pass ? "SOAK: PASS\n" : RED_TEXT "SOAK: FAIL\n" RESET_TEXT);
+    exitCode = pass ? 0 : 1;
+
 cleanup:
-    if (pCl) IAudioClient_Stop(pCl);
-    if (pCap) IAudioCaptureClient_Release(pCap);
-    if (pCl) IAudioClient_Release(pCl);
-    if (pDev) IMMDevice_Release(pDev);
-    if (pEnum) IMMDevice_Release(pEnum);
-    if (pwfx) CoTaskMemFree(pwfx);
-    
-    // Free the dynamic memory we allocated
+    if (f) fclose(f);
+    if (raw) free(raw);
+    if (chunk) free(chunk);
+    DecoderFree(&dec);
+    return exitCode;
+}
+
+// --- Hot Path Benchmark ---
+/* decoder.exe --bench [baseline.json] times each stage of the per-hop loop on a synthetic transmission, for every
+   BenchFftSizes x BenchStepSizes combination, and writes the results as JSON. Given a baseline it fails (exit code 1)
+   when a stage's median is more than BenchTolerance percent slower. Single stream, single channel. */
+#define BENCH_BATCH 64    // Hops timed together; one timer read per hop is too coarse for the small stages
+#define BENCH_BATCHES 200 // Samples per stage for the percentiles
+#define BENCH_WARMUP 8    // Batches run before timing starts
+#define MAX_BENCH_SIZES 8
+
+enum { STAGE_FILL, STAGE_FFT, STAGE_MAGNITUDE, STAGE_PEAK, STAGE_THRESHOLD, STAGE_STATE, STAGE_COUNT };
+const char *STAGE_NAMES[STAGE_COUNT] = { "fill", "fft", "magnitude", "peak", "threshold", "state" };
+
+typedef struct {
+    int fftSize, stepSize;
+    double p50[STAGE_COUNT], p90[STAGE_COUNT], p99[STAGE_COUNT], mean[STAGE_COUNT]; // ns per hop
+} BenchResult;
+
+int CompareDouble(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+int ParseSizes(const char *list, int fallback, int *out) {
+    char buf[256];
+    int n = 0;
+    snprintf(buf, sizeof(buf), "%s", list);
+    for (char *tok = strtok(buf, ","); tok && n < MAX_BENCH_SIZES; tok = strtok(NULL, ",")) if (atoi(tok) > 0) out[n++] = atoi(tok);
+    if (n == 0) out[n++] = fallback;
+    return n;
+}
+
+/* A few seconds of what the decoder normally hears: HELLO, HEADER, a run of data tones with gaps, TERM and silence,
+   over light noise. Bytes avoid the sync markers so the state machine never opens a file. */
+float *BenchSignal(const BandPlan *band, int rate, size_t *len) {
+    const float dataDur = 0.086f, gap = 0.043f;
+    const int bytes = 48;
+    *len = (size_t)(rate * (0.3f + 0.3f + bytes * (dataDur + gap) + 0.3f + 0.5f));
+    float *x = CountedMalloc(*len * sizeof(float));
+    if (!x) return NULL;
+    uint32_t seed = 12345;
+    size_t pos = 0;
+    for (int seg = -2; seg <= bytes + 1; seg++) {
+        float freq, dur = dataDur;
+        if (seg == -2) { freq = band->freqHello; dur = 0.3f; }
+        else if (seg == -1) { freq = band->freqHeader; dur = 0.3f; }
+        else if (seg == bytes) { freq = band->freqTerm; dur = 0.3f; }
+        else if (seg == bytes + 1) { freq = 0.0f; dur = 0.5f; }
+        else { seed = seed * 1664525u + 1013904223u; freq = band->baseFreq + ((seed >> 24) % 240) * band->binSpacing; }
+        size_t n = (size_t)(dur * rate), silence = (seg >= 0 && seg < bytes) ? (size_t)(gap * rate) : 0;
+        for (size_t i = 0; i < n + silence && pos < *len; i++, pos++)
+            x[pos] = (i < n && freq > 0.0f) ? 0.3f * sinf(2.0f * 3.14159265f * freq * i / rate) : 0.0f;
+    }
+    for (; pos < *len; pos++) x[pos] = 0.0f;
+    for (size_t i = 0; i < *len; i++) { seed = seed * 1664525u + 1013904223u; x[i] += ((int)(seed >> 16) - 32768) * (0.01f / 32768.0f); }
+    return x;
+}
+
+// Times each stage over BENCH_BATCHES batches of BENCH_BATCH hops at the current FFT_SIZE/STEP_SIZE
+bool BenchCombo(int sampleRate, BenchResult *res) {
+    BandPlan band;
+    Receiver rx;
+    size_t sigLen = 0, sigPos = 0;
+    int writeIdx = 0, half = FFT_SIZE / 2;
+    double *times = CountedMalloc(sizeof(double) * STAGE_COUNT * BENCH_BATCHES);
+    float peaks[BENCH_BATCH], freqs[BENCH_BATCH];
+    float *history = CountedCalloc(FFT_SIZE, sizeof(float));
+    float *spectra = CountedCalloc((size_t)BENCH_BATCH * half, sizeof(float));
+    kiss_fft_cpx *in = CountedMalloc(sizeof(kiss_fft_cpx) * FFT_SIZE * BENCH_BATCH);
+    kiss_fft_cpx *out = CountedMalloc(sizeof(kiss_fft_cpx) * FFT_SIZE * BENCH_BATCH);
+    kiss_fft_cfg plan = kiss_fft_alloc_engine(FFT_SIZE, 0, KISS_FFT_ENGINE_AUTO, NULL, NULL);
+    float *signal = NULL;
+    bool ok = false;
+
+    memset(res, 0, sizeof(BenchResult));
+    res->fftSize = FFT_SIZE; res->stepSize = STEP_SIZE;
+    int saveStreams = STREAMS;
+    STREAMS = 1;
+    bool bandsOk = SetupBands(sampleRate, &band);
+    STREAMS = saveStreams;
+    if (!bandsOk || !times || !history || !spectra || !in || !out || !plan || !(signal = BenchSignal(&band, sampleRate, &sigLen))) goto done;
+    ReceiverInit(&rx, 0, &band, 2 * sampleRate / STEP_SIZE);
+
+    for (int b = -BENCH_WARMUP; b < BENCH_BATCHES; b++) {
+        double t[STAGE_COUNT + 1];
+        t[0] = NowNs();
+        for (int j = 0; j < BENCH_BATCH; j++) { // New samples into the ring, then unroll it
+            for (int i = 0; i < STEP_SIZE; i++) {
+                history[writeIdx] = signal[sigPos];
+                writeIdx = (writeIdx + 1) % FFT_SIZE;
+                if (++sigPos == sigLen) sigPos = 0;
+            }
+            FillWindow(history, writeIdx, in + (size_t)j * FFT_SIZE);
+        }
+        t[1] = NowNs();
+        for (int j = 0; j < BENCH_BATCH; j++) kiss_fft(plan, in + (size_t)j * FFT_SIZE, out + (size_t)j * FFT_SIZE);
+        t[2] = NowNs();
+        for (int j = 0; j < BENCH_BATCH; j++) MagnitudeSpectrum(out + (size_t)j * FFT_SIZE, spectra + (size_t)j * half);
+        t[3] = NowNs();
+        for (int j = 0; j < BENCH_BATCH; j++) peaks[j] = BandPeak(&band, spectra + (size_t)j * half, &freqs[j]);
+        t[4] = NowNs();
+        // Threshold and state run batch by batch instead of interleaved, which is close enough for timing
+        for (int j = 0; j < BENCH_BATCH; j++) UpdateThreshold(&rx, peaks[j], freqs[j]);
+        t[5] = NowNs();
+        for (int j = 0; j < BENCH_BATCH; j++) ReceiverDecide(&rx, peaks[j], freqs[j]);
+        t[6] = NowNs();
+        if (b < 0) continue;
+        for (int s = 0; s < STAGE_COUNT; s++) times[s * BENCH_BATCHES + b] = (t[s + 1] - t[s]) / BENCH_BATCH;
+    }
+
+    for (int s = 0; s < STAGE_COUNT; s++) {
+        double *v = times + s * BENCH_BATCHES, sum = 0;
+        qsort(v, BENCH_BATCHES, sizeof(double), CompareDouble);
+        for (int b = 0; b < BENCH_BATCHES; b++) sum += v[b];
+        res->p50[s] = v[BENCH_BATCHES / 2];
+        res->p90[s] = v[BENCH_BATCHES * 90 / 100];
+        res->p99[s] = v[BENCH_BATCHES * 99 / 100];
+        res->mean[s] = sum / BENCH_BATCHES;
+    }
+    ReceiverFree(&rx);
+    ok = true;
+
+done:
+    if (times) free(times);
+    if (history) free(history);
+    if (spectra) free(spectra);
     if (in) free(in);
     if (out) free(out);
-    if (slidingBuffer) free(slidingBuffer);
-    if (fileBuffer) free(fileBuffer);
-    if (cfg) kiss_fft_free(cfg);
-    
+    if (plan) kiss_fft_free(plan);
+    if (signal) free(signal);
+    return ok;
+}
+
+// One line per combination and stage, so a baseline can be read back with sscanf
+bool WriteBenchJson(const char *path, const BenchResult *res, int count, int sampleRate) {
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+    fprintf(f, "{\n  \"sample_rate\": %d,\n  \"batch\": %d,\n  \"batches\": %d,\n  \"results\": [\n", sampleRate, BENCH_BATCH, BENCH_BATCHES);
+    for (int i = 0; i < count; i++)
+        for (int s = 0; s < STAGE_COUNT; s++)
+            fprintf(f, "    {\"fft_size\": %d, \"step_size\": %d, \"stage\": \"%s\", \"p50_ns\": %.1f, \"p90_ns\": %.1f, \"p99_ns\": %.1f, \"mean_ns\": %.1f}%s\n",
+                    res[i].fftSize, res[i].stepSize, STAGE_NAMES[s], res[i].p50[s], res[i].p90[s], res[i].p99[s], res[i].mean[s],
+                    (i == count - 1 && s == STAGE_COUNT - 1) ? "" : ",");
+    fprintf(f, "  ]\n}\n");
+    return fclose(f) == 0;
+}
+
+// Returns the number of stages whose median got slower than the baseline allows
+int CompareBaseline(const char *path, const BenchResult *res, int count) {
+    FILE *f = fopen(path, "r");
+    if (!f) { printf(RED_TEXT "ERROR: Cannot read baseline %s\n" RESET_TEXT, path); return 1; }
+    char line[512], stage[16];
+    int fft, step, regressions = 0, matched = 0;
+    double base;
+    printf("\nBASELINE: %s (tolerance %.1f%%, at least %.0f ns)\n", path, BENCH_TOLERANCE, BENCH_MIN_NS);
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, " {\"fft_size\": %d, \"step_size\": %d, \"stage\": \"%15[^\"]\", \"p50_ns\": %lf", &fft, &step, stage, &base) != 4) continue;
+        for (int i = 0; i < count; i++) {
+            if (res[i].fftSize != fft || res[i].stepSize != step) continue;
+            for (int s = 0; s < STAGE_COUNT; s++) {
+                if (strcmp(STAGE_NAMES[s], stage) != 0) continue;
+                double change = base > 0 ? (res[i].p50[s] - base) / base * 100.0 : 0.0;
+                bool slower = change > BENCH_TOLERANCE && res[i].p50[s] - base > BENCH_MIN_NS;
+                matched++;
+                if (slower) regressions++;
+                printf("%s %5d/%-4d %-10s %10.1f ns  (baseline %10.1f, %+6.1f%%)%s" RESET_TEXT "\n", slower ? RED_TEXT : "",
+                       fft, step, stage, res[i].p50[s], base, change, slower ? "  REGRESSION" : "");
+            }
+        }
+    }
+    fclose(f);
+    if (matched == 0) printf("WARNING: No stage in the baseline matches these FFT_SIZE/STEP_SIZE combinations.\n");
+    return regressions;
+}
+
+int RunBenchmark(const char *baseline) {
+    int ffts[MAX_BENCH_SIZES], steps[MAX_BENCH_SIZES];
+    int nFft = ParseSizes(BENCH_FFT_SIZES, FFT_SIZE, ffts), nStep = ParseSizes(BENCH_STEP_SIZES, STEP_SIZE, steps);
+    BenchResult res[MAX_BENCH_SIZES * MAX_BENCH_SIZES];
+    int count = 0, saveFft = FFT_SIZE, saveStep = STEP_SIZE;
+    g_LogMuted = true;
+
+    printf("BENCHMARK: ns per hop, median (p90 / p99), %d x %d hops per combination\n", BENCH_BATCHES, BENCH_BATCH);
+    for (int a = 0; a < nFft; a++) {
+        for (int b = 0; b < nStep; b++) {
+            FFT_SIZE = ffts[a]; STEP_SIZE = steps[b];
+            if (!BenchCombo(SAMPLE_RATE, &res[count])) { printf(RED_TEXT "ERROR: FFT_SIZE=%d STEP_SIZE=%d could not run.\n" RESET_TEXT, FFT_SIZE, STEP_SIZE); continue; }
+            printf("\nFFT_SIZE=%d STEP_SIZE=%d (real-time budget %.0f ns per hop)\n", FFT_SIZE, STEP_SIZE, 1e9 * STEP_SIZE / SAMPLE_RATE);
+            for (int s = 0; s < STAGE_COUNT; s++)
+                printf("  %-10s %10.1f ns  (%.1f / %.1f)\n", STAGE_NAMES[s], res[count].p50[s], res[count].p90[s], res[count].p99[s]);
+            count++;
+        }
+    }
+    FFT_SIZE = saveFft; STEP_SIZE = saveStep;
+    g_LogMuted = false;
+
+    if (WriteBenchJson(BENCH_OUTPUT, res, count, SAMPLE_RATE)) printf("\nResults written to %s\n", BENCH_OUTPUT);
+    else printf(RED_TEXT "ERROR: Cannot write %s\n" RESET_TEXT, BENCH_OUTPUT);
+    if (!baseline) return 0;
+    int regressions = CompareBaseline(baseline, res, count);
+    if (regressions > 0) printf(RED_TEXT "\nFAILED: %d stage(s) slower than the baseline allows.\n" RESET_TEXT, regressions);
+    else printf("\nPASSED: no stage regressed.\n");
+    return regressions > 0 ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    // 1. Declare ALL variables at the top to prevent 'goto' bypass errors
+    Capture cap;
+    Decoder dec;
+    BandPlan bands[MAX_STREAMS];
+    int nCh = 1; // Channels analysed
+    int exitCode = 0;
+    LARGE_INTEGER qpf;
+    STATS(DWORD lastDump = 0);
+    memset(&cap, 0, sizeof(Capture));
+    memset(&dec, 0, sizeof(Decoder));
+
+    if (!load_config("decoder_config.ini")) { //Ensuring config exist.
+        printf(RED_TEXT "ERROR: decoder_config.ini not found. Using default values.\n" RESET_TEXT);
+    }
+
+    crc32c_init();
+    QueryPerformanceFrequency(&qpf);
+    g_TicksToNs = 1e9 / (double)qpf.QuadPart; // Timer ticks to nanoseconds for --bench and DECODER_STATS
+
+    // Declaring COM interfaces and variables to NULL for cleanup later
+    CoInitialize(NULL);
+
+    signal(SIGINT, SignalHandler); // Allow Ctrl+C to trigger cleanup
+
+    if (argc > 2 && strcmp(argv[1], "--soak") == 0) { exitCode = RunSoak(argv[2], argc > 3 ? atof(argv[3]) : 60.0); goto cleanup; }
+    if (argc > 1 && strcmp(argv[1], "--bench") == 0) { exitCode = RunBenchmark(argc > 2 ? argv[2] : NULL); goto cleanup; }
+    if (argc > 1) { DecodeFile(argv[1]); goto cleanup; } // decoder.exe recording.wav
+    if (DAEMON) { RunDaemon(); goto cleanup; }
+
+    // --- INITIALIZE AUDIO CAPTURE ---
+    if (!OpenCapture(&cap)) goto cleanup;
+    if (!SetupBands(cap.pwfx->nSamplesPerSec, bands)) goto cleanup;
+
+    PrintConfig(cap.pwfx->nSamplesPerSec, bands, STREAMS);
+
+    if (DIVERSITY) {
+        nCh = cap.pwfx->nChannels < MAX_DIVERSITY_CHANNELS ? cap.pwfx->nChannels : MAX_DIVERSITY_CHANNELS;
+        printf("DIVERSITY: %s across %d channel(s)\n\n", DIVERSITY == 1 ? "Selection" : "Maximal-ratio", nCh);
+    }
+    if (!DecoderInit(&dec, "", nCh, bands, STREAMS, cap.pwfx->nSamplesPerSec, true)) {
+        printf(RED_TEXT "ERROR: Memory allocation failed.\n" RESET_TEXT);
+        goto cleanup;
+    }
+    dec.adaptive = ADAPTIVE_HOP;
+
+    while (g_Running) {
+        UINT32 pSize = 0;
+        IAudioCaptureClient_GetNextPacketSize(cap.pCap, &pSize); // Get size of next packet
+        if (pSize > 0) {
+            BYTE *pData; UINT32 nRead; DWORD flags;
+            IAudioCaptureClient_GetBuffer(cap.pCap, &pData, &nRead, &flags, NULL, NULL);
+            STATS(if (flags & AUDCLNT_BUFFERFLAGS_DATA_DISCONTINUITY) dec.stats.overruns++);
+            dec.backlogMs = CaptureBacklogMs(&cap);
+            DecoderFeed(&dec, (float *)pData, nRead, cap.pwfx->nChannels); // pData is 32bit float, interleaved channels
+            IAudioCaptureClient_ReleaseBuffer(cap.pCap, nRead); // Release buffer to OS
+        } else Sleep(1); // No data, rest CPU
+#ifdef DECODER_STATS
+        if (GetTickCount() - lastDump >= (DWORD)(STATS_INTERVAL * 1000)) {
+            DecoderStats *one = &dec.stats;
+            WriteStats(&one, 1, cap.pwfx->nSamplesPerSec);
+            lastDump = GetTickCount();
+        }
+#endif
+    }
+    STATS(DecoderStats *last = &dec.stats; WriteStats(&last, 1, cap.pwfx->nSamplesPerSec)); // Final numbers on Ctrl+C
+
+cleanup:
+    CloseCapture(&cap);
+
+    // Free the dynamic memory we allocated
+    DecoderFree(&dec);
+    kfc_cleanup();
+
     CoUninitialize();
 
     printf("\nDecoder terminated gracefully. Thanks for checking out ChordCast! :D\n");
-    return 0;
-}
\ No newline at end of file
+    return exitCode;
+}
@@ -0,0 +1,1986 @@
+/*
+ *  Copyright (c) 2003-2010, Mark Borgerding. All rights reserved.
+ *  This file is part of KISS FFT - https://github.com/mborgerding/kissfft
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  See COPYING file for more information.
+ */
+
+/* _kiss_fft_codelets.h
+   GENERATED by tools/kf_codelets.py -- edit the generator, not this file.
+
+   Straight-line split-radix DFTs of 8, 16, 32, 64 points used by kf_work as leaves in place of the
+   last few radix-2/4 stages. Floating point only: fixed point would need the C_FIXDIV scaling.
+ */
+#ifndef _kiss_fft_codelets_h
+#define _kiss_fft_codelets_h
+
+#if !defined(FIXED_POINT) && !defined(USE_SIMD) && !defined(KISS_FFT_NO_CODELETS)
+#define KF_CODELETS 1
+
+static void kf_leaf64_fwd(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs)
+{
+    const kiss_fft_scalar t0r = f[0].r + f[32*fs].r, t0i = f[0].i + f[32*fs].i;
+    const kiss_fft_scalar t1r = f[0].r - f[32*fs].r, t1i = f[0].i - f[32*fs].i;
+    const kiss_fft_scalar t2r = f[16*fs].r + f[48*fs].r, t2i = f[16*fs].i + f[48*fs].i;
+    const kiss_fft_scalar t3r = f[16*fs].r - f[48*fs].r, t3i = f[16*fs].i - f[48*fs].i;
+    const kiss_fft_scalar t4r = t3i, t4i = -t3r;
+    const kiss_fft_scalar t5r = t0r + t2r, t5i = t0i + t2i;
+    const kiss_fft_scalar t6r = t0r - t2r, t6i = t0i - t2i;
+    const kiss_fft_scalar t7r = t1r + t4r, t7i = t1i + t4i;
+    const kiss_fft_scalar t8r = t1r - t4r, t8i = t1i - t4i;
+    const kiss_fft_scalar t9r = f[8*fs].r + f[40*fs].r, t9i = f[8*fs].i + f[40*fs].i;
+    const kiss_fft_scalar t10r = f[8*fs].r - f[40*fs].r, t10i = f[8*fs].i - f[40*fs].i;
+    const kiss_fft_scalar t11r = f[24*fs].r + f[56*fs].r, t11i = f[24*fs].i + f[56*fs].i;
+    const kiss_fft_scalar t12r = f[24*fs].r - f[56*fs].r, t12i = f[24*fs].i - f[56*fs].i;
+    const kiss_fft_scalar t13r = t9r + t11r, t13i = t9i + t11i;
+    const kiss_fft_scalar t14r = t9r - t11r, t14i = t9i - t11i;
+    const kiss_fft_scalar t15r = t14i, t15i = -t14r;
+    const kiss_fft_scalar t16r = t5r + t13r, t16i = t5i + t13i;
+    const kiss_fft_scalar t17r = t5r - t13r, t17i = t5i - t13i;
+    const kiss_fft_scalar t18r = t6r + t15r, t18i = t6i + t15i;
+    const kiss_fft_scalar t19r = t6r - t15r, t19i = t6i - t15i;
+    const kiss_fft_scalar t20r = (t10r + t10i)*(kiss_fft_scalar)0.70710678118654757, t20i = (t10i - t10r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t21r = -(t12r - t12i)*(kiss_fft_scalar)0.70710678118654757, t21i = -(t12r + t12i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t22r = t20r + t21r, t22i = t20i + t21i;
+    const kiss_fft_scalar t23r = t20r - t21r, t23i = t20i - t21i;
+    const kiss_fft_scalar t24r = t23i, t24i = -t23r;
+    const kiss_fft_scalar t25r = t7r + t22r, t25i = t7i + t22i;
+    const kiss_fft_scalar t26r = t7r - t22r, t26i = t7i - t22i;
+    const kiss_fft_scalar t27r = t8r + t24r, t27i = t8i + t24i;
+    const kiss_fft_scalar t28r = t8r - t24r, t28i = t8i - t24i;
+    const kiss_fft_scalar t29r = f[4*fs].r + f[36*fs].r, t29i = f[4*fs].i + f[36*fs].i;
+    const kiss_fft_scalar t30r = f[4*fs].r - f[36*fs].r, t30i = f[4*fs].i - f[36*fs].i;
+    const kiss_fft_scalar t31r = f[20*fs].r + f[52*fs].r, t31i = f[20*fs].i + f[52*fs].i;
+    const kiss_fft_scalar t32r = f[20*fs].r - f[52*fs].r, t32i = f[20*fs].i - f[52*fs].i;
+    const kiss_fft_scalar t33r = t32i, t33i = -t32r;
+    const kiss_fft_scalar t34r = t29r + t31r, t34i = t29i + t31i;
+    const kiss_fft_scalar t35r = t29r - t31r, t35i = t29i - t31i;
+    const kiss_fft_scalar t36r = t30r + t33r, t36i = t30i + t33i;
+    const kiss_fft_scalar t37r = t30r - t33r, t37i = t30i - t33i;
+    const kiss_fft_scalar t38r = f[12*fs].r + f[44*fs].r, t38i = f[12*fs].i + f[44*fs].i;
+    const kiss_fft_scalar t39r = f[12*fs].r - f[44*fs].r, t39i = f[12*fs].i - f[44*fs].i;
+    const kiss_fft_scalar t40r = f[28*fs].r + f[60*fs].r, t40i = f[28*fs].i + f[60*fs].i;
+    const kiss_fft_scalar t41r = f[28*fs].r - f[60*fs].r, t41i = f[28*fs].i - f[60*fs].i;
+    const kiss_fft_scalar t42r = t41i, t42i = -t41r;
+    const kiss_fft_scalar t43r = t38r + t40r, t43i = t38i + t40i;
+    const kiss_fft_scalar t44r = t38r - t40r, t44i = t38i - t40i;
+    const kiss_fft_scalar t45r = t39r + t42r, t45i = t39i + t42i;
+    const kiss_fft_scalar t46r = t39r - t42r, t46i = t39i - t42i;
+    const kiss_fft_scalar t47r = t34r + t43r, t47i = t34i + t43i;
+    const kiss_fft_scalar t48r = t34r - t43r, t48i = t34i - t43i;
+    const kiss_fft_scalar t49r = t48i, t49i = -t48r;
+    const kiss_fft_scalar t50r = t16r + t47r, t50i = t16i + t47i;
+    const kiss_fft_scalar t51r = t16r - t47r, t51i = t16i - t47i;
+    const kiss_fft_scalar t52r = t17r + t49r, t52i = t17i + t49i;
+    const kiss_fft_scalar t53r = t17r - t49r, t53i = t17i - t49i;
+    const kiss_fft_scalar t54r = t36r*(kiss_fft_scalar)0.92387953251128674 + t36i*(kiss_fft_scalar)0.38268343236508978, t54i = t36i*(kiss_fft_scalar)0.92387953251128674 - t36r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t55r = t45r*(kiss_fft_scalar)0.38268343236508984 + t45i*(kiss_fft_scalar)0.92387953251128674, t55i = t45i*(kiss_fft_scalar)0.38268343236508984 - t45r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t56r = t54r + t55r, t56i = t54i + t55i;
+    const kiss_fft_scalar t57r = t54r - t55r, t57i = t54i - t55i;
+    const kiss_fft_scalar t58r = t57i, t58i = -t57r;
+    const kiss_fft_scalar t59r = t25r + t56r, t59i = t25i + t56i;
+    const kiss_fft_scalar t60r = t25r - t56r, t60i = t25i - t56i;
+    const kiss_fft_scalar t61r = t26r + t58r, t61i = t26i + t58i;
+    const kiss_fft_scalar t62r = t26r - t58r, t62i = t26i - t58i;
+    const kiss_fft_scalar t63r = (t35r + t35i)*(kiss_fft_scalar)0.70710678118654757, t63i = (t35i - t35r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t64r = -(t44r - t44i)*(kiss_fft_scalar)0.70710678118654757, t64i = -(t44r + t44i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t65r = t63r + t64r, t65i = t63i + t64i;
+    const kiss_fft_scalar t66r = t63r - t64r, t66i = t63i - t64i;
+    const kiss_fft_scalar t67r = t66i, t67i = -t66r;
+    const kiss_fft_scalar t68r = t18r + t65r, t68i = t18i + t65i;
+    const kiss_fft_scalar t69r = t18r - t65r, t69i = t18i - t65i;
+    const kiss_fft_scalar t70r = t19r + t67r, t70i = t19i + t67i;
+    const kiss_fft_scalar t71r = t19r - t67r, t71i = t19i - t67i;
+    const kiss_fft_scalar t72r = t37r*(kiss_fft_scalar)0.38268343236508984 + t37i*(kiss_fft_scalar)0.92387953251128674, t72i = t37i*(kiss_fft_scalar)0.38268343236508984 - t37r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t73r = t46r*(kiss_fft_scalar)-0.92387953251128685 - t46i*(kiss_fft_scalar)0.38268343236508967, t73i = t46i*(kiss_fft_scalar)-0.92387953251128685 + t46r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t74r = t72r + t73r, t74i = t72i + t73i;
+    const kiss_fft_scalar t75r = t72r - t73r, t75i = t72i - t73i;
+    const kiss_fft_scalar t76r = t75i, t76i = -t75r;
+    const kiss_fft_scalar t77r = t27r + t74r, t77i = t27i + t74i;
+    const kiss_fft_scalar t78r = t27r - t74r, t78i = t27i - t74i;
+    const kiss_fft_scalar t79r = t28r + t76r, t79i = t28i + t76i;
+    const kiss_fft_scalar t80r = t28r - t76r, t80i = t28i - t76i;
+    const kiss_fft_scalar t81r = f[2*fs].r + f[34*fs].r, t81i = f[2*fs].i + f[34*fs].i;
+    const kiss_fft_scalar t82r = f[2*fs].r - f[34*fs].r, t82i = f[2*fs].i - f[34*fs].i;
+    const kiss_fft_scalar t83r = f[18*fs].r + f[50*fs].r, t83i = f[18*fs].i + f[50*fs].i;
+    const kiss_fft_scalar t84r = f[18*fs].r - f[50*fs].r, t84i = f[18*fs].i - f[50*fs].i;
+    const kiss_fft_scalar t85r = t84i, t85i = -t84r;
+    const kiss_fft_scalar t86r = t81r + t83r, t86i = t81i + t83i;
+    const kiss_fft_scalar t87r = t81r - t83r, t87i = t81i - t83i;
+    const kiss_fft_scalar t88r = t82r + t85r, t88i = t82i + t85i;
+    const kiss_fft_scalar t89r = t82r - t85r, t89i = t82i - t85i;
+    const kiss_fft_scalar t90r = f[10*fs].r + f[42*fs].r, t90i = f[10*fs].i + f[42*fs].i;
+    const kiss_fft_scalar t91r = f[10*fs].r - f[42*fs].r, t91i = f[10*fs].i - f[42*fs].i;
+    const kiss_fft_scalar t92r = f[26*fs].r + f[58*fs].r, t92i = f[26*fs].i + f[58*fs].i;
+    const kiss_fft_scalar t93r = f[26*fs].r - f[58*fs].r, t93i = f[26*fs].i - f[58*fs].i;
+    const kiss_fft_scalar t94r = t90r + t92r, t94i = t90i + t92i;
+    const kiss_fft_scalar t95r = t90r - t92r, t95i = t90i - t92i;
+    const kiss_fft_scalar t96r = t95i, t96i = -t95r;
+    const kiss_fft_scalar t97r = t86r + t94r, t97i = t86i + t94i;
+    const kiss_fft_scalar t98r = t86r - t94r, t98i = t86i - t94i;
+    const kiss_fft_scalar t99r = t87r + t96r, t99i = t87i + t96i;
+    const kiss_fft_scalar t100r = t87r - t96r, t100i = t87i - t96i;
+    const kiss_fft_scalar t101r = (t91r + t91i)*(kiss_fft_scalar)0.70710678118654757, t101i = (t91i - t91r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t102r = -(t93r - t93i)*(kiss_fft_scalar)0.70710678118654757, t102i = -(t93r + t93i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t103r = t101r + t102r, t103i = t101i + t102i;
+    const kiss_fft_scalar t104r = t101r - t102r, t104i = t101i - t102i;
+    const kiss_fft_scalar t105r = t104i, t105i = -t104r;
+    const kiss_fft_scalar t106r = t88r + t103r, t106i = t88i + t103i;
+    const kiss_fft_scalar t107r = t88r - t103r, t107i = t88i - t103i;
+    const kiss_fft_scalar t108r = t89r + t105r, t108i = t89i + t105i;
+    const kiss_fft_scalar t109r = t89r - t105r, t109i = t89i - t105i;
+    const kiss_fft_scalar t110r = f[6*fs].r + f[38*fs].r, t110i = f[6*fs].i + f[38*fs].i;
+    const kiss_fft_scalar t111r = f[6*fs].r - f[38*fs].r, t111i = f[6*fs].i - f[38*fs].i;
+    const kiss_fft_scalar t112r = f[22*fs].r + f[54*fs].r, t112i = f[22*fs].i + f[54*fs].i;
+    const kiss_fft_scalar t113r = f[22*fs].r - f[54*fs].r, t113i = f[22*fs].i - f[54*fs].i;
+    const kiss_fft_scalar t114r = t113i, t114i = -t113r;
+    const kiss_fft_scalar t115r = t110r + t112r, t115i = t110i + t112i;
+    const kiss_fft_scalar t116r = t110r - t112r, t116i = t110i - t112i;
+    const kiss_fft_scalar t117r = t111r + t114r, t117i = t111i + t114i;
+    const kiss_fft_scalar t118r = t111r - t114r, t118i = t111i - t114i;
+    const kiss_fft_scalar t119r = f[14*fs].r + f[46*fs].r, t119i = f[14*fs].i + f[46*fs].i;
+    const kiss_fft_scalar t120r = f[14*fs].r - f[46*fs].r, t120i = f[14*fs].i - f[46*fs].i;
+    const kiss_fft_scalar t121r = f[30*fs].r + f[62*fs].r, t121i = f[30*fs].i + f[62*fs].i;
+    const kiss_fft_scalar t122r = f[30*fs].r - f[62*fs].r, t122i = f[30*fs].i - f[62*fs].i;
+    const kiss_fft_scalar t123r = t119r + t121r, t123i = t119i + t121i;
+    const kiss_fft_scalar t124r = t119r - t121r, t124i = t119i - t121i;
+    const kiss_fft_scalar t125r = t124i, t125i = -t124r;
+    const kiss_fft_scalar t126r = t115r + t123r, t126i = t115i + t123i;
+    const kiss_fft_scalar t127r = t115r - t123r, t127i = t115i - t123i;
+    const kiss_fft_scalar t128r = t116r + t125r, t128i = t116i + t125i;
+    const kiss_fft_scalar t129r = t116r - t125r, t129i = t116i - t125i;
+    const kiss_fft_scalar t130r = (t120r + t120i)*(kiss_fft_scalar)0.70710678118654757, t130i = (t120i - t120r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t131r = -(t122r - t122i)*(kiss_fft_scalar)0.70710678118654757, t131i = -(t122r + t122i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t132r = t130r + t131r, t132i = t130i + t131i;
+    const kiss_fft_scalar t133r = t130r - t131r, t133i = t130i - t131i;
+    const kiss_fft_scalar t134r = t133i, t134i = -t133r;
+    const kiss_fft_scalar t135r = t117r + t132r, t135i = t117i + t132i;
+    const kiss_fft_scalar t136r = t117r - t132r, t136i = t117i - t132i;
+    const kiss_fft_scalar t137r = t118r + t134r, t137i = t118i + t134i;
+    const kiss_fft_scalar t138r = t118r - t134r, t138i = t118i - t134i;
+    const kiss_fft_scalar t139r = t97r + t126r, t139i = t97i + t126i;
+    const kiss_fft_scalar t140r = t97r - t126r, t140i = t97i - t126i;
+    const kiss_fft_scalar t141r = t140i, t141i = -t140r;
+    const kiss_fft_scalar t142r = t50r + t139r, t142i = t50i + t139i;
+    const kiss_fft_scalar t143r = t50r - t139r, t143i = t50i - t139i;
+    const kiss_fft_scalar t144r = t51r + t141r, t144i = t51i + t141i;
+    const kiss_fft_scalar t145r = t51r - t141r, t145i = t51i - t141i;
+    const kiss_fft_scalar t146r = t106r*(kiss_fft_scalar)0.98078528040323043 + t106i*(kiss_fft_scalar)0.19509032201612825, t146i = t106i*(kiss_fft_scalar)0.98078528040323043 - t106r*(kiss_fft_scalar)0.19509032201612825;
+    const kiss_fft_scalar t147r = t135r*(kiss_fft_scalar)0.83146961230254524 + t135i*(kiss_fft_scalar)0.55557023301960218, t147i = t135i*(kiss_fft_scalar)0.83146961230254524 - t135r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t148r = t146r + t147r, t148i = t146i + t147i;
+    const kiss_fft_scalar t149r = t146r - t147r, t149i = t146i - t147i;
+    const kiss_fft_scalar t150r = t149i, t150i = -t149r;
+    const kiss_fft_scalar t151r = t59r + t148r, t151i = t59i + t148i;
+    const kiss_fft_scalar t152r = t59r - t148r, t152i = t59i - t148i;
+    const kiss_fft_scalar t153r = t60r + t150r, t153i = t60i + t150i;
+    const kiss_fft_scalar t154r = t60r - t150r, t154i = t60i - t150i;
+    const kiss_fft_scalar t155r = t99r*(kiss_fft_scalar)0.92387953251128674 + t99i*(kiss_fft_scalar)0.38268343236508978, t155i = t99i*(kiss_fft_scalar)0.92387953251128674 - t99r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t156r = t128r*(kiss_fft_scalar)0.38268343236508984 + t128i*(kiss_fft_scalar)0.92387953251128674, t156i = t128i*(kiss_fft_scalar)0.38268343236508984 - t128r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t157r = t155r + t156r, t157i = t155i + t156i;
+    const kiss_fft_scalar t158r = t155r - t156r, t158i = t155i - t156i;
+    const kiss_fft_scalar t159r = t158i, t159i = -t158r;
+    const kiss_fft_scalar t160r = t68r + t157r, t160i = t68i + t157i;
+    const kiss_fft_scalar t161r = t68r - t157r, t161i = t68i - t157i;
+    const kiss_fft_scalar t162r = t69r + t159r, t162i = t69i + t159i;
+    const kiss_fft_scalar t163r = t69r - t159r, t163i = t69i - t159i;
+    const kiss_fft_scalar t164r = t108r*(kiss_fft_scalar)0.83146961230254524 + t108i*(kiss_fft_scalar)0.55557023301960218, t164i = t108i*(kiss_fft_scalar)0.83146961230254524 - t108r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t165r = t137r*(kiss_fft_scalar)-0.19509032201612819 + t137i*(kiss_fft_scalar)0.98078528040323043, t165i = t137i*(kiss_fft_scalar)-0.19509032201612819 - t137r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t166r = t164r + t165r, t166i = t164i + t165i;
+    const kiss_fft_scalar t167r = t164r - t165r, t167i = t164i - t165i;
+    const kiss_fft_scalar t168r = t167i, t168i = -t167r;
+    const kiss_fft_scalar t169r = t77r + t166r, t169i = t77i + t166i;
+    const kiss_fft_scalar t170r = t77r - t166r, t170i = t77i - t166i;
+    const kiss_fft_scalar t171r = t78r + t168r, t171i = t78i + t168i;
+    const kiss_fft_scalar t172r = t78r - t168r, t172i = t78i - t168i;
+    const kiss_fft_scalar t173r = (t98r + t98i)*(kiss_fft_scalar)0.70710678118654757, t173i = (t98i - t98r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t174r = -(t127r - t127i)*(kiss_fft_scalar)0.70710678118654757, t174i = -(t127r + t127i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t175r = t173r + t174r, t175i = t173i + t174i;
+    const kiss_fft_scalar t176r = t173r - t174r, t176i = t173i - t174i;
+    const kiss_fft_scalar t177r = t176i, t177i = -t176r;
+    const kiss_fft_scalar t178r = t52r + t175r, t178i = t52i + t175i;
+    const kiss_fft_scalar t179r = t52r - t175r, t179i = t52i - t175i;
+    const kiss_fft_scalar t180r = t53r + t177r, t180i = t53i + t177i;
+    const kiss_fft_scalar t181r = t53r - t177r, t181i = t53i - t177i;
+    const kiss_fft_scalar t182r = t107r*(kiss_fft_scalar)0.55557023301960229 + t107i*(kiss_fft_scalar)0.83146961230254524, t182i = t107i*(kiss_fft_scalar)0.55557023301960229 - t107r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t183r = t136r*(kiss_fft_scalar)-0.98078528040323043 + t136i*(kiss_fft_scalar)0.19509032201612861, t183i = t136i*(kiss_fft_scalar)-0.98078528040323043 - t136r*(kiss_fft_scalar)0.19509032201612861;
+    const kiss_fft_scalar t184r = t182r + t183r, t184i = t182i + t183i;
+    const kiss_fft_scalar t185r = t182r - t183r, t185i = t182i - t183i;
+    const kiss_fft_scalar t186r = t185i, t186i = -t185r;
+    const kiss_fft_scalar t187r = t61r + t184r, t187i = t61i + t184i;
+    const kiss_fft_scalar t188r = t61r - t184r, t188i = t61i - t184i;
+    const kiss_fft_scalar t189r = t62r + t186r, t189i = t62i + t186i;
+    const kiss_fft_scalar t190r = t62r - t186r, t190i = t62i - t186i;
+    const kiss_fft_scalar t191r = t100r*(kiss_fft_scalar)0.38268343236508984 + t100i*(kiss_fft_scalar)0.92387953251128674, t191i = t100i*(kiss_fft_scalar)0.38268343236508984 - t100r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t192r = t129r*(kiss_fft_scalar)-0.92387953251128685 - t129i*(kiss_fft_scalar)0.38268343236508967, t192i = t129i*(kiss_fft_scalar)-0.92387953251128685 + t129r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t193r = t191r + t192r, t193i = t191i + t192i;
+    const kiss_fft_scalar t194r = t191r - t192r, t194i = t191i - t192i;
+    const kiss_fft_scalar t195r = t194i, t195i = -t194r;
+    const kiss_fft_scalar t196r = t70r + t193r, t196i = t70i + t193i;
+    const kiss_fft_scalar t197r = t70r - t193r, t197i = t70i - t193i;
+    const kiss_fft_scalar t198r = t71r + t195r, t198i = t71i + t195i;
+    const kiss_fft_scalar t199r = t71r - t195r, t199i = t71i - t195i;
+    const kiss_fft_scalar t200r = t109r*(kiss_fft_scalar)0.19509032201612833 + t109i*(kiss_fft_scalar)0.98078528040323043, t200i = t109i*(kiss_fft_scalar)0.19509032201612833 - t109r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t201r = t138r*(kiss_fft_scalar)-0.55557023301960218 - t138i*(kiss_fft_scalar)0.83146961230254524, t201i = t138i*(kiss_fft_scalar)-0.55557023301960218 + t138r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t202r = t200r + t201r, t202i = t200i + t201i;
+    const kiss_fft_scalar t203r = t200r - t201r, t203i = t200i - t201i;
+    const kiss_fft_scalar t204r = t203i, t204i = -t203r;
+    const kiss_fft_scalar t205r = t79r + t202r, t205i = t79i + t202i;
+    const kiss_fft_scalar t206r = t79r - t202r, t206i = t79i - t202i;
+    const kiss_fft_scalar t207r = t80r + t204r, t207i = t80i + t204i;
+    const kiss_fft_scalar t208r = t80r - t204r, t208i = t80i - t204i;
+    const kiss_fft_scalar t209r = f[fs].r + f[33*fs].r, t209i = f[fs].i + f[33*fs].i;
+    const kiss_fft_scalar t210r = f[fs].r - f[33*fs].r, t210i = f[fs].i - f[33*fs].i;
+    const kiss_fft_scalar t211r = f[17*fs].r + f[49*fs].r, t211i = f[17*fs].i + f[49*fs].i;
+    const kiss_fft_scalar t212r = f[17*fs].r - f[49*fs].r, t212i = f[17*fs].i - f[49*fs].i;
+    const kiss_fft_scalar t213r = t212i, t213i = -t212r;
+    const kiss_fft_scalar t214r = t209r + t211r, t214i = t209i + t211i;
+    const kiss_fft_scalar t215r = t209r - t211r, t215i = t209i - t211i;
+    const kiss_fft_scalar t216r = t210r + t213r, t216i = t210i + t213i;
+    const kiss_fft_scalar t217r = t210r - t213r, t217i = t210i - t213i;
+    const kiss_fft_scalar t218r = f[9*fs].r + f[41*fs].r, t218i = f[9*fs].i + f[41*fs].i;
+    const kiss_fft_scalar t219r = f[9*fs].r - f[41*fs].r, t219i = f[9*fs].i - f[41*fs].i;
+    const kiss_fft_scalar t220r = f[25*fs].r + f[57*fs].r, t220i = f[25*fs].i + f[57*fs].i;
+    const kiss_fft_scalar t221r = f[25*fs].r - f[57*fs].r, t221i = f[25*fs].i - f[57*fs].i;
+    const kiss_fft_scalar t222r = t218r + t220r, t222i = t218i + t220i;
+    const kiss_fft_scalar t223r = t218r - t220r, t223i = t218i - t220i;
+    const kiss_fft_scalar t224r = t223i, t224i = -t223r;
+    const kiss_fft_scalar t225r = t214r + t222r, t225i = t214i + t222i;
+    const kiss_fft_scalar t226r = t214r - t222r, t226i = t214i - t222i;
+    const kiss_fft_scalar t227r = t215r + t224r, t227i = t215i + t224i;
+    const kiss_fft_scalar t228r = t215r - t224r, t228i = t215i - t224i;
+    const kiss_fft_scalar t229r = (t219r + t219i)*(kiss_fft_scalar)0.70710678118654757, t229i = (t219i - t219r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t230r = -(t221r - t221i)*(kiss_fft_scalar)0.70710678118654757, t230i = -(t221r + t221i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t231r = t229r + t230r, t231i = t229i + t230i;
+    const kiss_fft_scalar t232r = t229r - t230r, t232i = t229i - t230i;
+    const kiss_fft_scalar t233r = t232i, t233i = -t232r;
+    const kiss_fft_scalar t234r = t216r + t231r, t234i = t216i + t231i;
+    const kiss_fft_scalar t235r = t216r - t231r, t235i = t216i - t231i;
+    const kiss_fft_scalar t236r = t217r + t233r, t236i = t217i + t233i;
+    const kiss_fft_scalar t237r = t217r - t233r, t237i = t217i - t233i;
+    const kiss_fft_scalar t238r = f[5*fs].r + f[37*fs].r, t238i = f[5*fs].i + f[37*fs].i;
+    const kiss_fft_scalar t239r = f[5*fs].r - f[37*fs].r, t239i = f[5*fs].i - f[37*fs].i;
+    const kiss_fft_scalar t240r = f[21*fs].r + f[53*fs].r, t240i = f[21*fs].i + f[53*fs].i;
+    const kiss_fft_scalar t241r = f[21*fs].r - f[53*fs].r, t241i = f[21*fs].i - f[53*fs].i;
+    const kiss_fft_scalar t242r = t241i, t242i = -t241r;
+    const kiss_fft_scalar t243r = t238r + t240r, t243i = t238i + t240i;
+    const kiss_fft_scalar t244r = t238r - t240r, t244i = t238i - t240i;
+    const kiss_fft_scalar t245r = t239r + t242r, t245i = t239i + t242i;
+    const kiss_fft_scalar t246r = t239r - t242r, t246i = t239i - t242i;
+    const kiss_fft_scalar t247r = f[13*fs].r + f[45*fs].r, t247i = f[13*fs].i + f[45*fs].i;
+    const kiss_fft_scalar t248r = f[13*fs].r - f[45*fs].r, t248i = f[13*fs].i - f[45*fs].i;
+    const kiss_fft_scalar t249r = f[29*fs].r + f[61*fs].r, t249i = f[29*fs].i + f[61*fs].i;
+    const kiss_fft_scalar t250r = f[29*fs].r - f[61*fs].r, t250i = f[29*fs].i - f[61*fs].i;
+    const kiss_fft_scalar t251r = t250i, t251i = -t250r;
+    const kiss_fft_scalar t252r = t247r + t249r, t252i = t247i + t249i;
+    const kiss_fft_scalar t253r = t247r - t249r, t253i = t247i - t249i;
+    const kiss_fft_scalar t254r = t248r + t251r, t254i = t248i + t251i;
+    const kiss_fft_scalar t255r = t248r - t251r, t255i = t248i - t251i;
+    const kiss_fft_scalar t256r = t243r + t252r, t256i = t243i + t252i;
+    const kiss_fft_scalar t257r = t243r - t252r, t257i = t243i - t252i;
+    const kiss_fft_scalar t258r = t257i, t258i = -t257r;
+    const kiss_fft_scalar t259r = t225r + t256r, t259i = t225i + t256i;
+    const kiss_fft_scalar t260r = t225r - t256r, t260i = t225i - t256i;
+    const kiss_fft_scalar t261r = t226r + t258r, t261i = t226i + t258i;
+    const kiss_fft_scalar t262r = t226r - t258r, t262i = t226i - t258i;
+    const kiss_fft_scalar t263r = t245r*(kiss_fft_scalar)0.92387953251128674 + t245i*(kiss_fft_scalar)0.38268343236508978, t263i = t245i*(kiss_fft_scalar)0.92387953251128674 - t245r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t264r = t254r*(kiss_fft_scalar)0.38268343236508984 + t254i*(kiss_fft_scalar)0.92387953251128674, t264i = t254i*(kiss_fft_scalar)0.38268343236508984 - t254r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t265r = t263r + t264r, t265i = t263i + t264i;
+    const kiss_fft_scalar t266r = t263r - t264r, t266i = t263i - t264i;
+    const kiss_fft_scalar t267r = t266i, t267i = -t266r;
+    const kiss_fft_scalar t268r = t234r + t265r, t268i = t234i + t265i;
+    const kiss_fft_scalar t269r = t234r - t265r, t269i = t234i - t265i;
+    const kiss_fft_scalar t270r = t235r + t267r, t270i = t235i + t267i;
+    const kiss_fft_scalar t271r = t235r - t267r, t271i = t235i - t267i;
+    const kiss_fft_scalar t272r = (t244r + t244i)*(kiss_fft_scalar)0.70710678118654757, t272i = (t244i - t244r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t273r = -(t253r - t253i)*(kiss_fft_scalar)0.70710678118654757, t273i = -(t253r + t253i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t274r = t272r + t273r, t274i = t272i + t273i;
+    const kiss_fft_scalar t275r = t272r - t273r, t275i = t272i - t273i;
+    const kiss_fft_scalar t276r = t275i, t276i = -t275r;
+    const kiss_fft_scalar t277r = t227r + t274r, t277i = t227i + t274i;
+    const kiss_fft_scalar t278r = t227r - t274r, t278i = t227i - t274i;
+    const kiss_fft_scalar t279r = t228r + t276r, t279i = t228i + t276i;
+    const kiss_fft_scalar t280r = t228r - t276r, t280i = t228i - t276i;
+    const kiss_fft_scalar t281r = t246r*(kiss_fft_scalar)0.38268343236508984 + t246i*(kiss_fft_scalar)0.92387953251128674, t281i = t246i*(kiss_fft_scalar)0.38268343236508984 - t246r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t282r = t255r*(kiss_fft_scalar)-0.92387953251128685 - t255i*(kiss_fft_scalar)0.38268343236508967, t282i = t255i*(kiss_fft_scalar)-0.92387953251128685 + t255r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t283r = t281r + t282r, t283i = t281i + t282i;
+    const kiss_fft_scalar t284r = t281r - t282r, t284i = t281i - t282i;
+    const kiss_fft_scalar t285r = t284i, t285i = -t284r;
+    const kiss_fft_scalar t286r = t236r + t283r, t286i = t236i + t283i;
+    const kiss_fft_scalar t287r = t236r - t283r, t287i = t236i - t283i;
+    const kiss_fft_scalar t288r = t237r + t285r, t288i = t237i + t285i;
+    const kiss_fft_scalar t289r = t237r - t285r, t289i = t237i - t285i;
+    const kiss_fft_scalar t290r = f[3*fs].r + f[35*fs].r, t290i = f[3*fs].i + f[35*fs].i;
+    const kiss_fft_scalar t291r = f[3*fs].r - f[35*fs].r, t291i = f[3*fs].i - f[35*fs].i;
+    const kiss_fft_scalar t292r = f[19*fs].r + f[51*fs].r, t292i = f[19*fs].i + f[51*fs].i;
+    const kiss_fft_scalar t293r = f[19*fs].r - f[51*fs].r, t293i = f[19*fs].i - f[51*fs].i;
+    const kiss_fft_scalar t294r = t293i, t294i = -t293r;
+    const kiss_fft_scalar t295r = t290r + t292r, t295i = t290i + t292i;
+    const kiss_fft_scalar t296r = t290r - t292r, t296i = t290i - t292i;
+    const kiss_fft_scalar t297r = t291r + t294r, t297i = t291i + t294i;
+    const kiss_fft_scalar t298r = t291r - t294r, t298i = t291i - t294i;
+    const kiss_fft_scalar t299r = f[11*fs].r + f[43*fs].r, t299i = f[11*fs].i + f[43*fs].i;
+    const kiss_fft_scalar t300r = f[11*fs].r - f[43*fs].r, t300i = f[11*fs].i - f[43*fs].i;
+    const kiss_fft_scalar t301r = f[27*fs].r + f[59*fs].r, t301i = f[27*fs].i + f[59*fs].i;
+    const kiss_fft_scalar t302r = f[27*fs].r - f[59*fs].r, t302i = f[27*fs].i - f[59*fs].i;
+    const kiss_fft_scalar t303r = t299r + t301r, t303i = t299i + t301i;
+    const kiss_fft_scalar t304r = t299r - t301r, t304i = t299i - t301i;
+    const kiss_fft_scalar t305r = t304i, t305i = -t304r;
+    const kiss_fft_scalar t306r = t295r + t303r, t306i = t295i + t303i;
+    const kiss_fft_scalar t307r = t295r - t303r, t307i = t295i - t303i;
+    const kiss_fft_scalar t308r = t296r + t305r, t308i = t296i + t305i;
+    const kiss_fft_scalar t309r = t296r - t305r, t309i = t296i - t305i;
+    const kiss_fft_scalar t310r = (t300r + t300i)*(kiss_fft_scalar)0.70710678118654757, t310i = (t300i - t300r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t311r = -(t302r - t302i)*(kiss_fft_scalar)0.70710678118654757, t311i = -(t302r + t302i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t312r = t310r + t311r, t312i = t310i + t311i;
+    const kiss_fft_scalar t313r = t310r - t311r, t313i = t310i - t311i;
+    const kiss_fft_scalar t314r = t313i, t314i = -t313r;
+    const kiss_fft_scalar t315r = t297r + t312r, t315i = t297i + t312i;
+    const kiss_fft_scalar t316r = t297r - t312r, t316i = t297i - t312i;
+    const kiss_fft_scalar t317r = t298r + t314r, t317i = t298i + t314i;
+    const kiss_fft_scalar t318r = t298r - t314r, t318i = t298i - t314i;
+    const kiss_fft_scalar t319r = f[7*fs].r + f[39*fs].r, t319i = f[7*fs].i + f[39*fs].i;
+    const kiss_fft_scalar t320r = f[7*fs].r - f[39*fs].r, t320i = f[7*fs].i - f[39*fs].i;
+    const kiss_fft_scalar t321r = f[23*fs].r + f[55*fs].r, t321i = f[23*fs].i + f[55*fs].i;
+    const kiss_fft_scalar t322r = f[23*fs].r - f[55*fs].r, t322i = f[23*fs].i - f[55*fs].i;
+    const kiss_fft_scalar t323r = t322i, t323i = -t322r;
+    const kiss_fft_scalar t324r = t319r + t321r, t324i = t319i + t321i;
+    const kiss_fft_scalar t325r = t319r - t321r, t325i = t319i - t321i;
+    const kiss_fft_scalar t326r = t320r + t323r, t326i = t320i + t323i;
+    const kiss_fft_scalar t327r = t320r - t323r, t327i = t320i - t323i;
+    const kiss_fft_scalar t328r = f[15*fs].r + f[47*fs].r, t328i = f[15*fs].i + f[47*fs].i;
+    const kiss_fft_scalar t329r = f[15*fs].r - f[47*fs].r, t329i = f[15*fs].i - f[47*fs].i;
+    const kiss_fft_scalar t330r = f[31*fs].r + f[63*fs].r, t330i = f[31*fs].i + f[63*fs].i;
+    const kiss_fft_scalar t331r = f[31*fs].r - f[63*fs].r, t331i = f[31*fs].i - f[63*fs].i;
+    const kiss_fft_scalar t332r = t331i, t332i = -t331r;
+    const kiss_fft_scalar t333r = t328r + t330r, t333i = t328i + t330i;
+    const kiss_fft_scalar t334r = t328r - t330r, t334i = t328i - t330i;
+    const kiss_fft_scalar t335r = t329r + t332r, t335i = t329i + t332i;
+    const kiss_fft_scalar t336r = t329r - t332r, t336i = t329i - t332i;
+    const kiss_fft_scalar t337r = t324r + t333r, t337i = t324i + t333i;
+    const kiss_fft_scalar t338r = t324r - t333r, t338i = t324i - t333i;
+    const kiss_fft_scalar t339r = t338i, t339i = -t338r;
+    const kiss_fft_scalar t340r = t306r + t337r, t340i = t306i + t337i;
+    const kiss_fft_scalar t341r = t306r - t337r, t341i = t306i - t337i;
+    const kiss_fft_scalar t342r = t307r + t339r, t342i = t307i + t339i;
+    const kiss_fft_scalar t343r = t307r - t339r, t343i = t307i - t339i;
+    const kiss_fft_scalar t344r = t326r*(kiss_fft_scalar)0.92387953251128674 + t326i*(kiss_fft_scalar)0.38268343236508978, t344i = t326i*(kiss_fft_scalar)0.92387953251128674 - t326r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t345r = t335r*(kiss_fft_scalar)0.38268343236508984 + t335i*(kiss_fft_scalar)0.92387953251128674, t345i = t335i*(kiss_fft_scalar)0.38268343236508984 - t335r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t346r = t344r + t345r, t346i = t344i + t345i;
+    const kiss_fft_scalar t347r = t344r - t345r, t347i = t344i - t345i;
+    const kiss_fft_scalar t348r = t347i, t348i = -t347r;
+    const kiss_fft_scalar t349r = t315r + t346r, t349i = t315i + t346i;
+    const kiss_fft_scalar t350r = t315r - t346r, t350i = t315i - t346i;
+    const kiss_fft_scalar t351r = t316r + t348r, t351i = t316i + t348i;
+    const kiss_fft_scalar t352r = t316r - t348r, t352i = t316i - t348i;
+    const kiss_fft_scalar t353r = (t325r + t325i)*(kiss_fft_scalar)0.70710678118654757, t353i = (t325i - t325r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t354r = -(t334r - t334i)*(kiss_fft_scalar)0.70710678118654757, t354i = -(t334r + t334i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t355r = t353r + t354r, t355i = t353i + t354i;
+    const kiss_fft_scalar t356r = t353r - t354r, t356i = t353i - t354i;
+    const kiss_fft_scalar t357r = t356i, t357i = -t356r;
+    const kiss_fft_scalar t358r = t308r + t355r, t358i = t308i + t355i;
+    const kiss_fft_scalar t359r = t308r - t355r, t359i = t308i - t355i;
+    const kiss_fft_scalar t360r = t309r + t357r, t360i = t309i + t357i;
+    const kiss_fft_scalar t361r = t309r - t357r, t361i = t309i - t357i;
+    const kiss_fft_scalar t362r = t327r*(kiss_fft_scalar)0.38268343236508984 + t327i*(kiss_fft_scalar)0.92387953251128674, t362i = t327i*(kiss_fft_scalar)0.38268343236508984 - t327r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t363r = t336r*(kiss_fft_scalar)-0.92387953251128685 - t336i*(kiss_fft_scalar)0.38268343236508967, t363i = t336i*(kiss_fft_scalar)-0.92387953251128685 + t336r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t364r = t362r + t363r, t364i = t362i + t363i;
+    const kiss_fft_scalar t365r = t362r - t363r, t365i = t362i - t363i;
+    const kiss_fft_scalar t366r = t365i, t366i = -t365r;
+    const kiss_fft_scalar t367r = t317r + t364r, t367i = t317i + t364i;
+    const kiss_fft_scalar t368r = t317r - t364r, t368i = t317i - t364i;
+    const kiss_fft_scalar t369r = t318r + t366r, t369i = t318i + t366i;
+    const kiss_fft_scalar t370r = t318r - t366r, t370i = t318i - t366i;
+    const kiss_fft_scalar t371r = t259r + t340r, t371i = t259i + t340i;
+    const kiss_fft_scalar t372r = t259r - t340r, t372i = t259i - t340i;
+    const kiss_fft_scalar t373r = t372i, t373i = -t372r;
+    const kiss_fft_scalar t374r = t142r + t371r, t374i = t142i + t371i;
+    const kiss_fft_scalar t375r = t142r - t371r, t375i = t142i - t371i;
+    const kiss_fft_scalar t376r = t143r + t373r, t376i = t143i + t373i;
+    const kiss_fft_scalar t377r = t143r - t373r, t377i = t143i - t373i;
+    const kiss_fft_scalar t378r = t268r*(kiss_fft_scalar)0.99518472667219693 + t268i*(kiss_fft_scalar)0.098017140329560604, t378i = t268i*(kiss_fft_scalar)0.99518472667219693 - t268r*(kiss_fft_scalar)0.098017140329560604;
+    const kiss_fft_scalar t379r = t349r*(kiss_fft_scalar)0.95694033573220882 + t349i*(kiss_fft_scalar)0.29028467725446233, t379i = t349i*(kiss_fft_scalar)0.95694033573220882 - t349r*(kiss_fft_scalar)0.29028467725446233;
+    const kiss_fft_scalar t380r = t378r + t379r, t380i = t378i + t379i;
+    const kiss_fft_scalar t381r = t378r - t379r, t381i = t378i - t379i;
+    const kiss_fft_scalar t382r = t381i, t382i = -t381r;
+    const kiss_fft_scalar t383r = t151r + t380r, t383i = t151i + t380i;
+    const kiss_fft_scalar t384r = t151r - t380r, t384i = t151i - t380i;
+    const kiss_fft_scalar t385r = t152r + t382r, t385i = t152i + t382i;
+    const kiss_fft_scalar t386r = t152r - t382r, t386i = t152i - t382i;
+    const kiss_fft_scalar t387r = t277r*(kiss_fft_scalar)0.98078528040323043 + t277i*(kiss_fft_scalar)0.19509032201612825, t387i = t277i*(kiss_fft_scalar)0.98078528040323043 - t277r*(kiss_fft_scalar)0.19509032201612825;
+    const kiss_fft_scalar t388r = t358r*(kiss_fft_scalar)0.83146961230254524 + t358i*(kiss_fft_scalar)0.55557023301960218, t388i = t358i*(kiss_fft_scalar)0.83146961230254524 - t358r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t389r = t387r + t388r, t389i = t387i + t388i;
+    const kiss_fft_scalar t390r = t387r - t388r, t390i = t387i - t388i;
+    const kiss_fft_scalar t391r = t390i, t391i = -t390r;
+    const kiss_fft_scalar t392r = t160r + t389r, t392i = t160i + t389i;
+    const kiss_fft_scalar t393r = t160r - t389r, t393i = t160i - t389i;
+    const kiss_fft_scalar t394r = t161r + t391r, t394i = t161i + t391i;
+    const kiss_fft_scalar t395r = t161r - t391r, t395i = t161i - t391i;
+    const kiss_fft_scalar t396r = t286r*(kiss_fft_scalar)0.95694033573220882 + t286i*(kiss_fft_scalar)0.29028467725446233, t396i = t286i*(kiss_fft_scalar)0.95694033573220882 - t286r*(kiss_fft_scalar)0.29028467725446233;
+    const kiss_fft_scalar t397r = t367r*(kiss_fft_scalar)0.63439328416364549 + t367i*(kiss_fft_scalar)0.77301045336273699, t397i = t367i*(kiss_fft_scalar)0.63439328416364549 - t367r*(kiss_fft_scalar)0.77301045336273699;
+    const kiss_fft_scalar t398r = t396r + t397r, t398i = t396i + t397i;
+    const kiss_fft_scalar t399r = t396r - t397r, t399i = t396i - t397i;
+    const kiss_fft_scalar t400r = t399i, t400i = -t399r;
+    const kiss_fft_scalar t401r = t169r + t398r, t401i = t169i + t398i;
+    const kiss_fft_scalar t402r = t169r - t398r, t402i = t169i - t398i;
+    const kiss_fft_scalar t403r = t170r + t400r, t403i = t170i + t400i;
+    const kiss_fft_scalar t404r = t170r - t400r, t404i = t170i - t400i;
+    const kiss_fft_scalar t405r = t261r*(kiss_fft_scalar)0.92387953251128674 + t261i*(kiss_fft_scalar)0.38268343236508978, t405i = t261i*(kiss_fft_scalar)0.92387953251128674 - t261r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t406r = t342r*(kiss_fft_scalar)0.38268343236508984 + t342i*(kiss_fft_scalar)0.92387953251128674, t406i = t342i*(kiss_fft_scalar)0.38268343236508984 - t342r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t407r = t405r + t406r, t407i = t405i + t406i;
+    const kiss_fft_scalar t408r = t405r - t406r, t408i = t405i - t406i;
+    const kiss_fft_scalar t409r = t408i, t409i = -t408r;
+    const kiss_fft_scalar t410r = t178r + t407r, t410i = t178i + t407i;
+    const kiss_fft_scalar t411r = t178r - t407r, t411i = t178i - t407i;
+    const kiss_fft_scalar t412r = t179r + t409r, t412i = t179i + t409i;
+    const kiss_fft_scalar t413r = t179r - t409r, t413i = t179i - t409i;
+    const kiss_fft_scalar t414r = t270r*(kiss_fft_scalar)0.88192126434835505 + t270i*(kiss_fft_scalar)0.47139673682599764, t414i = t270i*(kiss_fft_scalar)0.88192126434835505 - t270r*(kiss_fft_scalar)0.47139673682599764;
+    const kiss_fft_scalar t415r = t351r*(kiss_fft_scalar)0.09801714032956077 + t351i*(kiss_fft_scalar)0.99518472667219682, t415i = t351i*(kiss_fft_scalar)0.09801714032956077 - t351r*(kiss_fft_scalar)0.99518472667219682;
+    const kiss_fft_scalar t416r = t414r + t415r, t416i = t414i + t415i;
+    const kiss_fft_scalar t417r = t414r - t415r, t417i = t414i - t415i;
+    const kiss_fft_scalar t418r = t417i, t418i = -t417r;
+    const kiss_fft_scalar t419r = t187r + t416r, t419i = t187i + t416i;
+    const kiss_fft_scalar t420r = t187r - t416r, t420i = t187i - t416i;
+    const kiss_fft_scalar t421r = t188r + t418r, t421i = t188i + t418i;
+    const kiss_fft_scalar t422r = t188r - t418r, t422i = t188i - t418i;
+    const kiss_fft_scalar t423r = t279r*(kiss_fft_scalar)0.83146961230254524 + t279i*(kiss_fft_scalar)0.55557023301960218, t423i = t279i*(kiss_fft_scalar)0.83146961230254524 - t279r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t424r = t360r*(kiss_fft_scalar)-0.19509032201612819 + t360i*(kiss_fft_scalar)0.98078528040323043, t424i = t360i*(kiss_fft_scalar)-0.19509032201612819 - t360r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t425r = t423r + t424r, t425i = t423i + t424i;
+    const kiss_fft_scalar t426r = t423r - t424r, t426i = t423i - t424i;
+    const kiss_fft_scalar t427r = t426i, t427i = -t426r;
+    const kiss_fft_scalar t428r = t196r + t425r, t428i = t196i + t425i;
+    const kiss_fft_scalar t429r = t196r - t425r, t429i = t196i - t425i;
+    const kiss_fft_scalar t430r = t197r + t427r, t430i = t197i + t427i;
+    const kiss_fft_scalar t431r = t197r - t427r, t431i = t197i - t427i;
+    const kiss_fft_scalar t432r = t288r*(kiss_fft_scalar)0.77301045336273699 + t288i*(kiss_fft_scalar)0.63439328416364549, t432i = t288i*(kiss_fft_scalar)0.77301045336273699 - t288r*(kiss_fft_scalar)0.63439328416364549;
+    const kiss_fft_scalar t433r = t369r*(kiss_fft_scalar)-0.4713967368259977 + t369i*(kiss_fft_scalar)0.88192126434835505, t433i = t369i*(kiss_fft_scalar)-0.4713967368259977 - t369r*(kiss_fft_scalar)0.88192126434835505;
+    const kiss_fft_scalar t434r = t432r + t433r, t434i = t432i + t433i;
+    const kiss_fft_scalar t435r = t432r - t433r, t435i = t432i - t433i;
+    const kiss_fft_scalar t436r = t435i, t436i = -t435r;
+    const kiss_fft_scalar t437r = t205r + t434r, t437i = t205i + t434i;
+    const kiss_fft_scalar t438r = t205r - t434r, t438i = t205i - t434i;
+    const kiss_fft_scalar t439r = t206r + t436r, t439i = t206i + t436i;
+    const kiss_fft_scalar t440r = t206r - t436r, t440i = t206i - t436i;
+    const kiss_fft_scalar t441r = (t260r + t260i)*(kiss_fft_scalar)0.70710678118654757, t441i = (t260i - t260r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t442r = -(t341r - t341i)*(kiss_fft_scalar)0.70710678118654757, t442i = -(t341r + t341i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t443r = t441r + t442r, t443i = t441i + t442i;
+    const kiss_fft_scalar t444r = t441r - t442r, t444i = t441i - t442i;
+    const kiss_fft_scalar t445r = t444i, t445i = -t444r;
+    const kiss_fft_scalar t446r = t144r + t443r, t446i = t144i + t443i;
+    const kiss_fft_scalar t447r = t144r - t443r, t447i = t144i - t443i;
+    const kiss_fft_scalar t448r = t145r + t445r, t448i = t145i + t445i;
+    const kiss_fft_scalar t449r = t145r - t445r, t449i = t145i - t445i;
+    const kiss_fft_scalar t450r = t269r*(kiss_fft_scalar)0.63439328416364549 + t269i*(kiss_fft_scalar)0.77301045336273699, t450i = t269i*(kiss_fft_scalar)0.63439328416364549 - t269r*(kiss_fft_scalar)0.77301045336273699;
+    const kiss_fft_scalar t451r = t350r*(kiss_fft_scalar)-0.88192126434835494 + t350i*(kiss_fft_scalar)0.47139673682599786, t451i = t350i*(kiss_fft_scalar)-0.88192126434835494 - t350r*(kiss_fft_scalar)0.47139673682599786;
+    const kiss_fft_scalar t452r = t450r + t451r, t452i = t450i + t451i;
+    const kiss_fft_scalar t453r = t450r - t451r, t453i = t450i - t451i;
+    const kiss_fft_scalar t454r = t453i, t454i = -t453r;
+    const kiss_fft_scalar t455r = t153r + t452r, t455i = t153i + t452i;
+    const kiss_fft_scalar t456r = t153r - t452r, t456i = t153i - t452i;
+    const kiss_fft_scalar t457r = t154r + t454r, t457i = t154i + t454i;
+    const kiss_fft_scalar t458r = t154r - t454r, t458i = t154i - t454i;
+    const kiss_fft_scalar t459r = t278r*(kiss_fft_scalar)0.55557023301960229 + t278i*(kiss_fft_scalar)0.83146961230254524, t459i = t278i*(kiss_fft_scalar)0.55557023301960229 - t278r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t460r = t359r*(kiss_fft_scalar)-0.98078528040323043 + t359i*(kiss_fft_scalar)0.19509032201612861, t460i = t359i*(kiss_fft_scalar)-0.98078528040323043 - t359r*(kiss_fft_scalar)0.19509032201612861;
+    const kiss_fft_scalar t461r = t459r + t460r, t461i = t459i + t460i;
+    const kiss_fft_scalar t462r = t459r - t460r, t462i = t459i - t460i;
+    const kiss_fft_scalar t463r = t462i, t463i = -t462r;
+    const kiss_fft_scalar t464r = t162r + t461r, t464i = t162i + t461i;
+    const kiss_fft_scalar t465r = t162r - t461r, t465i = t162i - t461i;
+    const kiss_fft_scalar t466r = t163r + t463r, t466i = t163i + t463i;
+    const kiss_fft_scalar t467r = t163r - t463r, t467i = t163i - t463i;
+    const kiss_fft_scalar t468r = t287r*(kiss_fft_scalar)0.47139673682599781 + t287i*(kiss_fft_scalar)0.88192126434835494, t468i = t287i*(kiss_fft_scalar)0.47139673682599781 - t287r*(kiss_fft_scalar)0.88192126434835494;
+    const kiss_fft_scalar t469r = t368r*(kiss_fft_scalar)-0.99518472667219693 - t368i*(kiss_fft_scalar)0.09801714032956059, t469i = t368i*(kiss_fft_scalar)-0.99518472667219693 + t368r*(kiss_fft_scalar)0.09801714032956059;
+    const kiss_fft_scalar t470r = t468r + t469r, t470i = t468i + t469i;
+    const kiss_fft_scalar t471r = t468r - t469r, t471i = t468i - t469i;
+    const kiss_fft_scalar t472r = t471i, t472i = -t471r;
+    const kiss_fft_scalar t473r = t171r + t470r, t473i = t171i + t470i;
+    const kiss_fft_scalar t474r = t171r - t470r, t474i = t171i - t470i;
+    const kiss_fft_scalar t475r = t172r + t472r, t475i = t172i + t472i;
+    const kiss_fft_scalar t476r = t172r - t472r, t476i = t172i - t472i;
+    const kiss_fft_scalar t477r = t262r*(kiss_fft_scalar)0.38268343236508984 + t262i*(kiss_fft_scalar)0.92387953251128674, t477i = t262i*(kiss_fft_scalar)0.38268343236508984 - t262r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t478r = t343r*(kiss_fft_scalar)-0.92387953251128685 - t343i*(kiss_fft_scalar)0.38268343236508967, t478i = t343i*(kiss_fft_scalar)-0.92387953251128685 + t343r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t479r = t477r + t478r, t479i = t477i + t478i;
+    const kiss_fft_scalar t480r = t477r - t478r, t480i = t477i - t478i;
+    const kiss_fft_scalar t481r = t480i, t481i = -t480r;
+    const kiss_fft_scalar t482r = t180r + t479r, t482i = t180i + t479i;
+    const kiss_fft_scalar t483r = t180r - t479r, t483i = t180i - t479i;
+    const kiss_fft_scalar t484r = t181r + t481r, t484i = t181i + t481i;
+    const kiss_fft_scalar t485r = t181r - t481r, t485i = t181i - t481i;
+    const kiss_fft_scalar t486r = t271r*(kiss_fft_scalar)0.29028467725446233 + t271i*(kiss_fft_scalar)0.95694033573220894, t486i = t271i*(kiss_fft_scalar)0.29028467725446233 - t271r*(kiss_fft_scalar)0.95694033573220894;
+    const kiss_fft_scalar t487r = t352r*(kiss_fft_scalar)-0.7730104533627371 - t352i*(kiss_fft_scalar)0.63439328416364527, t487i = t352i*(kiss_fft_scalar)-0.7730104533627371 + t352r*(kiss_fft_scalar)0.63439328416364527;
+    const kiss_fft_scalar t488r = t486r + t487r, t488i = t486i + t487i;
+    const kiss_fft_scalar t489r = t486r - t487r, t489i = t486i - t487i;
+    const kiss_fft_scalar t490r = t489i, t490i = -t489r;
+    const kiss_fft_scalar t491r = t189r + t488r, t491i = t189i + t488i;
+    const kiss_fft_scalar t492r = t189r - t488r, t492i = t189i - t488i;
+    const kiss_fft_scalar t493r = t190r + t490r, t493i = t190i + t490i;
+    const kiss_fft_scalar t494r = t190r - t490r, t494i = t190i - t490i;
+    const kiss_fft_scalar t495r = t280r*(kiss_fft_scalar)0.19509032201612833 + t280i*(kiss_fft_scalar)0.98078528040323043, t495i = t280i*(kiss_fft_scalar)0.19509032201612833 - t280r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t496r = t361r*(kiss_fft_scalar)-0.55557023301960218 - t361i*(kiss_fft_scalar)0.83146961230254524, t496i = t361i*(kiss_fft_scalar)-0.55557023301960218 + t361r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t497r = t495r + t496r, t497i = t495i + t496i;
+    const kiss_fft_scalar t498r = t495r - t496r, t498i = t495i - t496i;
+    const kiss_fft_scalar t499r = t498i, t499i = -t498r;
+    const kiss_fft_scalar t500r = t198r + t497r, t500i = t198i + t497i;
+    const kiss_fft_scalar t501r = t198r - t497r, t501i = t198i - t497i;
+    const kiss_fft_scalar t502r = t199r + t499r, t502i = t199i + t499i;
+    const kiss_fft_scalar t503r = t199r - t499r, t503i = t199i - t499i;
+    const kiss_fft_scalar t504r = t289r*(kiss_fft_scalar)0.09801714032956077 + t289i*(kiss_fft_scalar)0.99518472667219682, t504i = t289i*(kiss_fft_scalar)0.09801714032956077 - t289r*(kiss_fft_scalar)0.99518472667219682;
+    const kiss_fft_scalar t505r = t370r*(kiss_fft_scalar)-0.29028467725446244 - t370i*(kiss_fft_scalar)0.95694033573220882, t505i = t370i*(kiss_fft_scalar)-0.29028467725446244 + t370r*(kiss_fft_scalar)0.95694033573220882;
+    const kiss_fft_scalar t506r = t504r + t505r, t506i = t504i + t505i;
+    const kiss_fft_scalar t507r = t504r - t505r, t507i = t504i - t505i;
+    const kiss_fft_scalar t508r = t507i, t508i = -t507r;
+    const kiss_fft_scalar t509r = t207r + t506r, t509i = t207i + t506i;
+    const kiss_fft_scalar t510r = t207r - t506r, t510i = t207i - t506i;
+    const kiss_fft_scalar t511r = t208r + t508r, t511i = t208i + t508i;
+    const kiss_fft_scalar t512r = t208r - t508r, t512i = t208i - t508i;
+    Fout[0].r = t374r; Fout[0].i = t374i;
+    Fout[1].r = t383r; Fout[1].i = t383i;
+    Fout[2].r = t392r; Fout[2].i = t392i;
+    Fout[3].r = t401r; Fout[3].i = t401i;
+    Fout[4].r = t410r; Fout[4].i = t410i;
+    Fout[5].r = t419r; Fout[5].i = t419i;
+    Fout[6].r = t428r; Fout[6].i = t428i;
+    Fout[7].r = t437r; Fout[7].i = t437i;
+    Fout[8].r = t446r; Fout[8].i = t446i;
+    Fout[9].r = t455r; Fout[9].i = t455i;
+    Fout[10].r = t464r; Fout[10].i = t464i;
+    Fout[11].r = t473r; Fout[11].i = t473i;
+    Fout[12].r = t482r; Fout[12].i = t482i;
+    Fout[13].r = t491r; Fout[13].i = t491i;
+    Fout[14].r = t500r; Fout[14].i = t500i;
+    Fout[15].r = t509r; Fout[15].i = t509i;
+    Fout[16].r = t376r; Fout[16].i = t376i;
+    Fout[17].r = t385r; Fout[17].i = t385i;
+    Fout[18].r = t394r; Fout[18].i = t394i;
+    Fout[19].r = t403r; Fout[19].i = t403i;
+    Fout[20].r = t412r; Fout[20].i = t412i;
+    Fout[21].r = t421r; Fout[21].i = t421i;
+    Fout[22].r = t430r; Fout[22].i = t430i;
+    Fout[23].r = t439r; Fout[23].i = t439i;
+    Fout[24].r = t448r; Fout[24].i = t448i;
+    Fout[25].r = t457r; Fout[25].i = t457i;
+    Fout[26].r = t466r; Fout[26].i = t466i;
+    Fout[27].r = t475r; Fout[27].i = t475i;
+    Fout[28].r = t484r; Fout[28].i = t484i;
+    Fout[29].r = t493r; Fout[29].i = t493i;
+    Fout[30].r = t502r; Fout[30].i = t502i;
+    Fout[31].r = t511r; Fout[31].i = t511i;
+    Fout[32].r = t375r; Fout[32].i = t375i;
+    Fout[33].r = t384r; Fout[33].i = t384i;
+    Fout[34].r = t393r; Fout[34].i = t393i;
+    Fout[35].r = t402r; Fout[35].i = t402i;
+    Fout[36].r = t411r; Fout[36].i = t411i;
+    Fout[37].r = t420r; Fout[37].i = t420i;
+    Fout[38].r = t429r; Fout[38].i = t429i;
+    Fout[39].r = t438r; Fout[39].i = t438i;
+    Fout[40].r = t447r; Fout[40].i = t447i;
+    Fout[41].r = t456r; Fout[41].i = t456i;
+    Fout[42].r = t465r; Fout[42].i = t465i;
+    Fout[43].r = t474r; Fout[43].i = t474i;
+    Fout[44].r = t483r; Fout[44].i = t483i;
+    Fout[45].r = t492r; Fout[45].i = t492i;
+    Fout[46].r = t501r; Fout[46].i = t501i;
+    Fout[47].r = t510r; Fout[47].i = t510i;
+    Fout[48].r = t377r; Fout[48].i = t377i;
+    Fout[49].r = t386r; Fout[49].i = t386i;
+    Fout[50].r = t395r; Fout[50].i = t395i;
+    Fout[51].r = t404r; Fout[51].i = t404i;
+    Fout[52].r = t413r; Fout[52].i = t413i;
+    Fout[53].r = t422r; Fout[53].i = t422i;
+    Fout[54].r = t431r; Fout[54].i = t431i;
+    Fout[55].r = t440r; Fout[55].i = t440i;
+    Fout[56].r = t449r; Fout[56].i = t449i;
+    Fout[57].r = t458r; Fout[57].i = t458i;
+    Fout[58].r = t467r; Fout[58].i = t467i;
+    Fout[59].r = t476r; Fout[59].i = t476i;
+    Fout[60].r = t485r; Fout[60].i = t485i;
+    Fout[61].r = t494r; Fout[61].i = t494i;
+    Fout[62].r = t503r; Fout[62].i = t503i;
+    Fout[63].r = t512r; Fout[63].i = t512i;
+}
+
+static void kf_leaf64_inv(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs)
+{
+    const kiss_fft_scalar t0r = f[0].r + f[32*fs].r, t0i = f[0].i + f[32*fs].i;
+    const kiss_fft_scalar t1r = f[0].r - f[32*fs].r, t1i = f[0].i - f[32*fs].i;
+    const kiss_fft_scalar t2r = f[16*fs].r + f[48*fs].r, t2i = f[16*fs].i + f[48*fs].i;
+    const kiss_fft_scalar t3r = f[16*fs].r - f[48*fs].r, t3i = f[16*fs].i - f[48*fs].i;
+    const kiss_fft_scalar t4r = -t3i, t4i = t3r;
+    const kiss_fft_scalar t5r = t0r + t2r, t5i = t0i + t2i;
+    const kiss_fft_scalar t6r = t0r - t2r, t6i = t0i - t2i;
+    const kiss_fft_scalar t7r = t1r + t4r, t7i = t1i + t4i;
+    const kiss_fft_scalar t8r = t1r - t4r, t8i = t1i - t4i;
+    const kiss_fft_scalar t9r = f[8*fs].r + f[40*fs].r, t9i = f[8*fs].i + f[40*fs].i;
+    const kiss_fft_scalar t10r = f[8*fs].r - f[40*fs].r, t10i = f[8*fs].i - f[40*fs].i;
+    const kiss_fft_scalar t11r = f[24*fs].r + f[56*fs].r, t11i = f[24*fs].i + f[56*fs].i;
+    const kiss_fft_scalar t12r = f[24*fs].r - f[56*fs].r, t12i = f[24*fs].i - f[56*fs].i;
+    const kiss_fft_scalar t13r = t9r + t11r, t13i = t9i + t11i;
+    const kiss_fft_scalar t14r = t9r - t11r, t14i = t9i - t11i;
+    const kiss_fft_scalar t15r = -t14i, t15i = t14r;
+    const kiss_fft_scalar t16r = t5r + t13r, t16i = t5i + t13i;
+    const kiss_fft_scalar t17r = t5r - t13r, t17i = t5i - t13i;
+    const kiss_fft_scalar t18r = t6r + t15r, t18i = t6i + t15i;
+    const kiss_fft_scalar t19r = t6r - t15r, t19i = t6i - t15i;
+    const kiss_fft_scalar t20r = (t10r - t10i)*(kiss_fft_scalar)0.70710678118654757, t20i = (t10r + t10i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t21r = -(t12r + t12i)*(kiss_fft_scalar)0.70710678118654757, t21i = -(t12i - t12r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t22r = t20r + t21r, t22i = t20i + t21i;
+    const kiss_fft_scalar t23r = t20r - t21r, t23i = t20i - t21i;
+    const kiss_fft_scalar t24r = -t23i, t24i = t23r;
+    const kiss_fft_scalar t25r = t7r + t22r, t25i = t7i + t22i;
+    const kiss_fft_scalar t26r = t7r - t22r, t26i = t7i - t22i;
+    const kiss_fft_scalar t27r = t8r + t24r, t27i = t8i + t24i;
+    const kiss_fft_scalar t28r = t8r - t24r, t28i = t8i - t24i;
+    const kiss_fft_scalar t29r = f[4*fs].r + f[36*fs].r, t29i = f[4*fs].i + f[36*fs].i;
+    const kiss_fft_scalar t30r = f[4*fs].r - f[36*fs].r, t30i = f[4*fs].i - f[36*fs].i;
+    const kiss_fft_scalar t31r = f[20*fs].r + f[52*fs].r, t31i = f[20*fs].i + f[52*fs].i;
+    const kiss_fft_scalar t32r = f[20*fs].r - f[52*fs].r, t32i = f[20*fs].i - f[52*fs].i;
+    const kiss_fft_scalar t33r = -t32i, t33i = t32r;
+    const kiss_fft_scalar t34r = t29r + t31r, t34i = t29i + t31i;
+    const kiss_fft_scalar t35r = t29r - t31r, t35i = t29i - t31i;
+    const kiss_fft_scalar t36r = t30r + t33r, t36i = t30i + t33i;
+    const kiss_fft_scalar t37r = t30r - t33r, t37i = t30i - t33i;
+    const kiss_fft_scalar t38r = f[12*fs].r + f[44*fs].r, t38i = f[12*fs].i + f[44*fs].i;
+    const kiss_fft_scalar t39r = f[12*fs].r - f[44*fs].r, t39i = f[12*fs].i - f[44*fs].i;
+    const kiss_fft_scalar t40r = f[28*fs].r + f[60*fs].r, t40i = f[28*fs].i + f[60*fs].i;
+    const kiss_fft_scalar t41r = f[28*fs].r - f[60*fs].r, t41i = f[28*fs].i - f[60*fs].i;
+    const kiss_fft_scalar t42r = -t41i, t42i = t41r;
+    const kiss_fft_scalar t43r = t38r + t40r, t43i = t38i + t40i;
+    const kiss_fft_scalar t44r = t38r - t40r, t44i = t38i - t40i;
+    const kiss_fft_scalar t45r = t39r + t42r, t45i = t39i + t42i;
+    const kiss_fft_scalar t46r = t39r - t42r, t46i = t39i - t42i;
+    const kiss_fft_scalar t47r = t34r + t43r, t47i = t34i + t43i;
+    const kiss_fft_scalar t48r = t34r - t43r, t48i = t34i - t43i;
+    const kiss_fft_scalar t49r = -t48i, t49i = t48r;
+    const kiss_fft_scalar t50r = t16r + t47r, t50i = t16i + t47i;
+    const kiss_fft_scalar t51r = t16r - t47r, t51i = t16i - t47i;
+    const kiss_fft_scalar t52r = t17r + t49r, t52i = t17i + t49i;
+    const kiss_fft_scalar t53r = t17r - t49r, t53i = t17i - t49i;
+    const kiss_fft_scalar t54r = t36r*(kiss_fft_scalar)0.92387953251128674 - t36i*(kiss_fft_scalar)0.38268343236508978, t54i = t36i*(kiss_fft_scalar)0.92387953251128674 + t36r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t55r = t45r*(kiss_fft_scalar)0.38268343236508984 - t45i*(kiss_fft_scalar)0.92387953251128674, t55i = t45i*(kiss_fft_scalar)0.38268343236508984 + t45r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t56r = t54r + t55r, t56i = t54i + t55i;
+    const kiss_fft_scalar t57r = t54r - t55r, t57i = t54i - t55i;
+    const kiss_fft_scalar t58r = -t57i, t58i = t57r;
+    const kiss_fft_scalar t59r = t25r + t56r, t59i = t25i + t56i;
+    const kiss_fft_scalar t60r = t25r - t56r, t60i = t25i - t56i;
+    const kiss_fft_scalar t61r = t26r + t58r, t61i = t26i + t58i;
+    const kiss_fft_scalar t62r = t26r - t58r, t62i = t26i - t58i;
+    const kiss_fft_scalar t63r = (t35r - t35i)*(kiss_fft_scalar)0.70710678118654757, t63i = (t35r + t35i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t64r = -(t44r + t44i)*(kiss_fft_scalar)0.70710678118654757, t64i = -(t44i - t44r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t65r = t63r + t64r, t65i = t63i + t64i;
+    const kiss_fft_scalar t66r = t63r - t64r, t66i = t63i - t64i;
+    const kiss_fft_scalar t67r = -t66i, t67i = t66r;
+    const kiss_fft_scalar t68r = t18r + t65r, t68i = t18i + t65i;
+    const kiss_fft_scalar t69r = t18r - t65r, t69i = t18i - t65i;
+    const kiss_fft_scalar t70r = t19r + t67r, t70i = t19i + t67i;
+    const kiss_fft_scalar t71r = t19r - t67r, t71i = t19i - t67i;
+    const kiss_fft_scalar t72r = t37r*(kiss_fft_scalar)0.38268343236508984 - t37i*(kiss_fft_scalar)0.92387953251128674, t72i = t37i*(kiss_fft_scalar)0.38268343236508984 + t37r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t73r = t46r*(kiss_fft_scalar)-0.92387953251128685 + t46i*(kiss_fft_scalar)0.38268343236508967, t73i = t46i*(kiss_fft_scalar)-0.92387953251128685 - t46r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t74r = t72r + t73r, t74i = t72i + t73i;
+    const kiss_fft_scalar t75r = t72r - t73r, t75i = t72i - t73i;
+    const kiss_fft_scalar t76r = -t75i, t76i = t75r;
+    const kiss_fft_scalar t77r = t27r + t74r, t77i = t27i + t74i;
+    const kiss_fft_scalar t78r = t27r - t74r, t78i = t27i - t74i;
+    const kiss_fft_scalar t79r = t28r + t76r, t79i = t28i + t76i;
+    const kiss_fft_scalar t80r = t28r - t76r, t80i = t28i - t76i;
+    const kiss_fft_scalar t81r = f[2*fs].r + f[34*fs].r, t81i = f[2*fs].i + f[34*fs].i;
+    const kiss_fft_scalar t82r = f[2*fs].r - f[34*fs].r, t82i = f[2*fs].i - f[34*fs].i;
+    const kiss_fft_scalar t83r = f[18*fs].r + f[50*fs].r, t83i = f[18*fs].i + f[50*fs].i;
+    const kiss_fft_scalar t84r = f[18*fs].r - f[50*fs].r, t84i = f[18*fs].i - f[50*fs].i;
+    const kiss_fft_scalar t85r = -t84i, t85i = t84r;
+    const kiss_fft_scalar t86r = t81r + t83r, t86i = t81i + t83i;
+    const kiss_fft_scalar t87r = t81r - t83r, t87i = t81i - t83i;
+    const kiss_fft_scalar t88r = t82r + t85r, t88i = t82i + t85i;
+    const kiss_fft_scalar t89r = t82r - t85r, t89i = t82i - t85i;
+    const kiss_fft_scalar t90r = f[10*fs].r + f[42*fs].r, t90i = f[10*fs].i + f[42*fs].i;
+    const kiss_fft_scalar t91r = f[10*fs].r - f[42*fs].r, t91i = f[10*fs].i - f[42*fs].i;
+    const kiss_fft_scalar t92r = f[26*fs].r + f[58*fs].r, t92i = f[26*fs].i + f[58*fs].i;
+    const kiss_fft_scalar t93r = f[26*fs].r - f[58*fs].r, t93i = f[26*fs].i - f[58*fs].i;
+    const kiss_fft_scalar t94r = t90r + t92r, t94i = t90i + t92i;
+    const kiss_fft_scalar t95r = t90r - t92r, t95i = t90i - t92i;
+    const kiss_fft_scalar t96r = -t95i, t96i = t95r;
+    const kiss_fft_scalar t97r = t86r + t94r, t97i = t86i + t94i;
+    const kiss_fft_scalar t98r = t86r - t94r, t98i = t86i - t94i;
+    const kiss_fft_scalar t99r = t87r + t96r, t99i = t87i + t96i;
+    const kiss_fft_scalar t100r = t87r - t96r, t100i = t87i - t96i;
+    const kiss_fft_scalar t101r = (t91r - t91i)*(kiss_fft_scalar)0.70710678118654757, t101i = (t91r + t91i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t102r = -(t93r + t93i)*(kiss_fft_scalar)0.70710678118654757, t102i = -(t93i - t93r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t103r = t101r + t102r, t103i = t101i + t102i;
+    const kiss_fft_scalar t104r = t101r - t102r, t104i = t101i - t102i;
+    const kiss_fft_scalar t105r = -t104i, t105i = t104r;
+    const kiss_fft_scalar t106r = t88r + t103r, t106i = t88i + t103i;
+    const kiss_fft_scalar t107r = t88r - t103r, t107i = t88i - t103i;
+    const kiss_fft_scalar t108r = t89r + t105r, t108i = t89i + t105i;
+    const kiss_fft_scalar t109r = t89r - t105r, t109i = t89i - t105i;
+    const kiss_fft_scalar t110r = f[6*fs].r + f[38*fs].r, t110i = f[6*fs].i + f[38*fs].i;
+    const kiss_fft_scalar t111r = f[6*fs].r - f[38*fs].r, t111i = f[6*fs].i - f[38*fs].i;
+    const kiss_fft_scalar t112r = f[22*fs].r + f[54*fs].r, t112i = f[22*fs].i + f[54*fs].i;
+    const kiss_fft_scalar t113r = f[22*fs].r - f[54*fs].r, t113i = f[22*fs].i - f[54*fs].i;
+    const kiss_fft_scalar t114r = -t113i, t114i = t113r;
+    const kiss_fft_scalar t115r = t110r + t112r, t115i = t110i + t112i;
+    const kiss_fft_scalar t116r = t110r - t112r, t116i = t110i - t112i;
+    const kiss_fft_scalar t117r = t111r + t114r, t117i = t111i + t114i;
+    const kiss_fft_scalar t118r = t111r - t114r, t118i = t111i - t114i;
+    const kiss_fft_scalar t119r = f[14*fs].r + f[46*fs].r, t119i = f[14*fs].i + f[46*fs].i;
+    const kiss_fft_scalar t120r = f[14*fs].r - f[46*fs].r, t120i = f[14*fs].i - f[46*fs].i;
+    const kiss_fft_scalar t121r = f[30*fs].r + f[62*fs].r, t121i = f[30*fs].i + f[62*fs].i;
+    const kiss_fft_scalar t122r = f[30*fs].r - f[62*fs].r, t122i = f[30*fs].i - f[62*fs].i;
+    const kiss_fft_scalar t123r = t119r + t121r, t123i = t119i + t121i;
+    const kiss_fft_scalar t124r = t119r - t121r, t124i = t119i - t121i;
+    const kiss_fft_scalar t125r = -t124i, t125i = t124r;
+    const kiss_fft_scalar t126r = t115r + t123r, t126i = t115i + t123i;
+    const kiss_fft_scalar t127r = t115r - t123r, t127i = t115i - t123i;
+    const kiss_fft_scalar t128r = t116r + t125r, t128i = t116i + t125i;
+    const kiss_fft_scalar t129r = t116r - t125r, t129i = t116i - t125i;
+    const kiss_fft_scalar t130r = (t120r - t120i)*(kiss_fft_scalar)0.70710678118654757, t130i = (t120r + t120i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t131r = -(t122r + t122i)*(kiss_fft_scalar)0.70710678118654757, t131i = -(t122i - t122r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t132r = t130r + t131r, t132i = t130i + t131i;
+    const kiss_fft_scalar t133r = t130r - t131r, t133i = t130i - t131i;
+    const kiss_fft_scalar t134r = -t133i, t134i = t133r;
+    const kiss_fft_scalar t135r = t117r + t132r, t135i = t117i + t132i;
+    const kiss_fft_scalar t136r = t117r - t132r, t136i = t117i - t132i;
+    const kiss_fft_scalar t137r = t118r + t134r, t137i = t118i + t134i;
+    const kiss_fft_scalar t138r = t118r - t134r, t138i = t118i - t134i;
+    const kiss_fft_scalar t139r = t97r + t126r, t139i = t97i + t126i;
+    const kiss_fft_scalar t140r = t97r - t126r, t140i = t97i - t126i;
+    const kiss_fft_scalar t141r = -t140i, t141i = t140r;
+    const kiss_fft_scalar t142r = t50r + t139r, t142i = t50i + t139i;
+    const kiss_fft_scalar t143r = t50r - t139r, t143i = t50i - t139i;
+    const kiss_fft_scalar t144r = t51r + t141r, t144i = t51i + t141i;
+    const kiss_fft_scalar t145r = t51r - t141r, t145i = t51i - t141i;
+    const kiss_fft_scalar t146r = t106r*(kiss_fft_scalar)0.98078528040323043 - t106i*(kiss_fft_scalar)0.19509032201612825, t146i = t106i*(kiss_fft_scalar)0.98078528040323043 + t106r*(kiss_fft_scalar)0.19509032201612825;
+    const kiss_fft_scalar t147r = t135r*(kiss_fft_scalar)0.83146961230254524 - t135i*(kiss_fft_scalar)0.55557023301960218, t147i = t135i*(kiss_fft_scalar)0.83146961230254524 + t135r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t148r = t146r + t147r, t148i = t146i + t147i;
+    const kiss_fft_scalar t149r = t146r - t147r, t149i = t146i - t147i;
+    const kiss_fft_scalar t150r = -t149i, t150i = t149r;
+    const kiss_fft_scalar t151r = t59r + t148r, t151i = t59i + t148i;
+    const kiss_fft_scalar t152r = t59r - t148r, t152i = t59i - t148i;
+    const kiss_fft_scalar t153r = t60r + t150r, t153i = t60i + t150i;
+    const kiss_fft_scalar t154r = t60r - t150r, t154i = t60i - t150i;
+    const kiss_fft_scalar t155r = t99r*(kiss_fft_scalar)0.92387953251128674 - t99i*(kiss_fft_scalar)0.38268343236508978, t155i = t99i*(kiss_fft_scalar)0.92387953251128674 + t99r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t156r = t128r*(kiss_fft_scalar)0.38268343236508984 - t128i*(kiss_fft_scalar)0.92387953251128674, t156i = t128i*(kiss_fft_scalar)0.38268343236508984 + t128r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t157r = t155r + t156r, t157i = t155i + t156i;
+    const kiss_fft_scalar t158r = t155r - t156r, t158i = t155i - t156i;
+    const kiss_fft_scalar t159r = -t158i, t159i = t158r;
+    const kiss_fft_scalar t160r = t68r + t157r, t160i = t68i + t157i;
+    const kiss_fft_scalar t161r = t68r - t157r, t161i = t68i - t157i;
+    const kiss_fft_scalar t162r = t69r + t159r, t162i = t69i + t159i;
+    const kiss_fft_scalar t163r = t69r - t159r, t163i = t69i - t159i;
+    const kiss_fft_scalar t164r = t108r*(kiss_fft_scalar)0.83146961230254524 - t108i*(kiss_fft_scalar)0.55557023301960218, t164i = t108i*(kiss_fft_scalar)0.83146961230254524 + t108r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t165r = t137r*(kiss_fft_scalar)-0.19509032201612819 - t137i*(kiss_fft_scalar)0.98078528040323043, t165i = t137i*(kiss_fft_scalar)-0.19509032201612819 + t137r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t166r = t164r + t165r, t166i = t164i + t165i;
+    const kiss_fft_scalar t167r = t164r - t165r, t167i = t164i - t165i;
+    const kiss_fft_scalar t168r = -t167i, t168i = t167r;
+    const kiss_fft_scalar t169r = t77r + t166r, t169i = t77i + t166i;
+    const kiss_fft_scalar t170r = t77r - t166r, t170i = t77i - t166i;
+    const kiss_fft_scalar t171r = t78r + t168r, t171i = t78i + t168i;
+    const kiss_fft_scalar t172r = t78r - t168r, t172i = t78i - t168i;
+    const kiss_fft_scalar t173r = (t98r - t98i)*(kiss_fft_scalar)0.70710678118654757, t173i = (t98r + t98i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t174r = -(t127r + t127i)*(kiss_fft_scalar)0.70710678118654757, t174i = -(t127i - t127r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t175r = t173r + t174r, t175i = t173i + t174i;
+    const kiss_fft_scalar t176r = t173r - t174r, t176i = t173i - t174i;
+    const kiss_fft_scalar t177r = -t176i, t177i = t176r;
+    const kiss_fft_scalar t178r = t52r + t175r, t178i = t52i + t175i;
+    const kiss_fft_scalar t179r = t52r - t175r, t179i = t52i - t175i;
+    const kiss_fft_scalar t180r = t53r + t177r, t180i = t53i + t177i;
+    const kiss_fft_scalar t181r = t53r - t177r, t181i = t53i - t177i;
+    const kiss_fft_scalar t182r = t107r*(kiss_fft_scalar)0.55557023301960229 - t107i*(kiss_fft_scalar)0.83146961230254524, t182i = t107i*(kiss_fft_scalar)0.55557023301960229 + t107r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t183r = t136r*(kiss_fft_scalar)-0.98078528040323043 - t136i*(kiss_fft_scalar)0.19509032201612861, t183i = t136i*(kiss_fft_scalar)-0.98078528040323043 + t136r*(kiss_fft_scalar)0.19509032201612861;
+    const kiss_fft_scalar t184r = t182r + t183r, t184i = t182i + t183i;
+    const kiss_fft_scalar t185r = t182r - t183r, t185i = t182i - t183i;
+    const kiss_fft_scalar t186r = -t185i, t186i = t185r;
+    const kiss_fft_scalar t187r = t61r + t184r, t187i = t61i + t184i;
+    const kiss_fft_scalar t188r = t61r - t184r, t188i = t61i - t184i;
+    const kiss_fft_scalar t189r = t62r + t186r, t189i = t62i + t186i;
+    const kiss_fft_scalar t190r = t62r - t186r, t190i = t62i - t186i;
+    const kiss_fft_scalar t191r = t100r*(kiss_fft_scalar)0.38268343236508984 - t100i*(kiss_fft_scalar)0.92387953251128674, t191i = t100i*(kiss_fft_scalar)0.38268343236508984 + t100r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t192r = t129r*(kiss_fft_scalar)-0.92387953251128685 + t129i*(kiss_fft_scalar)0.38268343236508967, t192i = t129i*(kiss_fft_scalar)-0.92387953251128685 - t129r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t193r = t191r + t192r, t193i = t191i + t192i;
+    const kiss_fft_scalar t194r = t191r - t192r, t194i = t191i - t192i;
+    const kiss_fft_scalar t195r = -t194i, t195i = t194r;
+    const kiss_fft_scalar t196r = t70r + t193r, t196i = t70i + t193i;
+    const kiss_fft_scalar t197r = t70r - t193r, t197i = t70i - t193i;
+    const kiss_fft_scalar t198r = t71r + t195r, t198i = t71i + t195i;
+    const kiss_fft_scalar t199r = t71r - t195r, t199i = t71i - t195i;
+    const kiss_fft_scalar t200r = t109r*(kiss_fft_scalar)0.19509032201612833 - t109i*(kiss_fft_scalar)0.98078528040323043, t200i = t109i*(kiss_fft_scalar)0.19509032201612833 + t109r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t201r = t138r*(kiss_fft_scalar)-0.55557023301960218 + t138i*(kiss_fft_scalar)0.83146961230254524, t201i = t138i*(kiss_fft_scalar)-0.55557023301960218 - t138r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t202r = t200r + t201r, t202i = t200i + t201i;
+    const kiss_fft_scalar t203r = t200r - t201r, t203i = t200i - t201i;
+    const kiss_fft_scalar t204r = -t203i, t204i = t203r;
+    const kiss_fft_scalar t205r = t79r + t202r, t205i = t79i + t202i;
+    const kiss_fft_scalar t206r = t79r - t202r, t206i = t79i - t202i;
+    const kiss_fft_scalar t207r = t80r + t204r, t207i = t80i + t204i;
+    const kiss_fft_scalar t208r = t80r - t204r, t208i = t80i - t204i;
+    const kiss_fft_scalar t209r = f[fs].r + f[33*fs].r, t209i = f[fs].i + f[33*fs].i;
+    const kiss_fft_scalar t210r = f[fs].r - f[33*fs].r, t210i = f[fs].i - f[33*fs].i;
+    const kiss_fft_scalar t211r = f[17*fs].r + f[49*fs].r, t211i = f[17*fs].i + f[49*fs].i;
+    const kiss_fft_scalar t212r = f[17*fs].r - f[49*fs].r, t212i = f[17*fs].i - f[49*fs].i;
+    const kiss_fft_scalar t213r = -t212i, t213i = t212r;
+    const kiss_fft_scalar t214r = t209r + t211r, t214i = t209i + t211i;
+    const kiss_fft_scalar t215r = t209r - t211r, t215i = t209i - t211i;
+    const kiss_fft_scalar t216r = t210r + t213r, t216i = t210i + t213i;
+    const kiss_fft_scalar t217r = t210r - t213r, t217i = t210i - t213i;
+    const kiss_fft_scalar t218r = f[9*fs].r + f[41*fs].r, t218i = f[9*fs].i + f[41*fs].i;
+    const kiss_fft_scalar t219r = f[9*fs].r - f[41*fs].r, t219i = f[9*fs].i - f[41*fs].i;
+    const kiss_fft_scalar t220r = f[25*fs].r + f[57*fs].r, t220i = f[25*fs].i + f[57*fs].i;
+    const kiss_fft_scalar t221r = f[25*fs].r - f[57*fs].r, t221i = f[25*fs].i - f[57*fs].i;
+    const kiss_fft_scalar t222r = t218r + t220r, t222i = t218i + t220i;
+    const kiss_fft_scalar t223r = t218r - t220r, t223i = t218i - t220i;
+    const kiss_fft_scalar t224r = -t223i, t224i = t223r;
+    const kiss_fft_scalar t225r = t214r + t222r, t225i = t214i + t222i;
+    const kiss_fft_scalar t226r = t214r - t222r, t226i = t214i - t222i;
+    const kiss_fft_scalar t227r = t215r + t224r, t227i = t215i + t224i;
+    const kiss_fft_scalar t228r = t215r - t224r, t228i = t215i - t224i;
+    const kiss_fft_scalar t229r = (t219r - t219i)*(kiss_fft_scalar)0.70710678118654757, t229i = (t219r + t219i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t230r = -(t221r + t221i)*(kiss_fft_scalar)0.70710678118654757, t230i = -(t221i - t221r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t231r = t229r + t230r, t231i = t229i + t230i;
+    const kiss_fft_scalar t232r = t229r - t230r, t232i = t229i - t230i;
+    const kiss_fft_scalar t233r = -t232i, t233i = t232r;
+    const kiss_fft_scalar t234r = t216r + t231r, t234i = t216i + t231i;
+    const kiss_fft_scalar t235r = t216r - t231r, t235i = t216i - t231i;
+    const kiss_fft_scalar t236r = t217r + t233r, t236i = t217i + t233i;
+    const kiss_fft_scalar t237r = t217r - t233r, t237i = t217i - t233i;
+    const kiss_fft_scalar t238r = f[5*fs].r + f[37*fs].r, t238i = f[5*fs].i + f[37*fs].i;
+    const kiss_fft_scalar t239r = f[5*fs].r - f[37*fs].r, t239i = f[5*fs].i - f[37*fs].i;
+    const kiss_fft_scalar t240r = f[21*fs].r + f[53*fs].r, t240i = f[21*fs].i + f[53*fs].i;
+    const kiss_fft_scalar t241r = f[21*fs].r - f[53*fs].r, t241i = f[21*fs].i - f[53*fs].i;
+    const kiss_fft_scalar t242r = -t241i, t242i = t241r;
+    const kiss_fft_scalar t243r = t238r + t240r, t243i = t238i + t240i;
+    const kiss_fft_scalar t244r = t238r - t240r, t244i = t238i - t240i;
+    const kiss_fft_scalar t245r = t239r + t242r, t245i = t239i + t242i;
+    const kiss_fft_scalar t246r = t239r - t242r, t246i = t239i - t242i;
+    const kiss_fft_scalar t247r = f[13*fs].r + f[45*fs].r, t247i = f[13*fs].i + f[45*fs].i;
+    const kiss_fft_scalar t248r = f[13*fs].r - f[45*fs].r, t248i = f[13*fs].i - f[45*fs].i;
+    const kiss_fft_scalar t249r = f[29*fs].r + f[61*fs].r, t249i = f[29*fs].i + f[61*fs].i;
+    const kiss_fft_scalar t250r = f[29*fs].r - f[61*fs].r, t250i = f[29*fs].i - f[61*fs].i;
+    const kiss_fft_scalar t251r = -t250i, t251i = t250r;
+    const kiss_fft_scalar t252r = t247r + t249r, t252i = t247i + t249i;
+    const kiss_fft_scalar t253r = t247r - t249r, t253i = t247i - t249i;
+    const kiss_fft_scalar t254r = t248r + t251r, t254i = t248i + t251i;
+    const kiss_fft_scalar t255r = t248r - t251r, t255i = t248i - t251i;
+    const kiss_fft_scalar t256r = t243r + t252r, t256i = t243i + t252i;
+    const kiss_fft_scalar t257r = t243r - t252r, t257i = t243i - t252i;
+    const kiss_fft_scalar t258r = -t257i, t258i = t257r;
+    const kiss_fft_scalar t259r = t225r + t256r, t259i = t225i + t256i;
+    const kiss_fft_scalar t260r = t225r - t256r, t260i = t225i - t256i;
+    const kiss_fft_scalar t261r = t226r + t258r, t261i = t226i + t258i;
+    const kiss_fft_scalar t262r = t226r - t258r, t262i = t226i - t258i;
+    const kiss_fft_scalar t263r = t245r*(kiss_fft_scalar)0.92387953251128674 - t245i*(kiss_fft_scalar)0.38268343236508978, t263i = t245i*(kiss_fft_scalar)0.92387953251128674 + t245r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t264r = t254r*(kiss_fft_scalar)0.38268343236508984 - t254i*(kiss_fft_scalar)0.92387953251128674, t264i = t254i*(kiss_fft_scalar)0.38268343236508984 + t254r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t265r = t263r + t264r, t265i = t263i + t264i;
+    const kiss_fft_scalar t266r = t263r - t264r, t266i = t263i - t264i;
+    const kiss_fft_scalar t267r = -t266i, t267i = t266r;
+    const kiss_fft_scalar t268r = t234r + t265r, t268i = t234i + t265i;
+    const kiss_fft_scalar t269r = t234r - t265r, t269i = t234i - t265i;
+    const kiss_fft_scalar t270r = t235r + t267r, t270i = t235i + t267i;
+    const kiss_fft_scalar t271r = t235r - t267r, t271i = t235i - t267i;
+    const kiss_fft_scalar t272r = (t244r - t244i)*(kiss_fft_scalar)0.70710678118654757, t272i = (t244r + t244i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t273r = -(t253r + t253i)*(kiss_fft_scalar)0.70710678118654757, t273i = -(t253i - t253r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t274r = t272r + t273r, t274i = t272i + t273i;
+    const kiss_fft_scalar t275r = t272r - t273r, t275i = t272i - t273i;
+    const kiss_fft_scalar t276r = -t275i, t276i = t275r;
+    const kiss_fft_scalar t277r = t227r + t274r, t277i = t227i + t274i;
+    const kiss_fft_scalar t278r = t227r - t274r, t278i = t227i - t274i;
+    const kiss_fft_scalar t279r = t228r + t276r, t279i = t228i + t276i;
+    const kiss_fft_scalar t280r = t228r - t276r, t280i = t228i - t276i;
+    const kiss_fft_scalar t281r = t246r*(kiss_fft_scalar)0.38268343236508984 - t246i*(kiss_fft_scalar)0.92387953251128674, t281i = t246i*(kiss_fft_scalar)0.38268343236508984 + t246r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t282r = t255r*(kiss_fft_scalar)-0.92387953251128685 + t255i*(kiss_fft_scalar)0.38268343236508967, t282i = t255i*(kiss_fft_scalar)-0.92387953251128685 - t255r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t283r = t281r + t282r, t283i = t281i + t282i;
+    const kiss_fft_scalar t284r = t281r - t282r, t284i = t281i - t282i;
+    const kiss_fft_scalar t285r = -t284i, t285i = t284r;
+    const kiss_fft_scalar t286r = t236r + t283r, t286i = t236i + t283i;
+    const kiss_fft_scalar t287r = t236r - t283r, t287i = t236i - t283i;
+    const kiss_fft_scalar t288r = t237r + t285r, t288i = t237i + t285i;
+    const kiss_fft_scalar t289r = t237r - t285r, t289i = t237i - t285i;
+    const kiss_fft_scalar t290r = f[3*fs].r + f[35*fs].r, t290i = f[3*fs].i + f[35*fs].i;
+    const kiss_fft_scalar t291r = f[3*fs].r - f[35*fs].r, t291i = f[3*fs].i - f[35*fs].i;
+    const kiss_fft_scalar t292r = f[19*fs].r + f[51*fs].r, t292i = f[19*fs].i + f[51*fs].i;
+    const kiss_fft_scalar t293r = f[19*fs].r - f[51*fs].r, t293i = f[19*fs].i - f[51*fs].i;
+    const kiss_fft_scalar t294r = -t293i, t294i = t293r;
+    const kiss_fft_scalar t295r = t290r + t292r, t295i = t290i + t292i;
+    const kiss_fft_scalar t296r = t290r - t292r, t296i = t290i - t292i;
+    const kiss_fft_scalar t297r = t291r + t294r, t297i = t291i + t294i;
+    const kiss_fft_scalar t298r = t291r - t294r, t298i = t291i - t294i;
+    const kiss_fft_scalar t299r = f[11*fs].r + f[43*fs].r, t299i = f[11*fs].i + f[43*fs].i;
+    const kiss_fft_scalar t300r = f[11*fs].r - f[43*fs].r, t300i = f[11*fs].i - f[43*fs].i;
+    const kiss_fft_scalar t301r = f[27*fs].r + f[59*fs].r, t301i = f[27*fs].i + f[59*fs].i;
+    const kiss_fft_scalar t302r = f[27*fs].r - f[59*fs].r, t302i = f[27*fs].i - f[59*fs].i;
+    const kiss_fft_scalar t303r = t299r + t301r, t303i = t299i + t301i;
+    const kiss_fft_scalar t304r = t299r - t301r, t304i = t299i - t301i;
+    const kiss_fft_scalar t305r = -t304i, t305i = t304r;
+    const kiss_fft_scalar t306r = t295r + t303r, t306i = t295i + t303i;
+    const kiss_fft_scalar t307r = t295r - t303r, t307i = t295i - t303i;
+    const kiss_fft_scalar t308r = t296r + t305r, t308i = t296i + t305i;
+    const kiss_fft_scalar t309r = t296r - t305r, t309i = t296i - t305i;
+    const kiss_fft_scalar t310r = (t300r - t300i)*(kiss_fft_scalar)0.70710678118654757, t310i = (t300r + t300i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t311r = -(t302r + t302i)*(kiss_fft_scalar)0.70710678118654757, t311i = -(t302i - t302r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t312r = t310r + t311r, t312i = t310i + t311i;
+    const kiss_fft_scalar t313r = t310r - t311r, t313i = t310i - t311i;
+    const kiss_fft_scalar t314r = -t313i, t314i = t313r;
+    const kiss_fft_scalar t315r = t297r + t312r, t315i = t297i + t312i;
+    const kiss_fft_scalar t316r = t297r - t312r, t316i = t297i - t312i;
+    const kiss_fft_scalar t317r = t298r + t314r, t317i = t298i + t314i;
+    const kiss_fft_scalar t318r = t298r - t314r, t318i = t298i - t314i;
+    const kiss_fft_scalar t319r = f[7*fs].r + f[39*fs].r, t319i = f[7*fs].i + f[39*fs].i;
+    const kiss_fft_scalar t320r = f[7*fs].r - f[39*fs].r, t320i = f[7*fs].i - f[39*fs].i;
+    const kiss_fft_scalar t321r = f[23*fs].r + f[55*fs].r, t321i = f[23*fs].i + f[55*fs].i;
+    const kiss_fft_scalar t322r = f[23*fs].r - f[55*fs].r, t322i = f[23*fs].i - f[55*fs].i;
+    const kiss_fft_scalar t323r = -t322i, t323i = t322r;
+    const kiss_fft_scalar t324r = t319r + t321r, t324i = t319i + t321i;
+    const kiss_fft_scalar t325r = t319r - t321r, t325i = t319i - t321i;
+    const kiss_fft_scalar t326r = t320r + t323r, t326i = t320i + t323i;
+    const kiss_fft_scalar t327r = t320r - t323r, t327i = t320i - t323i;
+    const kiss_fft_scalar t328r = f[15*fs].r + f[47*fs].r, t328i = f[15*fs].i + f[47*fs].i;
+    const kiss_fft_scalar t329r = f[15*fs].r - f[47*fs].r, t329i = f[15*fs].i - f[47*fs].i;
+    const kiss_fft_scalar t330r = f[31*fs].r + f[63*fs].r, t330i = f[31*fs].i + f[63*fs].i;
+    const kiss_fft_scalar t331r = f[31*fs].r - f[63*fs].r, t331i = f[31*fs].i - f[63*fs].i;
+    const kiss_fft_scalar t332r = -t331i, t332i = t331r;
+    const kiss_fft_scalar t333r = t328r + t330r, t333i = t328i + t330i;
+    const kiss_fft_scalar t334r = t328r - t330r, t334i = t328i - t330i;
+    const kiss_fft_scalar t335r = t329r + t332r, t335i = t329i + t332i;
+    const kiss_fft_scalar t336r = t329r - t332r, t336i = t329i - t332i;
+    const kiss_fft_scalar t337r = t324r + t333r, t337i = t324i + t333i;
+    const kiss_fft_scalar t338r = t324r - t333r, t338i = t324i - t333i;
+    const kiss_fft_scalar t339r = -t338i, t339i = t338r;
+    const kiss_fft_scalar t340r = t306r + t337r, t340i = t306i + t337i;
+    const kiss_fft_scalar t341r = t306r - t337r, t341i = t306i - t337i;
+    const kiss_fft_scalar t342r = t307r + t339r, t342i = t307i + t339i;
+    const kiss_fft_scalar t343r = t307r - t339r, t343i = t307i - t339i;
+    const kiss_fft_scalar t344r = t326r*(kiss_fft_scalar)0.92387953251128674 - t326i*(kiss_fft_scalar)0.38268343236508978, t344i = t326i*(kiss_fft_scalar)0.92387953251128674 + t326r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t345r = t335r*(kiss_fft_scalar)0.38268343236508984 - t335i*(kiss_fft_scalar)0.92387953251128674, t345i = t335i*(kiss_fft_scalar)0.38268343236508984 + t335r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t346r = t344r + t345r, t346i = t344i + t345i;
+    const kiss_fft_scalar t347r = t344r - t345r, t347i = t344i - t345i;
+    const kiss_fft_scalar t348r = -t347i, t348i = t347r;
+    const kiss_fft_scalar t349r = t315r + t346r, t349i = t315i + t346i;
+    const kiss_fft_scalar t350r = t315r - t346r, t350i = t315i - t346i;
+    const kiss_fft_scalar t351r = t316r + t348r, t351i = t316i + t348i;
+    const kiss_fft_scalar t352r = t316r - t348r, t352i = t316i - t348i;
+    const kiss_fft_scalar t353r = (t325r - t325i)*(kiss_fft_scalar)0.70710678118654757, t353i = (t325r + t325i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t354r = -(t334r + t334i)*(kiss_fft_scalar)0.70710678118654757, t354i = -(t334i - t334r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t355r = t353r + t354r, t355i = t353i + t354i;
+    const kiss_fft_scalar t356r = t353r - t354r, t356i = t353i - t354i;
+    const kiss_fft_scalar t357r = -t356i, t357i = t356r;
+    const kiss_fft_scalar t358r = t308r + t355r, t358i = t308i + t355i;
+    const kiss_fft_scalar t359r = t308r - t355r, t359i = t308i - t355i;
+    const kiss_fft_scalar t360r = t309r + t357r, t360i = t309i + t357i;
+    const kiss_fft_scalar t361r = t309r - t357r, t361i = t309i - t357i;
+    const kiss_fft_scalar t362r = t327r*(kiss_fft_scalar)0.38268343236508984 - t327i*(kiss_fft_scalar)0.92387953251128674, t362i = t327i*(kiss_fft_scalar)0.38268343236508984 + t327r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t363r = t336r*(kiss_fft_scalar)-0.92387953251128685 + t336i*(kiss_fft_scalar)0.38268343236508967, t363i = t336i*(kiss_fft_scalar)-0.92387953251128685 - t336r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t364r = t362r + t363r, t364i = t362i + t363i;
+    const kiss_fft_scalar t365r = t362r - t363r, t365i = t362i - t363i;
+    const kiss_fft_scalar t366r = -t365i, t366i = t365r;
+    const kiss_fft_scalar t367r = t317r + t364r, t367i = t317i + t364i;
+    const kiss_fft_scalar t368r = t317r - t364r, t368i = t317i - t364i;
+    const kiss_fft_scalar t369r = t318r + t366r, t369i = t318i + t366i;
+    const kiss_fft_scalar t370r = t318r - t366r, t370i = t318i - t366i;
+    const kiss_fft_scalar t371r = t259r + t340r, t371i = t259i + t340i;
+    const kiss_fft_scalar t372r = t259r - t340r, t372i = t259i - t340i;
+    const kiss_fft_scalar t373r = -t372i, t373i = t372r;
+    const kiss_fft_scalar t374r = t142r + t371r, t374i = t142i + t371i;
+    const kiss_fft_scalar t375r = t142r - t371r, t375i = t142i - t371i;
+    const kiss_fft_scalar t376r = t143r + t373r, t376i = t143i + t373i;
+    const kiss_fft_scalar t377r = t143r - t373r, t377i = t143i - t373i;
+    const kiss_fft_scalar t378r = t268r*(kiss_fft_scalar)0.99518472667219693 - t268i*(kiss_fft_scalar)0.098017140329560604, t378i = t268i*(kiss_fft_scalar)0.99518472667219693 + t268r*(kiss_fft_scalar)0.098017140329560604;
+    const kiss_fft_scalar t379r = t349r*(kiss_fft_scalar)0.95694033573220882 - t349i*(kiss_fft_scalar)0.29028467725446233, t379i = t349i*(kiss_fft_scalar)0.95694033573220882 + t349r*(kiss_fft_scalar)0.29028467725446233;
+    const kiss_fft_scalar t380r = t378r + t379r, t380i = t378i + t379i;
+    const kiss_fft_scalar t381r = t378r - t379r, t381i = t378i - t379i;
+    const kiss_fft_scalar t382r = -t381i, t382i = t381r;
+    const kiss_fft_scalar t383r = t151r + t380r, t383i = t151i + t380i;
+    const kiss_fft_scalar t384r = t151r - t380r, t384i = t151i - t380i;
+    const kiss_fft_scalar t385r = t152r + t382r, t385i = t152i + t382i;
+    const kiss_fft_scalar t386r = t152r - t382r, t386i = t152i - t382i;
+    const kiss_fft_scalar t387r = t277r*(kiss_fft_scalar)0.98078528040323043 - t277i*(kiss_fft_scalar)0.19509032201612825, t387i = t277i*(kiss_fft_scalar)0.98078528040323043 + t277r*(kiss_fft_scalar)0.19509032201612825;
+    const kiss_fft_scalar t388r = t358r*(kiss_fft_scalar)0.83146961230254524 - t358i*(kiss_fft_scalar)0.55557023301960218, t388i = t358i*(kiss_fft_scalar)0.83146961230254524 + t358r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t389r = t387r + t388r, t389i = t387i + t388i;
+    const kiss_fft_scalar t390r = t387r - t388r, t390i = t387i - t388i;
+    const kiss_fft_scalar t391r = -t390i, t391i = t390r;
+    const kiss_fft_scalar t392r = t160r + t389r, t392i = t160i + t389i;
+    const kiss_fft_scalar t393r = t160r - t389r, t393i = t160i - t389i;
+    const kiss_fft_scalar t394r = t161r + t391r, t394i = t161i + t391i;
+    const kiss_fft_scalar t395r = t161r - t391r, t395i = t161i - t391i;
+    const kiss_fft_scalar t396r = t286r*(kiss_fft_scalar)0.95694033573220882 - t286i*(kiss_fft_scalar)0.29028467725446233, t396i = t286i*(kiss_fft_scalar)0.95694033573220882 + t286r*(kiss_fft_scalar)0.29028467725446233;
+    const kiss_fft_scalar t397r = t367r*(kiss_fft_scalar)0.63439328416364549 - t367i*(kiss_fft_scalar)0.77301045336273699, t397i = t367i*(kiss_fft_scalar)0.63439328416364549 + t367r*(kiss_fft_scalar)0.77301045336273699;
+    const kiss_fft_scalar t398r = t396r + t397r, t398i = t396i + t397i;
+    const kiss_fft_scalar t399r = t396r - t397r, t399i = t396i - t397i;
+    const kiss_fft_scalar t400r = -t399i, t400i = t399r;
+    const kiss_fft_scalar t401r = t169r + t398r, t401i = t169i + t398i;
+    const kiss_fft_scalar t402r = t169r - t398r, t402i = t169i - t398i;
+    const kiss_fft_scalar t403r = t170r + t400r, t403i = t170i + t400i;
+    const kiss_fft_scalar t404r = t170r - t400r, t404i = t170i - t400i;
+    const kiss_fft_scalar t405r = t261r*(kiss_fft_scalar)0.92387953251128674 - t261i*(kiss_fft_scalar)0.38268343236508978, t405i = t261i*(kiss_fft_scalar)0.92387953251128674 + t261r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t406r = t342r*(kiss_fft_scalar)0.38268343236508984 - t342i*(kiss_fft_scalar)0.92387953251128674, t406i = t342i*(kiss_fft_scalar)0.38268343236508984 + t342r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t407r = t405r + t406r, t407i = t405i + t406i;
+    const kiss_fft_scalar t408r = t405r - t406r, t408i = t405i - t406i;
+    const kiss_fft_scalar t409r = -t408i, t409i = t408r;
+    const kiss_fft_scalar t410r = t178r + t407r, t410i = t178i + t407i;
+    const kiss_fft_scalar t411r = t178r - t407r, t411i = t178i - t407i;
+    const kiss_fft_scalar t412r = t179r + t409r, t412i = t179i + t409i;
+    const kiss_fft_scalar t413r = t179r - t409r, t413i = t179i - t409i;
+    const kiss_fft_scalar t414r = t270r*(kiss_fft_scalar)0.88192126434835505 - t270i*(kiss_fft_scalar)0.47139673682599764, t414i = t270i*(kiss_fft_scalar)0.88192126434835505 + t270r*(kiss_fft_scalar)0.47139673682599764;
+    const kiss_fft_scalar t415r = t351r*(kiss_fft_scalar)0.09801714032956077 - t351i*(kiss_fft_scalar)0.99518472667219682, t415i = t351i*(kiss_fft_scalar)0.09801714032956077 + t351r*(kiss_fft_scalar)0.99518472667219682;
+    const kiss_fft_scalar t416r = t414r + t415r, t416i = t414i + t415i;
+    const kiss_fft_scalar t417r = t414r - t415r, t417i = t414i - t415i;
+    const kiss_fft_scalar t418r = -t417i, t418i = t417r;
+    const kiss_fft_scalar t419r = t187r + t416r, t419i = t187i + t416i;
+    const kiss_fft_scalar t420r = t187r - t416r, t420i = t187i - t416i;
+    const kiss_fft_scalar t421r = t188r + t418r, t421i = t188i + t418i;
+    const kiss_fft_scalar t422r = t188r - t418r, t422i = t188i - t418i;
+    const kiss_fft_scalar t423r = t279r*(kiss_fft_scalar)0.83146961230254524 - t279i*(kiss_fft_scalar)0.55557023301960218, t423i = t279i*(kiss_fft_scalar)0.83146961230254524 + t279r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t424r = t360r*(kiss_fft_scalar)-0.19509032201612819 - t360i*(kiss_fft_scalar)0.98078528040323043, t424i = t360i*(kiss_fft_scalar)-0.19509032201612819 + t360r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t425r = t423r + t424r, t425i = t423i + t424i;
+    const kiss_fft_scalar t426r = t423r - t424r, t426i = t423i - t424i;
+    const kiss_fft_scalar t427r = -t426i, t427i = t426r;
+    const kiss_fft_scalar t428r = t196r + t425r, t428i = t196i + t425i;
+    const kiss_fft_scalar t429r = t196r - t425r, t429i = t196i - t425i;
+    const kiss_fft_scalar t430r = t197r + t427r, t430i = t197i + t427i;
+    const kiss_fft_scalar t431r = t197r - t427r, t431i = t197i - t427i;
+    const kiss_fft_scalar t432r = t288r*(kiss_fft_scalar)0.77301045336273699 - t288i*(kiss_fft_scalar)0.63439328416364549, t432i = t288i*(kiss_fft_scalar)0.77301045336273699 + t288r*(kiss_fft_scalar)0.63439328416364549;
+    const kiss_fft_scalar t433r = t369r*(kiss_fft_scalar)-0.4713967368259977 - t369i*(kiss_fft_scalar)0.88192126434835505, t433i = t369i*(kiss_fft_scalar)-0.4713967368259977 + t369r*(kiss_fft_scalar)0.88192126434835505;
+    const kiss_fft_scalar t434r = t432r + t433r, t434i = t432i + t433i;
+    const kiss_fft_scalar t435r = t432r - t433r, t435i = t432i - t433i;
+    const kiss_fft_scalar t436r = -t435i, t436i = t435r;
+    const kiss_fft_scalar t437r = t205r + t434r, t437i = t205i + t434i;
+    const kiss_fft_scalar t438r = t205r - t434r, t438i = t205i - t434i;
+    const kiss_fft_scalar t439r = t206r + t436r, t439i = t206i + t436i;
+    const kiss_fft_scalar t440r = t206r - t436r, t440i = t206i - t436i;
+    const kiss_fft_scalar t441r = (t260r - t260i)*(kiss_fft_scalar)0.70710678118654757, t441i = (t260r + t260i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t442r = -(t341r + t341i)*(kiss_fft_scalar)0.70710678118654757, t442i = -(t341i - t341r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t443r = t441r + t442r, t443i = t441i + t442i;
+    const kiss_fft_scalar t444r = t441r - t442r, t444i = t441i - t442i;
+    const kiss_fft_scalar t445r = -t444i, t445i = t444r;
+    const kiss_fft_scalar t446r = t144r + t443r, t446i = t144i + t443i;
+    const kiss_fft_scalar t447r = t144r - t443r, t447i = t144i - t443i;
+    const kiss_fft_scalar t448r = t145r + t445r, t448i = t145i + t445i;
+    const kiss_fft_scalar t449r = t145r - t445r, t449i = t145i - t445i;
+    const kiss_fft_scalar t450r = t269r*(kiss_fft_scalar)0.63439328416364549 - t269i*(kiss_fft_scalar)0.77301045336273699, t450i = t269i*(kiss_fft_scalar)0.63439328416364549 + t269r*(kiss_fft_scalar)0.77301045336273699;
+    const kiss_fft_scalar t451r = t350r*(kiss_fft_scalar)-0.88192126434835494 - t350i*(kiss_fft_scalar)0.47139673682599786, t451i = t350i*(kiss_fft_scalar)-0.88192126434835494 + t350r*(kiss_fft_scalar)0.47139673682599786;
+    const kiss_fft_scalar t452r = t450r + t451r, t452i = t450i + t451i;
+    const kiss_fft_scalar t453r = t450r - t451r, t453i = t450i - t451i;
+    const kiss_fft_scalar t454r = -t453i, t454i = t453r;
+    const kiss_fft_scalar t455r = t153r + t452r, t455i = t153i + t452i;
+    const kiss_fft_scalar t456r = t153r - t452r, t456i = t153i - t452i;
+    const kiss_fft_scalar t457r = t154r + t454r, t457i = t154i + t454i;
+    const kiss_fft_scalar t458r = t154r - t454r, t458i = t154i - t454i;
+    const kiss_fft_scalar t459r = t278r*(kiss_fft_scalar)0.55557023301960229 - t278i*(kiss_fft_scalar)0.83146961230254524, t459i = t278i*(kiss_fft_scalar)0.55557023301960229 + t278r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t460r = t359r*(kiss_fft_scalar)-0.98078528040323043 - t359i*(kiss_fft_scalar)0.19509032201612861, t460i = t359i*(kiss_fft_scalar)-0.98078528040323043 + t359r*(kiss_fft_scalar)0.19509032201612861;
+    const kiss_fft_scalar t461r = t459r + t460r, t461i = t459i + t460i;
+    const kiss_fft_scalar t462r = t459r - t460r, t462i = t459i - t460i;
+    const kiss_fft_scalar t463r = -t462i, t463i = t462r;
+    const kiss_fft_scalar t464r = t162r + t461r, t464i = t162i + t461i;
+    const kiss_fft_scalar t465r = t162r - t461r, t465i = t162i - t461i;
+    const kiss_fft_scalar t466r = t163r + t463r, t466i = t163i + t463i;
+    const kiss_fft_scalar t467r = t163r - t463r, t467i = t163i - t463i;
+    const kiss_fft_scalar t468r = t287r*(kiss_fft_scalar)0.47139673682599781 - t287i*(kiss_fft_scalar)0.88192126434835494, t468i = t287i*(kiss_fft_scalar)0.47139673682599781 + t287r*(kiss_fft_scalar)0.88192126434835494;
+    const kiss_fft_scalar t469r = t368r*(kiss_fft_scalar)-0.99518472667219693 + t368i*(kiss_fft_scalar)0.09801714032956059, t469i = t368i*(kiss_fft_scalar)-0.99518472667219693 - t368r*(kiss_fft_scalar)0.09801714032956059;
+    const kiss_fft_scalar t470r = t468r + t469r, t470i = t468i + t469i;
+    const kiss_fft_scalar t471r = t468r - t469r, t471i = t468i - t469i;
+    const kiss_fft_scalar t472r = -t471i, t472i = t471r;
+    const kiss_fft_scalar t473r = t171r + t470r, t473i = t171i + t470i;
+    const kiss_fft_scalar t474r = t171r - t470r, t474i = t171i - t470i;
+    const kiss_fft_scalar t475r = t172r + t472r, t475i = t172i + t472i;
+    const kiss_fft_scalar t476r = t172r - t472r, t476i = t172i - t472i;
+    const kiss_fft_scalar t477r = t262r*(kiss_fft_scalar)0.38268343236508984 - t262i*(kiss_fft_scalar)0.92387953251128674, t477i = t262i*(kiss_fft_scalar)0.38268343236508984 + t262r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t478r = t343r*(kiss_fft_scalar)-0.92387953251128685 + t343i*(kiss_fft_scalar)0.38268343236508967, t478i = t343i*(kiss_fft_scalar)-0.92387953251128685 - t343r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t479r = t477r + t478r, t479i = t477i + t478i;
+    const kiss_fft_scalar t480r = t477r - t478r, t480i = t477i - t478i;
+    const kiss_fft_scalar t481r = -t480i, t481i = t480r;
+    const kiss_fft_scalar t482r = t180r + t479r, t482i = t180i + t479i;
+    const kiss_fft_scalar t483r = t180r - t479r, t483i = t180i - t479i;
+    const kiss_fft_scalar t484r = t181r + t481r, t484i = t181i + t481i;
+    const kiss_fft_scalar t485r = t181r - t481r, t485i = t181i - t481i;
+    const kiss_fft_scalar t486r = t271r*(kiss_fft_scalar)0.29028467725446233 - t271i*(kiss_fft_scalar)0.95694033573220894, t486i = t271i*(kiss_fft_scalar)0.29028467725446233 + t271r*(kiss_fft_scalar)0.95694033573220894;
+    const kiss_fft_scalar t487r = t352r*(kiss_fft_scalar)-0.7730104533627371 + t352i*(kiss_fft_scalar)0.63439328416364527, t487i = t352i*(kiss_fft_scalar)-0.7730104533627371 - t352r*(kiss_fft_scalar)0.63439328416364527;
+    const kiss_fft_scalar t488r = t486r + t487r, t488i = t486i + t487i;
+    const kiss_fft_scalar t489r = t486r - t487r, t489i = t486i - t487i;
+    const kiss_fft_scalar t490r = -t489i, t490i = t489r;
+    const kiss_fft_scalar t491r = t189r + t488r, t491i = t189i + t488i;
+    const kiss_fft_scalar t492r = t189r - t488r, t492i = t189i - t488i;
+    const kiss_fft_scalar t493r = t190r + t490r, t493i = t190i + t490i;
+    const kiss_fft_scalar t494r = t190r - t490r, t494i = t190i - t490i;
+    const kiss_fft_scalar t495r = t280r*(kiss_fft_scalar)0.19509032201612833 - t280i*(kiss_fft_scalar)0.98078528040323043, t495i = t280i*(kiss_fft_scalar)0.19509032201612833 + t280r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t496r = t361r*(kiss_fft_scalar)-0.55557023301960218 + t361i*(kiss_fft_scalar)0.83146961230254524, t496i = t361i*(kiss_fft_scalar)-0.55557023301960218 - t361r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t497r = t495r + t496r, t497i = t495i + t496i;
+    const kiss_fft_scalar t498r = t495r - t496r, t498i = t495i - t496i;
+    const kiss_fft_scalar t499r = -t498i, t499i = t498r;
+    const kiss_fft_scalar t500r = t198r + t497r, t500i = t198i + t497i;
+    const kiss_fft_scalar t501r = t198r - t497r, t501i = t198i - t497i;
+    const kiss_fft_scalar t502r = t199r + t499r, t502i = t199i + t499i;
+    const kiss_fft_scalar t503r = t199r - t499r, t503i = t199i - t499i;
+    const kiss_fft_scalar t504r = t289r*(kiss_fft_scalar)0.09801714032956077 - t289i*(kiss_fft_scalar)0.99518472667219682, t504i = t289i*(kiss_fft_scalar)0.09801714032956077 + t289r*(kiss_fft_scalar)0.99518472667219682;
+    const kiss_fft_scalar t505r = t370r*(kiss_fft_scalar)-0.29028467725446244 + t370i*(kiss_fft_scalar)0.95694033573220882, t505i = t370i*(kiss_fft_scalar)-0.29028467725446244 - t370r*(kiss_fft_scalar)0.95694033573220882;
+    const kiss_fft_scalar t506r = t504r + t505r, t506i = t504i + t505i;
+    const kiss_fft_scalar t507r = t504r - t505r, t507i = t504i - t505i;
+    const kiss_fft_scalar t508r = -t507i, t508i = t507r;
+    const kiss_fft_scalar t509r = t207r + t506r, t509i = t207i + t506i;
+    const kiss_fft_scalar t510r = t207r - t506r, t510i = t207i - t506i;
+    const kiss_fft_scalar t511r = t208r + t508r, t511i = t208i + t508i;
+    const kiss_fft_scalar t512r = t208r - t508r, t512i = t208i - t508i;
+    Fout[0].r = t374r; Fout[0].i = t374i;
+    Fout[1].r = t383r; Fout[1].i = t383i;
+    Fout[2].r = t392r; Fout[2].i = t392i;
+    Fout[3].r = t401r; Fout[3].i = t401i;
+    Fout[4].r = t410r; Fout[4].i = t410i;
+    Fout[5].r = t419r; Fout[5].i = t419i;
+    Fout[6].r = t428r; Fout[6].i = t428i;
+    Fout[7].r = t437r; Fout[7].i = t437i;
+    Fout[8].r = t446r; Fout[8].i = t446i;
+    Fout[9].r = t455r; Fout[9].i = t455i;
+    Fout[10].r = t464r; Fout[10].i = t464i;
+    Fout[11].r = t473r; Fout[11].i = t473i;
+    Fout[12].r = t482r; Fout[12].i = t482i;
+    Fout[13].r = t491r; Fout[13].i = t491i;
+    Fout[14].r = t500r; Fout[14].i = t500i;
+    Fout[15].r = t509r; Fout[15].i = t509i;
+    Fout[16].r = t376r; Fout[16].i = t376i;
+    Fout[17].r = t385r; Fout[17].i = t385i;
+    Fout[18].r = t394r; Fout[18].i = t394i;
+    Fout[19].r = t403r; Fout[19].i = t403i;
+    Fout[20].r = t412r; Fout[20].i = t412i;
+    Fout[21].r = t421r; Fout[21].i = t421i;
+    Fout[22].r = t430r; Fout[22].i = t430i;
+    Fout[23].r = t439r; Fout[23].i = t439i;
+    Fout[24].r = t448r; Fout[24].i = t448i;
+    Fout[25].r = t457r; Fout[25].i = t457i;
+    Fout[26].r = t466r; Fout[26].i = t466i;
+    Fout[27].r = t475r; Fout[27].i = t475i;
+    Fout[28].r = t484r; Fout[28].i = t484i;
+    Fout[29].r = t493r; Fout[29].i = t493i;
+    Fout[30].r = t502r; Fout[30].i = t502i;
+    Fout[31].r = t511r; Fout[31].i = t511i;
+    Fout[32].r = t375r; Fout[32].i = t375i;
+    Fout[33].r = t384r; Fout[33].i = t384i;
+    Fout[34].r = t393r; Fout[34].i = t393i;
+    Fout[35].r = t402r; Fout[35].i = t402i;
+    Fout[36].r = t411r; Fout[36].i = t411i;
+    Fout[37].r = t420r; Fout[37].i = t420i;
+    Fout[38].r = t429r; Fout[38].i = t429i;
+    Fout[39].r = t438r; Fout[39].i = t438i;
+    Fout[40].r = t447r; Fout[40].i = t447i;
+    Fout[41].r = t456r; Fout[41].i = t456i;
+    Fout[42].r = t465r; Fout[42].i = t465i;
+    Fout[43].r = t474r; Fout[43].i = t474i;
+    Fout[44].r = t483r; Fout[44].i = t483i;
+    Fout[45].r = t492r; Fout[45].i = t492i;
+    Fout[46].r = t501r; Fout[46].i = t501i;
+    Fout[47].r = t510r; Fout[47].i = t510i;
+    Fout[48].r = t377r; Fout[48].i = t377i;
+    Fout[49].r = t386r; Fout[49].i = t386i;
+    Fout[50].r = t395r; Fout[50].i = t395i;
+    Fout[51].r = t404r; Fout[51].i = t404i;
+    Fout[52].r = t413r; Fout[52].i = t413i;
+    Fout[53].r = t422r; Fout[53].i = t422i;
+    Fout[54].r = t431r; Fout[54].i = t431i;
+    Fout[55].r = t440r; Fout[55].i = t440i;
+    Fout[56].r = t449r; Fout[56].i = t449i;
+    Fout[57].r = t458r; Fout[57].i = t458i;
+    Fout[58].r = t467r; Fout[58].i = t467i;
+    Fout[59].r = t476r; Fout[59].i = t476i;
+    Fout[60].r = t485r; Fout[60].i = t485i;
+    Fout[61].r = t494r; Fout[61].i = t494i;
+    Fout[62].r = t503r; Fout[62].i = t503i;
+    Fout[63].r = t512r; Fout[63].i = t512i;
+}
+
+static void kf_leaf32_fwd(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs)
+{
+    const kiss_fft_scalar t0r = f[0].r + f[16*fs].r, t0i = f[0].i + f[16*fs].i;
+    const kiss_fft_scalar t1r = f[0].r - f[16*fs].r, t1i = f[0].i - f[16*fs].i;
+    const kiss_fft_scalar t2r = f[8*fs].r + f[24*fs].r, t2i = f[8*fs].i + f[24*fs].i;
+    const kiss_fft_scalar t3r = f[8*fs].r - f[24*fs].r, t3i = f[8*fs].i - f[24*fs].i;
+    const kiss_fft_scalar t4r = t3i, t4i = -t3r;
+    const kiss_fft_scalar t5r = t0r + t2r, t5i = t0i + t2i;
+    const kiss_fft_scalar t6r = t0r - t2r, t6i = t0i - t2i;
+    const kiss_fft_scalar t7r = t1r + t4r, t7i = t1i + t4i;
+    const kiss_fft_scalar t8r = t1r - t4r, t8i = t1i - t4i;
+    const kiss_fft_scalar t9r = f[4*fs].r + f[20*fs].r, t9i = f[4*fs].i + f[20*fs].i;
+    const kiss_fft_scalar t10r = f[4*fs].r - f[20*fs].r, t10i = f[4*fs].i - f[20*fs].i;
+    const kiss_fft_scalar t11r = f[12*fs].r + f[28*fs].r, t11i = f[12*fs].i + f[28*fs].i;
+    const kiss_fft_scalar t12r = f[12*fs].r - f[28*fs].r, t12i = f[12*fs].i - f[28*fs].i;
+    const kiss_fft_scalar t13r = t9r + t11r, t13i = t9i + t11i;
+    const kiss_fft_scalar t14r = t9r - t11r, t14i = t9i - t11i;
+    const kiss_fft_scalar t15r = t14i, t15i = -t14r;
+    const kiss_fft_scalar t16r = t5r + t13r, t16i = t5i + t13i;
+    const kiss_fft_scalar t17r = t5r - t13r, t17i = t5i - t13i;
+    const kiss_fft_scalar t18r = t6r + t15r, t18i = t6i + t15i;
+    const kiss_fft_scalar t19r = t6r - t15r, t19i = t6i - t15i;
+    const kiss_fft_scalar t20r = (t10r + t10i)*(kiss_fft_scalar)0.70710678118654757, t20i = (t10i - t10r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t21r = -(t12r - t12i)*(kiss_fft_scalar)0.70710678118654757, t21i = -(t12r + t12i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t22r = t20r + t21r, t22i = t20i + t21i;
+    const kiss_fft_scalar t23r = t20r - t21r, t23i = t20i - t21i;
+    const kiss_fft_scalar t24r = t23i, t24i = -t23r;
+    const kiss_fft_scalar t25r = t7r + t22r, t25i = t7i + t22i;
+    const kiss_fft_scalar t26r = t7r - t22r, t26i = t7i - t22i;
+    const kiss_fft_scalar t27r = t8r + t24r, t27i = t8i + t24i;
+    const kiss_fft_scalar t28r = t8r - t24r, t28i = t8i - t24i;
+    const kiss_fft_scalar t29r = f[2*fs].r + f[18*fs].r, t29i = f[2*fs].i + f[18*fs].i;
+    const kiss_fft_scalar t30r = f[2*fs].r - f[18*fs].r, t30i = f[2*fs].i - f[18*fs].i;
+    const kiss_fft_scalar t31r = f[10*fs].r + f[26*fs].r, t31i = f[10*fs].i + f[26*fs].i;
+    const kiss_fft_scalar t32r = f[10*fs].r - f[26*fs].r, t32i = f[10*fs].i - f[26*fs].i;
+    const kiss_fft_scalar t33r = t32i, t33i = -t32r;
+    const kiss_fft_scalar t34r = t29r + t31r, t34i = t29i + t31i;
+    const kiss_fft_scalar t35r = t29r - t31r, t35i = t29i - t31i;
+    const kiss_fft_scalar t36r = t30r + t33r, t36i = t30i + t33i;
+    const kiss_fft_scalar t37r = t30r - t33r, t37i = t30i - t33i;
+    const kiss_fft_scalar t38r = f[6*fs].r + f[22*fs].r, t38i = f[6*fs].i + f[22*fs].i;
+    const kiss_fft_scalar t39r = f[6*fs].r - f[22*fs].r, t39i = f[6*fs].i - f[22*fs].i;
+    const kiss_fft_scalar t40r = f[14*fs].r + f[30*fs].r, t40i = f[14*fs].i + f[30*fs].i;
+    const kiss_fft_scalar t41r = f[14*fs].r - f[30*fs].r, t41i = f[14*fs].i - f[30*fs].i;
+    const kiss_fft_scalar t42r = t41i, t42i = -t41r;
+    const kiss_fft_scalar t43r = t38r + t40r, t43i = t38i + t40i;
+    const kiss_fft_scalar t44r = t38r - t40r, t44i = t38i - t40i;
+    const kiss_fft_scalar t45r = t39r + t42r, t45i = t39i + t42i;
+    const kiss_fft_scalar t46r = t39r - t42r, t46i = t39i - t42i;
+    const kiss_fft_scalar t47r = t34r + t43r, t47i = t34i + t43i;
+    const kiss_fft_scalar t48r = t34r - t43r, t48i = t34i - t43i;
+    const kiss_fft_scalar t49r = t48i, t49i = -t48r;
+    const kiss_fft_scalar t50r = t16r + t47r, t50i = t16i + t47i;
+    const kiss_fft_scalar t51r = t16r - t47r, t51i = t16i - t47i;
+    const kiss_fft_scalar t52r = t17r + t49r, t52i = t17i + t49i;
+    const kiss_fft_scalar t53r = t17r - t49r, t53i = t17i - t49i;
+    const kiss_fft_scalar t54r = t36r*(kiss_fft_scalar)0.92387953251128674 + t36i*(kiss_fft_scalar)0.38268343236508978, t54i = t36i*(kiss_fft_scalar)0.92387953251128674 - t36r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t55r = t45r*(kiss_fft_scalar)0.38268343236508984 + t45i*(kiss_fft_scalar)0.92387953251128674, t55i = t45i*(kiss_fft_scalar)0.38268343236508984 - t45r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t56r = t54r + t55r, t56i = t54i + t55i;
+    const kiss_fft_scalar t57r = t54r - t55r, t57i = t54i - t55i;
+    const kiss_fft_scalar t58r = t57i, t58i = -t57r;
+    const kiss_fft_scalar t59r = t25r + t56r, t59i = t25i + t56i;
+    const kiss_fft_scalar t60r = t25r - t56r, t60i = t25i - t56i;
+    const kiss_fft_scalar t61r = t26r + t58r, t61i = t26i + t58i;
+    const kiss_fft_scalar t62r = t26r - t58r, t62i = t26i - t58i;
+    const kiss_fft_scalar t63r = (t35r + t35i)*(kiss_fft_scalar)0.70710678118654757, t63i = (t35i - t35r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t64r = -(t44r - t44i)*(kiss_fft_scalar)0.70710678118654757, t64i = -(t44r + t44i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t65r = t63r + t64r, t65i = t63i + t64i;
+    const kiss_fft_scalar t66r = t63r - t64r, t66i = t63i - t64i;
+    const kiss_fft_scalar t67r = t66i, t67i = -t66r;
+    const kiss_fft_scalar t68r = t18r + t65r, t68i = t18i + t65i;
+    const kiss_fft_scalar t69r = t18r - t65r, t69i = t18i - t65i;
+    const kiss_fft_scalar t70r = t19r + t67r, t70i = t19i + t67i;
+    const kiss_fft_scalar t71r = t19r - t67r, t71i = t19i - t67i;
+    const kiss_fft_scalar t72r = t37r*(kiss_fft_scalar)0.38268343236508984 + t37i*(kiss_fft_scalar)0.92387953251128674, t72i = t37i*(kiss_fft_scalar)0.38268343236508984 - t37r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t73r = t46r*(kiss_fft_scalar)-0.92387953251128685 - t46i*(kiss_fft_scalar)0.38268343236508967, t73i = t46i*(kiss_fft_scalar)-0.92387953251128685 + t46r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t74r = t72r + t73r, t74i = t72i + t73i;
+    const kiss_fft_scalar t75r = t72r - t73r, t75i = t72i - t73i;
+    const kiss_fft_scalar t76r = t75i, t76i = -t75r;
+    const kiss_fft_scalar t77r = t27r + t74r, t77i = t27i + t74i;
+    const kiss_fft_scalar t78r = t27r - t74r, t78i = t27i - t74i;
+    const kiss_fft_scalar t79r = t28r + t76r, t79i = t28i + t76i;
+    const kiss_fft_scalar t80r = t28r - t76r, t80i = t28i - t76i;
+    const kiss_fft_scalar t81r = f[fs].r + f[17*fs].r, t81i = f[fs].i + f[17*fs].i;
+    const kiss_fft_scalar t82r = f[fs].r - f[17*fs].r, t82i = f[fs].i - f[17*fs].i;
+    const kiss_fft_scalar t83r = f[9*fs].r + f[25*fs].r, t83i = f[9*fs].i + f[25*fs].i;
+    const kiss_fft_scalar t84r = f[9*fs].r - f[25*fs].r, t84i = f[9*fs].i - f[25*fs].i;
+    const kiss_fft_scalar t85r = t84i, t85i = -t84r;
+    const kiss_fft_scalar t86r = t81r + t83r, t86i = t81i + t83i;
+    const kiss_fft_scalar t87r = t81r - t83r, t87i = t81i - t83i;
+    const kiss_fft_scalar t88r = t82r + t85r, t88i = t82i + t85i;
+    const kiss_fft_scalar t89r = t82r - t85r, t89i = t82i - t85i;
+    const kiss_fft_scalar t90r = f[5*fs].r + f[21*fs].r, t90i = f[5*fs].i + f[21*fs].i;
+    const kiss_fft_scalar t91r = f[5*fs].r - f[21*fs].r, t91i = f[5*fs].i - f[21*fs].i;
+    const kiss_fft_scalar t92r = f[13*fs].r + f[29*fs].r, t92i = f[13*fs].i + f[29*fs].i;
+    const kiss_fft_scalar t93r = f[13*fs].r - f[29*fs].r, t93i = f[13*fs].i - f[29*fs].i;
+    const kiss_fft_scalar t94r = t90r + t92r, t94i = t90i + t92i;
+    const kiss_fft_scalar t95r = t90r - t92r, t95i = t90i - t92i;
+    const kiss_fft_scalar t96r = t95i, t96i = -t95r;
+    const kiss_fft_scalar t97r = t86r + t94r, t97i = t86i + t94i;
+    const kiss_fft_scalar t98r = t86r - t94r, t98i = t86i - t94i;
+    const kiss_fft_scalar t99r = t87r + t96r, t99i = t87i + t96i;
+    const kiss_fft_scalar t100r = t87r - t96r, t100i = t87i - t96i;
+    const kiss_fft_scalar t101r = (t91r + t91i)*(kiss_fft_scalar)0.70710678118654757, t101i = (t91i - t91r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t102r = -(t93r - t93i)*(kiss_fft_scalar)0.70710678118654757, t102i = -(t93r + t93i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t103r = t101r + t102r, t103i = t101i + t102i;
+    const kiss_fft_scalar t104r = t101r - t102r, t104i = t101i - t102i;
+    const kiss_fft_scalar t105r = t104i, t105i = -t104r;
+    const kiss_fft_scalar t106r = t88r + t103r, t106i = t88i + t103i;
+    const kiss_fft_scalar t107r = t88r - t103r, t107i = t88i - t103i;
+    const kiss_fft_scalar t108r = t89r + t105r, t108i = t89i + t105i;
+    const kiss_fft_scalar t109r = t89r - t105r, t109i = t89i - t105i;
+    const kiss_fft_scalar t110r = f[3*fs].r + f[19*fs].r, t110i = f[3*fs].i + f[19*fs].i;
+    const kiss_fft_scalar t111r = f[3*fs].r - f[19*fs].r, t111i = f[3*fs].i - f[19*fs].i;
+    const kiss_fft_scalar t112r = f[11*fs].r + f[27*fs].r, t112i = f[11*fs].i + f[27*fs].i;
+    const kiss_fft_scalar t113r = f[11*fs].r - f[27*fs].r, t113i = f[11*fs].i - f[27*fs].i;
+    const kiss_fft_scalar t114r = t113i, t114i = -t113r;
+    const kiss_fft_scalar t115r = t110r + t112r, t115i = t110i + t112i;
+    const kiss_fft_scalar t116r = t110r - t112r, t116i = t110i - t112i;
+    const kiss_fft_scalar t117r = t111r + t114r, t117i = t111i + t114i;
+    const kiss_fft_scalar t118r = t111r - t114r, t118i = t111i - t114i;
+    const kiss_fft_scalar t119r = f[7*fs].r + f[23*fs].r, t119i = f[7*fs].i + f[23*fs].i;
+    const kiss_fft_scalar t120r = f[7*fs].r - f[23*fs].r, t120i = f[7*fs].i - f[23*fs].i;
+    const kiss_fft_scalar t121r = f[15*fs].r + f[31*fs].r, t121i = f[15*fs].i + f[31*fs].i;
+    const kiss_fft_scalar t122r = f[15*fs].r - f[31*fs].r, t122i = f[15*fs].i - f[31*fs].i;
+    const kiss_fft_scalar t123r = t119r + t121r, t123i = t119i + t121i;
+    const kiss_fft_scalar t124r = t119r - t121r, t124i = t119i - t121i;
+    const kiss_fft_scalar t125r = t124i, t125i = -t124r;
+    const kiss_fft_scalar t126r = t115r + t123r, t126i = t115i + t123i;
+    const kiss_fft_scalar t127r = t115r - t123r, t127i = t115i - t123i;
+    const kiss_fft_scalar t128r = t116r + t125r, t128i = t116i + t125i;
+    const kiss_fft_scalar t129r = t116r - t125r, t129i = t116i - t125i;
+    const kiss_fft_scalar t130r = (t120r + t120i)*(kiss_fft_scalar)0.70710678118654757, t130i = (t120i - t120r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t131r = -(t122r - t122i)*(kiss_fft_scalar)0.70710678118654757, t131i = -(t122r + t122i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t132r = t130r + t131r, t132i = t130i + t131i;
+    const kiss_fft_scalar t133r = t130r - t131r, t133i = t130i - t131i;
+    const kiss_fft_scalar t134r = t133i, t134i = -t133r;
+    const kiss_fft_scalar t135r = t117r + t132r, t135i = t117i + t132i;
+    const kiss_fft_scalar t136r = t117r - t132r, t136i = t117i - t132i;
+    const kiss_fft_scalar t137r = t118r + t134r, t137i = t118i + t134i;
+    const kiss_fft_scalar t138r = t118r - t134r, t138i = t118i - t134i;
+    const kiss_fft_scalar t139r = t97r + t126r, t139i = t97i + t126i;
+    const kiss_fft_scalar t140r = t97r - t126r, t140i = t97i - t126i;
+    const kiss_fft_scalar t141r = t140i, t141i = -t140r;
+    const kiss_fft_scalar t142r = t50r + t139r, t142i = t50i + t139i;
+    const kiss_fft_scalar t143r = t50r - t139r, t143i = t50i - t139i;
+    const kiss_fft_scalar t144r = t51r + t141r, t144i = t51i + t141i;
+    const kiss_fft_scalar t145r = t51r - t141r, t145i = t51i - t141i;
+    const kiss_fft_scalar t146r = t106r*(kiss_fft_scalar)0.98078528040323043 + t106i*(kiss_fft_scalar)0.19509032201612825, t146i = t106i*(kiss_fft_scalar)0.98078528040323043 - t106r*(kiss_fft_scalar)0.19509032201612825;
+    const kiss_fft_scalar t147r = t135r*(kiss_fft_scalar)0.83146961230254524 + t135i*(kiss_fft_scalar)0.55557023301960218, t147i = t135i*(kiss_fft_scalar)0.83146961230254524 - t135r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t148r = t146r + t147r, t148i = t146i + t147i;
+    const kiss_fft_scalar t149r = t146r - t147r, t149i = t146i - t147i;
+    const kiss_fft_scalar t150r = t149i, t150i = -t149r;
+    const kiss_fft_scalar t151r = t59r + t148r, t151i = t59i + t148i;
+    const kiss_fft_scalar t152r = t59r - t148r, t152i = t59i - t148i;
+    const kiss_fft_scalar t153r = t60r + t150r, t153i = t60i + t150i;
+    const kiss_fft_scalar t154r = t60r - t150r, t154i = t60i - t150i;
+    const kiss_fft_scalar t155r = t99r*(kiss_fft_scalar)0.92387953251128674 + t99i*(kiss_fft_scalar)0.38268343236508978, t155i = t99i*(kiss_fft_scalar)0.92387953251128674 - t99r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t156r = t128r*(kiss_fft_scalar)0.38268343236508984 + t128i*(kiss_fft_scalar)0.92387953251128674, t156i = t128i*(kiss_fft_scalar)0.38268343236508984 - t128r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t157r = t155r + t156r, t157i = t155i + t156i;
+    const kiss_fft_scalar t158r = t155r - t156r, t158i = t155i - t156i;
+    const kiss_fft_scalar t159r = t158i, t159i = -t158r;
+    const kiss_fft_scalar t160r = t68r + t157r, t160i = t68i + t157i;
+    const kiss_fft_scalar t161r = t68r - t157r, t161i = t68i - t157i;
+    const kiss_fft_scalar t162r = t69r + t159r, t162i = t69i + t159i;
+    const kiss_fft_scalar t163r = t69r - t159r, t163i = t69i - t159i;
+    const kiss_fft_scalar t164r = t108r*(kiss_fft_scalar)0.83146961230254524 + t108i*(kiss_fft_scalar)0.55557023301960218, t164i = t108i*(kiss_fft_scalar)0.83146961230254524 - t108r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t165r = t137r*(kiss_fft_scalar)-0.19509032201612819 + t137i*(kiss_fft_scalar)0.98078528040323043, t165i = t137i*(kiss_fft_scalar)-0.19509032201612819 - t137r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t166r = t164r + t165r, t166i = t164i + t165i;
+    const kiss_fft_scalar t167r = t164r - t165r, t167i = t164i - t165i;
+    const kiss_fft_scalar t168r = t167i, t168i = -t167r;
+    const kiss_fft_scalar t169r = t77r + t166r, t169i = t77i + t166i;
+    const kiss_fft_scalar t170r = t77r - t166r, t170i = t77i - t166i;
+    const kiss_fft_scalar t171r = t78r + t168r, t171i = t78i + t168i;
+    const kiss_fft_scalar t172r = t78r - t168r, t172i = t78i - t168i;
+    const kiss_fft_scalar t173r = (t98r + t98i)*(kiss_fft_scalar)0.70710678118654757, t173i = (t98i - t98r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t174r = -(t127r - t127i)*(kiss_fft_scalar)0.70710678118654757, t174i = -(t127r + t127i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t175r = t173r + t174r, t175i = t173i + t174i;
+    const kiss_fft_scalar t176r = t173r - t174r, t176i = t173i - t174i;
+    const kiss_fft_scalar t177r = t176i, t177i = -t176r;
+    const kiss_fft_scalar t178r = t52r + t175r, t178i = t52i + t175i;
+    const kiss_fft_scalar t179r = t52r - t175r, t179i = t52i - t175i;
+    const kiss_fft_scalar t180r = t53r + t177r, t180i = t53i + t177i;
+    const kiss_fft_scalar t181r = t53r - t177r, t181i = t53i - t177i;
+    const kiss_fft_scalar t182r = t107r*(kiss_fft_scalar)0.55557023301960229 + t107i*(kiss_fft_scalar)0.83146961230254524, t182i = t107i*(kiss_fft_scalar)0.55557023301960229 - t107r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t183r = t136r*(kiss_fft_scalar)-0.98078528040323043 + t136i*(kiss_fft_scalar)0.19509032201612861, t183i = t136i*(kiss_fft_scalar)-0.98078528040323043 - t136r*(kiss_fft_scalar)0.19509032201612861;
+    const kiss_fft_scalar t184r = t182r + t183r, t184i = t182i + t183i;
+    const kiss_fft_scalar t185r = t182r - t183r, t185i = t182i - t183i;
+    const kiss_fft_scalar t186r = t185i, t186i = -t185r;
+    const kiss_fft_scalar t187r = t61r + t184r, t187i = t61i + t184i;
+    const kiss_fft_scalar t188r = t61r - t184r, t188i = t61i - t184i;
+    const kiss_fft_scalar t189r = t62r + t186r, t189i = t62i + t186i;
+    const kiss_fft_scalar t190r = t62r - t186r, t190i = t62i - t186i;
+    const kiss_fft_scalar t191r = t100r*(kiss_fft_scalar)0.38268343236508984 + t100i*(kiss_fft_scalar)0.92387953251128674, t191i = t100i*(kiss_fft_scalar)0.38268343236508984 - t100r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t192r = t129r*(kiss_fft_scalar)-0.92387953251128685 - t129i*(kiss_fft_scalar)0.38268343236508967, t192i = t129i*(kiss_fft_scalar)-0.92387953251128685 + t129r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t193r = t191r + t192r, t193i = t191i + t192i;
+    const kiss_fft_scalar t194r = t191r - t192r, t194i = t191i - t192i;
+    const kiss_fft_scalar t195r = t194i, t195i = -t194r;
+    const kiss_fft_scalar t196r = t70r + t193r, t196i = t70i + t193i;
+    const kiss_fft_scalar t197r = t70r - t193r, t197i = t70i - t193i;
+    const kiss_fft_scalar t198r = t71r + t195r, t198i = t71i + t195i;
+    const kiss_fft_scalar t199r = t71r - t195r, t199i = t71i - t195i;
+    const kiss_fft_scalar t200r = t109r*(kiss_fft_scalar)0.19509032201612833 + t109i*(kiss_fft_scalar)0.98078528040323043, t200i = t109i*(kiss_fft_scalar)0.19509032201612833 - t109r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t201r = t138r*(kiss_fft_scalar)-0.55557023301960218 - t138i*(kiss_fft_scalar)0.83146961230254524, t201i = t138i*(kiss_fft_scalar)-0.55557023301960218 + t138r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t202r = t200r + t201r, t202i = t200i + t201i;
+    const kiss_fft_scalar t203r = t200r - t201r, t203i = t200i - t201i;
+    const kiss_fft_scalar t204r = t203i, t204i = -t203r;
+    const kiss_fft_scalar t205r = t79r + t202r, t205i = t79i + t202i;
+    const kiss_fft_scalar t206r = t79r - t202r, t206i = t79i - t202i;
+    const kiss_fft_scalar t207r = t80r + t204r, t207i = t80i + t204i;
+    const kiss_fft_scalar t208r = t80r - t204r, t208i = t80i - t204i;
+    Fout[0].r = t142r; Fout[0].i = t142i;
+    Fout[1].r = t151r; Fout[1].i = t151i;
+    Fout[2].r = t160r; Fout[2].i = t160i;
+    Fout[3].r = t169r; Fout[3].i = t169i;
+    Fout[4].r = t178r; Fout[4].i = t178i;
+    Fout[5].r = t187r; Fout[5].i = t187i;
+    Fout[6].r = t196r; Fout[6].i = t196i;
+    Fout[7].r = t205r; Fout[7].i = t205i;
+    Fout[8].r = t144r; Fout[8].i = t144i;
+    Fout[9].r = t153r; Fout[9].i = t153i;
+    Fout[10].r = t162r; Fout[10].i = t162i;
+    Fout[11].r = t171r; Fout[11].i = t171i;
+    Fout[12].r = t180r; Fout[12].i = t180i;
+    Fout[13].r = t189r; Fout[13].i = t189i;
+    Fout[14].r = t198r; Fout[14].i = t198i;
+    Fout[15].r = t207r; Fout[15].i = t207i;
+    Fout[16].r = t143r; Fout[16].i = t143i;
+    Fout[17].r = t152r; Fout[17].i = t152i;
+    Fout[18].r = t161r; Fout[18].i = t161i;
+    Fout[19].r = t170r; Fout[19].i = t170i;
+    Fout[20].r = t179r; Fout[20].i = t179i;
+    Fout[21].r = t188r; Fout[21].i = t188i;
+    Fout[22].r = t197r; Fout[22].i = t197i;
+    Fout[23].r = t206r; Fout[23].i = t206i;
+    Fout[24].r = t145r; Fout[24].i = t145i;
+    Fout[25].r = t154r; Fout[25].i = t154i;
+    Fout[26].r = t163r; Fout[26].i = t163i;
+    Fout[27].r = t172r; Fout[27].i = t172i;
+    Fout[28].r = t181r; Fout[28].i = t181i;
+    Fout[29].r = t190r; Fout[29].i = t190i;
+    Fout[30].r = t199r; Fout[30].i = t199i;
+    Fout[31].r = t208r; Fout[31].i = t208i;
+}
+
+static void kf_leaf32_inv(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs)
+{
+    const kiss_fft_scalar t0r = f[0].r + f[16*fs].r, t0i = f[0].i + f[16*fs].i;
+    const kiss_fft_scalar t1r = f[0].r - f[16*fs].r, t1i = f[0].i - f[16*fs].i;
+    const kiss_fft_scalar t2r = f[8*fs].r + f[24*fs].r, t2i = f[8*fs].i + f[24*fs].i;
+    const kiss_fft_scalar t3r = f[8*fs].r - f[24*fs].r, t3i = f[8*fs].i - f[24*fs].i;
+    const kiss_fft_scalar t4r = -t3i, t4i = t3r;
+    const kiss_fft_scalar t5r = t0r + t2r, t5i = t0i + t2i;
+    const kiss_fft_scalar t6r = t0r - t2r, t6i = t0i - t2i;
+    const kiss_fft_scalar t7r = t1r + t4r, t7i = t1i + t4i;
+    const kiss_fft_scalar t8r = t1r - t4r, t8i = t1i - t4i;
+    const kiss_fft_scalar t9r = f[4*fs].r + f[20*fs].r, t9i = f[4*fs].i + f[20*fs].i;
+    const kiss_fft_scalar t10r = f[4*fs].r - f[20*fs].r, t10i = f[4*fs].i - f[20*fs].i;
+    const kiss_fft_scalar t11r = f[12*fs].r + f[28*fs].r, t11i = f[12*fs].i + f[28*fs].i;
+    const kiss_fft_scalar t12r = f[12*fs].r - f[28*fs].r, t12i = f[12*fs].i - f[28*fs].i;
+    const kiss_fft_scalar t13r = t9r + t11r, t13i = t9i + t11i;
+    const kiss_fft_scalar t14r = t9r - t11r, t14i = t9i - t11i;
+    const kiss_fft_scalar t15r = -t14i, t15i = t14r;
+    const kiss_fft_scalar t16r = t5r + t13r, t16i = t5i + t13i;
+    const kiss_fft_scalar t17r = t5r - t13r, t17i = t5i - t13i;
+    const kiss_fft_scalar t18r = t6r + t15r, t18i = t6i + t15i;
+    const kiss_fft_scalar t19r = t6r - t15r, t19i = t6i - t15i;
+    const kiss_fft_scalar t20r = (t10r - t10i)*(kiss_fft_scalar)0.70710678118654757, t20i = (t10r + t10i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t21r = -(t12r + t12i)*(kiss_fft_scalar)0.70710678118654757, t21i = -(t12i - t12r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t22r = t20r + t21r, t22i = t20i + t21i;
+    const kiss_fft_scalar t23r = t20r - t21r, t23i = t20i - t21i;
+    const kiss_fft_scalar t24r = -t23i, t24i = t23r;
+    const kiss_fft_scalar t25r = t7r + t22r, t25i = t7i + t22i;
+    const kiss_fft_scalar t26r = t7r - t22r, t26i = t7i - t22i;
+    const kiss_fft_scalar t27r = t8r + t24r, t27i = t8i + t24i;
+    const kiss_fft_scalar t28r = t8r - t24r, t28i = t8i - t24i;
+    const kiss_fft_scalar t29r = f[2*fs].r + f[18*fs].r, t29i = f[2*fs].i + f[18*fs].i;
+    const kiss_fft_scalar t30r = f[2*fs].r - f[18*fs].r, t30i = f[2*fs].i - f[18*fs].i;
+    const kiss_fft_scalar t31r = f[10*fs].r + f[26*fs].r, t31i = f[10*fs].i + f[26*fs].i;
+    const kiss_fft_scalar t32r = f[10*fs].r - f[26*fs].r, t32i = f[10*fs].i - f[26*fs].i;
+    const kiss_fft_scalar t33r = -t32i, t33i = t32r;
+    const kiss_fft_scalar t34r = t29r + t31r, t34i = t29i + t31i;
+    const kiss_fft_scalar t35r = t29r - t31r, t35i = t29i - t31i;
+    const kiss_fft_scalar t36r = t30r + t33r, t36i = t30i + t33i;
+    const kiss_fft_scalar t37r = t30r - t33r, t37i = t30i - t33i;
+    const kiss_fft_scalar t38r = f[6*fs].r + f[22*fs].r, t38i = f[6*fs].i + f[22*fs].i;
+    const kiss_fft_scalar t39r = f[6*fs].r - f[22*fs].r, t39i = f[6*fs].i - f[22*fs].i;
+    const kiss_fft_scalar t40r = f[14*fs].r + f[30*fs].r, t40i = f[14*fs].i + f[30*fs].i;
+    const kiss_fft_scalar t41r = f[14*fs].r - f[30*fs].r, t41i = f[14*fs].i - f[30*fs].i;
+    const kiss_fft_scalar t42r = -t41i, t42i = t41r;
+    const kiss_fft_scalar t43r = t38r + t40r, t43i = t38i + t40i;
+    const kiss_fft_scalar t44r = t38r - t40r, t44i = t38i - t40i;
+    const kiss_fft_scalar t45r = t39r + t42r, t45i = t39i + t42i;
+    const kiss_fft_scalar t46r = t39r - t42r, t46i = t39i - t42i;
+    const kiss_fft_scalar t47r = t34r + t43r, t47i = t34i + t43i;
+    const kiss_fft_scalar t48r = t34r - t43r, t48i = t34i - t43i;
+    const kiss_fft_scalar t49r = -t48i, t49i = t48r;
+    const kiss_fft_scalar t50r = t16r + t47r, t50i = t16i + t47i;
+    const kiss_fft_scalar t51r = t16r - t47r, t51i = t16i - t47i;
+    const kiss_fft_scalar t52r = t17r + t49r, t52i = t17i + t49i;
+    const kiss_fft_scalar t53r = t17r - t49r, t53i = t17i - t49i;
+    const kiss_fft_scalar t54r = t36r*(kiss_fft_scalar)0.92387953251128674 - t36i*(kiss_fft_scalar)0.38268343236508978, t54i = t36i*(kiss_fft_scalar)0.92387953251128674 + t36r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t55r = t45r*(kiss_fft_scalar)0.38268343236508984 - t45i*(kiss_fft_scalar)0.92387953251128674, t55i = t45i*(kiss_fft_scalar)0.38268343236508984 + t45r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t56r = t54r + t55r, t56i = t54i + t55i;
+    const kiss_fft_scalar t57r = t54r - t55r, t57i = t54i - t55i;
+    const kiss_fft_scalar t58r = -t57i, t58i = t57r;
+    const kiss_fft_scalar t59r = t25r + t56r, t59i = t25i + t56i;
+    const kiss_fft_scalar t60r = t25r - t56r, t60i = t25i - t56i;
+    const kiss_fft_scalar t61r = t26r + t58r, t61i = t26i + t58i;
+    const kiss_fft_scalar t62r = t26r - t58r, t62i = t26i - t58i;
+    const kiss_fft_scalar t63r = (t35r - t35i)*(kiss_fft_scalar)0.70710678118654757, t63i = (t35r + t35i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t64r = -(t44r + t44i)*(kiss_fft_scalar)0.70710678118654757, t64i = -(t44i - t44r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t65r = t63r + t64r, t65i = t63i + t64i;
+    const kiss_fft_scalar t66r = t63r - t64r, t66i = t63i - t64i;
+    const kiss_fft_scalar t67r = -t66i, t67i = t66r;
+    const kiss_fft_scalar t68r = t18r + t65r, t68i = t18i + t65i;
+    const kiss_fft_scalar t69r = t18r - t65r, t69i = t18i - t65i;
+    const kiss_fft_scalar t70r = t19r + t67r, t70i = t19i + t67i;
+    const kiss_fft_scalar t71r = t19r - t67r, t71i = t19i - t67i;
+    const kiss_fft_scalar t72r = t37r*(kiss_fft_scalar)0.38268343236508984 - t37i*(kiss_fft_scalar)0.92387953251128674, t72i = t37i*(kiss_fft_scalar)0.38268343236508984 + t37r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t73r = t46r*(kiss_fft_scalar)-0.92387953251128685 + t46i*(kiss_fft_scalar)0.38268343236508967, t73i = t46i*(kiss_fft_scalar)-0.92387953251128685 - t46r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t74r = t72r + t73r, t74i = t72i + t73i;
+    const kiss_fft_scalar t75r = t72r - t73r, t75i = t72i - t73i;
+    const kiss_fft_scalar t76r = -t75i, t76i = t75r;
+    const kiss_fft_scalar t77r = t27r + t74r, t77i = t27i + t74i;
+    const kiss_fft_scalar t78r = t27r - t74r, t78i = t27i - t74i;
+    const kiss_fft_scalar t79r = t28r + t76r, t79i = t28i + t76i;
+    const kiss_fft_scalar t80r = t28r - t76r, t80i = t28i - t76i;
+    const kiss_fft_scalar t81r = f[fs].r + f[17*fs].r, t81i = f[fs].i + f[17*fs].i;
+    const kiss_fft_scalar t82r = f[fs].r - f[17*fs].r, t82i = f[fs].i - f[17*fs].i;
+    const kiss_fft_scalar t83r = f[9*fs].r + f[25*fs].r, t83i = f[9*fs].i + f[25*fs].i;
+    const kiss_fft_scalar t84r = f[9*fs].r - f[25*fs].r, t84i = f[9*fs].i - f[25*fs].i;
+    const kiss_fft_scalar t85r = -t84i, t85i = t84r;
+    const kiss_fft_scalar t86r = t81r + t83r, t86i = t81i + t83i;
+    const kiss_fft_scalar t87r = t81r - t83r, t87i = t81i - t83i;
+    const kiss_fft_scalar t88r = t82r + t85r, t88i = t82i + t85i;
+    const kiss_fft_scalar t89r = t82r - t85r, t89i = t82i - t85i;
+    const kiss_fft_scalar t90r = f[5*fs].r + f[21*fs].r, t90i = f[5*fs].i + f[21*fs].i;
+    const kiss_fft_scalar t91r = f[5*fs].r - f[21*fs].r, t91i = f[5*fs].i - f[21*fs].i;
+    const kiss_fft_scalar t92r = f[13*fs].r + f[29*fs].r, t92i = f[13*fs].i + f[29*fs].i;
+    const kiss_fft_scalar t93r = f[13*fs].r - f[29*fs].r, t93i = f[13*fs].i - f[29*fs].i;
+    const kiss_fft_scalar t94r = t90r + t92r, t94i = t90i + t92i;
+    const kiss_fft_scalar t95r = t90r - t92r, t95i = t90i - t92i;
+    const kiss_fft_scalar t96r = -t95i, t96i = t95r;
+    const kiss_fft_scalar t97r = t86r + t94r, t97i = t86i + t94i;
+    const kiss_fft_scalar t98r = t86r - t94r, t98i = t86i - t94i;
+    const kiss_fft_scalar t99r = t87r + t96r, t99i = t87i + t96i;
+    const kiss_fft_scalar t100r = t87r - t96r, t100i = t87i - t96i;
+    const kiss_fft_scalar t101r = (t91r - t91i)*(kiss_fft_scalar)0.70710678118654757, t101i = (t91r + t91i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t102r = -(t93r + t93i)*(kiss_fft_scalar)0.70710678118654757, t102i = -(t93i - t93r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t103r = t101r + t102r, t103i = t101i + t102i;
+    const kiss_fft_scalar t104r = t101r - t102r, t104i = t101i - t102i;
+    const kiss_fft_scalar t105r = -t104i, t105i = t104r;
+    const kiss_fft_scalar t106r = t88r + t103r, t106i = t88i + t103i;
+    const kiss_fft_scalar t107r = t88r - t103r, t107i = t88i - t103i;
+    const kiss_fft_scalar t108r = t89r + t105r, t108i = t89i + t105i;
+    const kiss_fft_scalar t109r = t89r - t105r, t109i = t89i - t105i;
+    const kiss_fft_scalar t110r = f[3*fs].r + f[19*fs].r, t110i = f[3*fs].i + f[19*fs].i;
+    const kiss_fft_scalar t111r = f[3*fs].r - f[19*fs].r, t111i = f[3*fs].i - f[19*fs].i;
+    const kiss_fft_scalar t112r = f[11*fs].r + f[27*fs].r, t112i = f[11*fs].i + f[27*fs].i;
+    const kiss_fft_scalar t113r = f[11*fs].r - f[27*fs].r, t113i = f[11*fs].i - f[27*fs].i;
+    const kiss_fft_scalar t114r = -t113i, t114i = t113r;
+    const kiss_fft_scalar t115r = t110r + t112r, t115i = t110i + t112i;
+    const kiss_fft_scalar t116r = t110r - t112r, t116i = t110i - t112i;
+    const kiss_fft_scalar t117r = t111r + t114r, t117i = t111i + t114i;
+    const kiss_fft_scalar t118r = t111r - t114r, t118i = t111i - t114i;
+    const kiss_fft_scalar t119r = f[7*fs].r + f[23*fs].r, t119i = f[7*fs].i + f[23*fs].i;
+    const kiss_fft_scalar t120r = f[7*fs].r - f[23*fs].r, t120i = f[7*fs].i - f[23*fs].i;
+    const kiss_fft_scalar t121r = f[15*fs].r + f[31*fs].r, t121i = f[15*fs].i + f[31*fs].i;
+    const kiss_fft_scalar t122r = f[15*fs].r - f[31*fs].r, t122i = f[15*fs].i - f[31*fs].i;
+    const kiss_fft_scalar t123r = t119r + t121r, t123i = t119i + t121i;
+    const kiss_fft_scalar t124r = t119r - t121r, t124i = t119i - t121i;
+    const kiss_fft_scalar t125r = -t124i, t125i = t124r;
+    const kiss_fft_scalar t126r = t115r + t123r, t126i = t115i + t123i;
+    const kiss_fft_scalar t127r = t115r - t123r, t127i = t115i - t123i;
+    const kiss_fft_scalar t128r = t116r + t125r, t128i = t116i + t125i;
+    const kiss_fft_scalar t129r = t116r - t125r, t129i = t116i - t125i;
+    const kiss_fft_scalar t130r = (t120r - t120i)*(kiss_fft_scalar)0.70710678118654757, t130i = (t120r + t120i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t131r = -(t122r + t122i)*(kiss_fft_scalar)0.70710678118654757, t131i = -(t122i - t122r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t132r = t130r + t131r, t132i = t130i + t131i;
+    const kiss_fft_scalar t133r = t130r - t131r, t133i = t130i - t131i;
+    const kiss_fft_scalar t134r = -t133i, t134i = t133r;
+    const kiss_fft_scalar t135r = t117r + t132r, t135i = t117i + t132i;
+    const kiss_fft_scalar t136r = t117r - t132r, t136i = t117i - t132i;
+    const kiss_fft_scalar t137r = t118r + t134r, t137i = t118i + t134i;
+    const kiss_fft_scalar t138r = t118r - t134r, t138i = t118i - t134i;
+    const kiss_fft_scalar t139r = t97r + t126r, t139i = t97i + t126i;
+    const kiss_fft_scalar t140r = t97r - t126r, t140i = t97i - t126i;
+    const kiss_fft_scalar t141r = -t140i, t141i = t140r;
+    const kiss_fft_scalar t142r = t50r + t139r, t142i = t50i + t139i;
+    const kiss_fft_scalar t143r = t50r - t139r, t143i = t50i - t139i;
+    const kiss_fft_scalar t144r = t51r + t141r, t144i = t51i + t141i;
+    const kiss_fft_scalar t145r = t51r - t141r, t145i = t51i - t141i;
+    const kiss_fft_scalar t146r = t106r*(kiss_fft_scalar)0.98078528040323043 - t106i*(kiss_fft_scalar)0.19509032201612825, t146i = t106i*(kiss_fft_scalar)0.98078528040323043 + t106r*(kiss_fft_scalar)0.19509032201612825;
+    const kiss_fft_scalar t147r = t135r*(kiss_fft_scalar)0.83146961230254524 - t135i*(kiss_fft_scalar)0.55557023301960218, t147i = t135i*(kiss_fft_scalar)0.83146961230254524 + t135r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t148r = t146r + t147r, t148i = t146i + t147i;
+    const kiss_fft_scalar t149r = t146r - t147r, t149i = t146i - t147i;
+    const kiss_fft_scalar t150r = -t149i, t150i = t149r;
+    const kiss_fft_scalar t151r = t59r + t148r, t151i = t59i + t148i;
+    const kiss_fft_scalar t152r = t59r - t148r, t152i = t59i - t148i;
+    const kiss_fft_scalar t153r = t60r + t150r, t153i = t60i + t150i;
+    const kiss_fft_scalar t154r = t60r - t150r, t154i = t60i - t150i;
+    const kiss_fft_scalar t155r = t99r*(kiss_fft_scalar)0.92387953251128674 - t99i*(kiss_fft_scalar)0.38268343236508978, t155i = t99i*(kiss_fft_scalar)0.92387953251128674 + t99r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t156r = t128r*(kiss_fft_scalar)0.38268343236508984 - t128i*(kiss_fft_scalar)0.92387953251128674, t156i = t128i*(kiss_fft_scalar)0.38268343236508984 + t128r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t157r = t155r + t156r, t157i = t155i + t156i;
+    const kiss_fft_scalar t158r = t155r - t156r, t158i = t155i - t156i;
+    const kiss_fft_scalar t159r = -t158i, t159i = t158r;
+    const kiss_fft_scalar t160r = t68r + t157r, t160i = t68i + t157i;
+    const kiss_fft_scalar t161r = t68r - t157r, t161i = t68i - t157i;
+    const kiss_fft_scalar t162r = t69r + t159r, t162i = t69i + t159i;
+    const kiss_fft_scalar t163r = t69r - t159r, t163i = t69i - t159i;
+    const kiss_fft_scalar t164r = t108r*(kiss_fft_scalar)0.83146961230254524 - t108i*(kiss_fft_scalar)0.55557023301960218, t164i = t108i*(kiss_fft_scalar)0.83146961230254524 + t108r*(kiss_fft_scalar)0.55557023301960218;
+    const kiss_fft_scalar t165r = t137r*(kiss_fft_scalar)-0.19509032201612819 - t137i*(kiss_fft_scalar)0.98078528040323043, t165i = t137i*(kiss_fft_scalar)-0.19509032201612819 + t137r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t166r = t164r + t165r, t166i = t164i + t165i;
+    const kiss_fft_scalar t167r = t164r - t165r, t167i = t164i - t165i;
+    const kiss_fft_scalar t168r = -t167i, t168i = t167r;
+    const kiss_fft_scalar t169r = t77r + t166r, t169i = t77i + t166i;
+    const kiss_fft_scalar t170r = t77r - t166r, t170i = t77i - t166i;
+    const kiss_fft_scalar t171r = t78r + t168r, t171i = t78i + t168i;
+    const kiss_fft_scalar t172r = t78r - t168r, t172i = t78i - t168i;
+    const kiss_fft_scalar t173r = (t98r - t98i)*(kiss_fft_scalar)0.70710678118654757, t173i = (t98r + t98i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t174r = -(t127r + t127i)*(kiss_fft_scalar)0.70710678118654757, t174i = -(t127i - t127r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t175r = t173r + t174r, t175i = t173i + t174i;
+    const kiss_fft_scalar t176r = t173r - t174r, t176i = t173i - t174i;
+    const kiss_fft_scalar t177r = -t176i, t177i = t176r;
+    const kiss_fft_scalar t178r = t52r + t175r, t178i = t52i + t175i;
+    const kiss_fft_scalar t179r = t52r - t175r, t179i = t52i - t175i;
+    const kiss_fft_scalar t180r = t53r + t177r, t180i = t53i + t177i;
+    const kiss_fft_scalar t181r = t53r - t177r, t181i = t53i - t177i;
+    const kiss_fft_scalar t182r = t107r*(kiss_fft_scalar)0.55557023301960229 - t107i*(kiss_fft_scalar)0.83146961230254524, t182i = t107i*(kiss_fft_scalar)0.55557023301960229 + t107r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t183r = t136r*(kiss_fft_scalar)-0.98078528040323043 - t136i*(kiss_fft_scalar)0.19509032201612861, t183i = t136i*(kiss_fft_scalar)-0.98078528040323043 + t136r*(kiss_fft_scalar)0.19509032201612861;
+    const kiss_fft_scalar t184r = t182r + t183r, t184i = t182i + t183i;
+    const kiss_fft_scalar t185r = t182r - t183r, t185i = t182i - t183i;
+    const kiss_fft_scalar t186r = -t185i, t186i = t185r;
+    const kiss_fft_scalar t187r = t61r + t184r, t187i = t61i + t184i;
+    const kiss_fft_scalar t188r = t61r - t184r, t188i = t61i - t184i;
+    const kiss_fft_scalar t189r = t62r + t186r, t189i = t62i + t186i;
+    const kiss_fft_scalar t190r = t62r - t186r, t190i = t62i - t186i;
+    const kiss_fft_scalar t191r = t100r*(kiss_fft_scalar)0.38268343236508984 - t100i*(kiss_fft_scalar)0.92387953251128674, t191i = t100i*(kiss_fft_scalar)0.38268343236508984 + t100r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t192r = t129r*(kiss_fft_scalar)-0.92387953251128685 + t129i*(kiss_fft_scalar)0.38268343236508967, t192i = t129i*(kiss_fft_scalar)-0.92387953251128685 - t129r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t193r = t191r + t192r, t193i = t191i + t192i;
+    const kiss_fft_scalar t194r = t191r - t192r, t194i = t191i - t192i;
+    const kiss_fft_scalar t195r = -t194i, t195i = t194r;
+    const kiss_fft_scalar t196r = t70r + t193r, t196i = t70i + t193i;
+    const kiss_fft_scalar t197r = t70r - t193r, t197i = t70i - t193i;
+    const kiss_fft_scalar t198r = t71r + t195r, t198i = t71i + t195i;
+    const kiss_fft_scalar t199r = t71r - t195r, t199i = t71i - t195i;
+    const kiss_fft_scalar t200r = t109r*(kiss_fft_scalar)0.19509032201612833 - t109i*(kiss_fft_scalar)0.98078528040323043, t200i = t109i*(kiss_fft_scalar)0.19509032201612833 + t109r*(kiss_fft_scalar)0.98078528040323043;
+    const kiss_fft_scalar t201r = t138r*(kiss_fft_scalar)-0.55557023301960218 + t138i*(kiss_fft_scalar)0.83146961230254524, t201i = t138i*(kiss_fft_scalar)-0.55557023301960218 - t138r*(kiss_fft_scalar)0.83146961230254524;
+    const kiss_fft_scalar t202r = t200r + t201r, t202i = t200i + t201i;
+    const kiss_fft_scalar t203r = t200r - t201r, t203i = t200i - t201i;
+    const kiss_fft_scalar t204r = -t203i, t204i = t203r;
+    const kiss_fft_scalar t205r = t79r + t202r, t205i = t79i + t202i;
+    const kiss_fft_scalar t206r = t79r - t202r, t206i = t79i - t202i;
+    const kiss_fft_scalar t207r = t80r + t204r, t207i = t80i + t204i;
+    const kiss_fft_scalar t208r = t80r - t204r, t208i = t80i - t204i;
+    Fout[0].r = t142r; Fout[0].i = t142i;
+    Fout[1].r = t151r; Fout[1].i = t151i;
+    Fout[2].r = t160r; Fout[2].i = t160i;
+    Fout[3].r = t169r; Fout[3].i = t169i;
+    Fout[4].r = t178r; Fout[4].i = t178i;
+    Fout[5].r = t187r; Fout[5].i = t187i;
+    Fout[6].r = t196r; Fout[6].i = t196i;
+    Fout[7].r = t205r; Fout[7].i = t205i;
+    Fout[8].r = t144r; Fout[8].i = t144i;
+    Fout[9].r = t153r; Fout[9].i = t153i;
+    Fout[10].r = t162r; Fout[10].i = t162i;
+    Fout[11].r = t171r; Fout[11].i = t171i;
+    Fout[12].r = t180r; Fout[12].i = t180i;
+    Fout[13].r = t189r; Fout[13].i = t189i;
+    Fout[14].r = t198r; Fout[14].i = t198i;
+    Fout[15].r = t207r; Fout[15].i = t207i;
+    Fout[16].r = t143r; Fout[16].i = t143i;
+    Fout[17].r = t152r; Fout[17].i = t152i;
+    Fout[18].r = t161r; Fout[18].i = t161i;
+    Fout[19].r = t170r; Fout[19].i = t170i;
+    Fout[20].r = t179r; Fout[20].i = t179i;
+    Fout[21].r = t188r; Fout[21].i = t188i;
+    Fout[22].r = t197r; Fout[22].i = t197i;
+    Fout[23].r = t206r; Fout[23].i = t206i;
+    Fout[24].r = t145r; Fout[24].i = t145i;
+    Fout[25].r = t154r; Fout[25].i = t154i;
+    Fout[26].r = t163r; Fout[26].i = t163i;
+    Fout[27].r = t172r; Fout[27].i = t172i;
+    Fout[28].r = t181r; Fout[28].i = t181i;
+    Fout[29].r = t190r; Fout[29].i = t190i;
+    Fout[30].r = t199r; Fout[30].i = t199i;
+    Fout[31].r = t208r; Fout[31].i = t208i;
+}
+
+static void kf_leaf16_fwd(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs)
+{
+    const kiss_fft_scalar t0r = f[0].r + f[8*fs].r, t0i = f[0].i + f[8*fs].i;
+    const kiss_fft_scalar t1r = f[0].r - f[8*fs].r, t1i = f[0].i - f[8*fs].i;
+    const kiss_fft_scalar t2r = f[4*fs].r + f[12*fs].r, t2i = f[4*fs].i + f[12*fs].i;
+    const kiss_fft_scalar t3r = f[4*fs].r - f[12*fs].r, t3i = f[4*fs].i - f[12*fs].i;
+    const kiss_fft_scalar t4r = t3i, t4i = -t3r;
+    const kiss_fft_scalar t5r = t0r + t2r, t5i = t0i + t2i;
+    const kiss_fft_scalar t6r = t0r - t2r, t6i = t0i - t2i;
+    const kiss_fft_scalar t7r = t1r + t4r, t7i = t1i + t4i;
+    const kiss_fft_scalar t8r = t1r - t4r, t8i = t1i - t4i;
+    const kiss_fft_scalar t9r = f[2*fs].r + f[10*fs].r, t9i = f[2*fs].i + f[10*fs].i;
+    const kiss_fft_scalar t10r = f[2*fs].r - f[10*fs].r, t10i = f[2*fs].i - f[10*fs].i;
+    const kiss_fft_scalar t11r = f[6*fs].r + f[14*fs].r, t11i = f[6*fs].i + f[14*fs].i;
+    const kiss_fft_scalar t12r = f[6*fs].r - f[14*fs].r, t12i = f[6*fs].i - f[14*fs].i;
+    const kiss_fft_scalar t13r = t9r + t11r, t13i = t9i + t11i;
+    const kiss_fft_scalar t14r = t9r - t11r, t14i = t9i - t11i;
+    const kiss_fft_scalar t15r = t14i, t15i = -t14r;
+    const kiss_fft_scalar t16r = t5r + t13r, t16i = t5i + t13i;
+    const kiss_fft_scalar t17r = t5r - t13r, t17i = t5i - t13i;
+    const kiss_fft_scalar t18r = t6r + t15r, t18i = t6i + t15i;
+    const kiss_fft_scalar t19r = t6r - t15r, t19i = t6i - t15i;
+    const kiss_fft_scalar t20r = (t10r + t10i)*(kiss_fft_scalar)0.70710678118654757, t20i = (t10i - t10r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t21r = -(t12r - t12i)*(kiss_fft_scalar)0.70710678118654757, t21i = -(t12r + t12i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t22r = t20r + t21r, t22i = t20i + t21i;
+    const kiss_fft_scalar t23r = t20r - t21r, t23i = t20i - t21i;
+    const kiss_fft_scalar t24r = t23i, t24i = -t23r;
+    const kiss_fft_scalar t25r = t7r + t22r, t25i = t7i + t22i;
+    const kiss_fft_scalar t26r = t7r - t22r, t26i = t7i - t22i;
+    const kiss_fft_scalar t27r = t8r + t24r, t27i = t8i + t24i;
+    const kiss_fft_scalar t28r = t8r - t24r, t28i = t8i - t24i;
+    const kiss_fft_scalar t29r = f[fs].r + f[9*fs].r, t29i = f[fs].i + f[9*fs].i;
+    const kiss_fft_scalar t30r = f[fs].r - f[9*fs].r, t30i = f[fs].i - f[9*fs].i;
+    const kiss_fft_scalar t31r = f[5*fs].r + f[13*fs].r, t31i = f[5*fs].i + f[13*fs].i;
+    const kiss_fft_scalar t32r = f[5*fs].r - f[13*fs].r, t32i = f[5*fs].i - f[13*fs].i;
+    const kiss_fft_scalar t33r = t32i, t33i = -t32r;
+    const kiss_fft_scalar t34r = t29r + t31r, t34i = t29i + t31i;
+    const kiss_fft_scalar t35r = t29r - t31r, t35i = t29i - t31i;
+    const kiss_fft_scalar t36r = t30r + t33r, t36i = t30i + t33i;
+    const kiss_fft_scalar t37r = t30r - t33r, t37i = t30i - t33i;
+    const kiss_fft_scalar t38r = f[3*fs].r + f[11*fs].r, t38i = f[3*fs].i + f[11*fs].i;
+    const kiss_fft_scalar t39r = f[3*fs].r - f[11*fs].r, t39i = f[3*fs].i - f[11*fs].i;
+    const kiss_fft_scalar t40r = f[7*fs].r + f[15*fs].r, t40i = f[7*fs].i + f[15*fs].i;
+    const kiss_fft_scalar t41r = f[7*fs].r - f[15*fs].r, t41i = f[7*fs].i - f[15*fs].i;
+    const kiss_fft_scalar t42r = t41i, t42i = -t41r;
+    const kiss_fft_scalar t43r = t38r + t40r, t43i = t38i + t40i;
+    const kiss_fft_scalar t44r = t38r - t40r, t44i = t38i - t40i;
+    const kiss_fft_scalar t45r = t39r + t42r, t45i = t39i + t42i;
+    const kiss_fft_scalar t46r = t39r - t42r, t46i = t39i - t42i;
+    const kiss_fft_scalar t47r = t34r + t43r, t47i = t34i + t43i;
+    const kiss_fft_scalar t48r = t34r - t43r, t48i = t34i - t43i;
+    const kiss_fft_scalar t49r = t48i, t49i = -t48r;
+    const kiss_fft_scalar t50r = t16r + t47r, t50i = t16i + t47i;
+    const kiss_fft_scalar t51r = t16r - t47r, t51i = t16i - t47i;
+    const kiss_fft_scalar t52r = t17r + t49r, t52i = t17i + t49i;
+    const kiss_fft_scalar t53r = t17r - t49r, t53i = t17i - t49i;
+    const kiss_fft_scalar t54r = t36r*(kiss_fft_scalar)0.92387953251128674 + t36i*(kiss_fft_scalar)0.38268343236508978, t54i = t36i*(kiss_fft_scalar)0.92387953251128674 - t36r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t55r = t45r*(kiss_fft_scalar)0.38268343236508984 + t45i*(kiss_fft_scalar)0.92387953251128674, t55i = t45i*(kiss_fft_scalar)0.38268343236508984 - t45r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t56r = t54r + t55r, t56i = t54i + t55i;
+    const kiss_fft_scalar t57r = t54r - t55r, t57i = t54i - t55i;
+    const kiss_fft_scalar t58r = t57i, t58i = -t57r;
+    const kiss_fft_scalar t59r = t25r + t56r, t59i = t25i + t56i;
+    const kiss_fft_scalar t60r = t25r - t56r, t60i = t25i - t56i;
+    const kiss_fft_scalar t61r = t26r + t58r, t61i = t26i + t58i;
+    const kiss_fft_scalar t62r = t26r - t58r, t62i = t26i - t58i;
+    const kiss_fft_scalar t63r = (t35r + t35i)*(kiss_fft_scalar)0.70710678118654757, t63i = (t35i - t35r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t64r = -(t44r - t44i)*(kiss_fft_scalar)0.70710678118654757, t64i = -(t44r + t44i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t65r = t63r + t64r, t65i = t63i + t64i;
+    const kiss_fft_scalar t66r = t63r - t64r, t66i = t63i - t64i;
+    const kiss_fft_scalar t67r = t66i, t67i = -t66r;
+    const kiss_fft_scalar t68r = t18r + t65r, t68i = t18i + t65i;
+    const kiss_fft_scalar t69r = t18r - t65r, t69i = t18i - t65i;
+    const kiss_fft_scalar t70r = t19r + t67r, t70i = t19i + t67i;
+    const kiss_fft_scalar t71r = t19r - t67r, t71i = t19i - t67i;
+    const kiss_fft_scalar t72r = t37r*(kiss_fft_scalar)0.38268343236508984 + t37i*(kiss_fft_scalar)0.92387953251128674, t72i = t37i*(kiss_fft_scalar)0.38268343236508984 - t37r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t73r = t46r*(kiss_fft_scalar)-0.92387953251128685 - t46i*(kiss_fft_scalar)0.38268343236508967, t73i = t46i*(kiss_fft_scalar)-0.92387953251128685 + t46r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t74r = t72r + t73r, t74i = t72i + t73i;
+    const kiss_fft_scalar t75r = t72r - t73r, t75i = t72i - t73i;
+    const kiss_fft_scalar t76r = t75i, t76i = -t75r;
+    const kiss_fft_scalar t77r = t27r + t74r, t77i = t27i + t74i;
+    const kiss_fft_scalar t78r = t27r - t74r, t78i = t27i - t74i;
+    const kiss_fft_scalar t79r = t28r + t76r, t79i = t28i + t76i;
+    const kiss_fft_scalar t80r = t28r - t76r, t80i = t28i - t76i;
+    Fout[0].r = t50r; Fout[0].i = t50i;
+    Fout[1].r = t59r; Fout[1].i = t59i;
+    Fout[2].r = t68r; Fout[2].i = t68i;
+    Fout[3].r = t77r; Fout[3].i = t77i;
+    Fout[4].r = t52r; Fout[4].i = t52i;
+    Fout[5].r = t61r; Fout[5].i = t61i;
+    Fout[6].r = t70r; Fout[6].i = t70i;
+    Fout[7].r = t79r; Fout[7].i = t79i;
+    Fout[8].r = t51r; Fout[8].i = t51i;
+    Fout[9].r = t60r; Fout[9].i = t60i;
+    Fout[10].r = t69r; Fout[10].i = t69i;
+    Fout[11].r = t78r; Fout[11].i = t78i;
+    Fout[12].r = t53r; Fout[12].i = t53i;
+    Fout[13].r = t62r; Fout[13].i = t62i;
+    Fout[14].r = t71r; Fout[14].i = t71i;
+    Fout[15].r = t80r; Fout[15].i = t80i;
+}
+
+static void kf_leaf16_inv(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs)
+{
+    const kiss_fft_scalar t0r = f[0].r + f[8*fs].r, t0i = f[0].i + f[8*fs].i;
+    const kiss_fft_scalar t1r = f[0].r - f[8*fs].r, t1i = f[0].i - f[8*fs].i;
+    const kiss_fft_scalar t2r = f[4*fs].r + f[12*fs].r, t2i = f[4*fs].i + f[12*fs].i;
+    const kiss_fft_scalar t3r = f[4*fs].r - f[12*fs].r, t3i = f[4*fs].i - f[12*fs].i;
+    const kiss_fft_scalar t4r = -t3i, t4i = t3r;
+    const kiss_fft_scalar t5r = t0r + t2r, t5i = t0i + t2i;
+    const kiss_fft_scalar t6r = t0r - t2r, t6i = t0i - t2i;
+    const kiss_fft_scalar t7r = t1r + t4r, t7i = t1i + t4i;
+    const kiss_fft_scalar t8r = t1r - t4r, t8i = t1i - t4i;
+    const kiss_fft_scalar t9r = f[2*fs].r + f[10*fs].r, t9i = f[2*fs].i + f[10*fs].i;
+    const kiss_fft_scalar t10r = f[2*fs].r - f[10*fs].r, t10i = f[2*fs].i - f[10*fs].i;
+    const kiss_fft_scalar t11r = f[6*fs].r + f[14*fs].r, t11i = f[6*fs].i + f[14*fs].i;
+    const kiss_fft_scalar t12r = f[6*fs].r - f[14*fs].r, t12i = f[6*fs].i - f[14*fs].i;
+    const kiss_fft_scalar t13r = t9r + t11r, t13i = t9i + t11i;
+    const kiss_fft_scalar t14r = t9r - t11r, t14i = t9i - t11i;
+    const kiss_fft_scalar t15r = -t14i, t15i = t14r;
+    const kiss_fft_scalar t16r = t5r + t13r, t16i = t5i + t13i;
+    const kiss_fft_scalar t17r = t5r - t13r, t17i = t5i - t13i;
+    const kiss_fft_scalar t18r = t6r + t15r, t18i = t6i + t15i;
+    const kiss_fft_scalar t19r = t6r - t15r, t19i = t6i - t15i;
+    const kiss_fft_scalar t20r = (t10r - t10i)*(kiss_fft_scalar)0.70710678118654757, t20i = (t10r + t10i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t21r = -(t12r + t12i)*(kiss_fft_scalar)0.70710678118654757, t21i = -(t12i - t12r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t22r = t20r + t21r, t22i = t20i + t21i;
+    const kiss_fft_scalar t23r = t20r - t21r, t23i = t20i - t21i;
+    const kiss_fft_scalar t24r = -t23i, t24i = t23r;
+    const kiss_fft_scalar t25r = t7r + t22r, t25i = t7i + t22i;
+    const kiss_fft_scalar t26r = t7r - t22r, t26i = t7i - t22i;
+    const kiss_fft_scalar t27r = t8r + t24r, t27i = t8i + t24i;
+    const kiss_fft_scalar t28r = t8r - t24r, t28i = t8i - t24i;
+    const kiss_fft_scalar t29r = f[fs].r + f[9*fs].r, t29i = f[fs].i + f[9*fs].i;
+    const kiss_fft_scalar t30r = f[fs].r - f[9*fs].r, t30i = f[fs].i - f[9*fs].i;
+    const kiss_fft_scalar t31r = f[5*fs].r + f[13*fs].r, t31i = f[5*fs].i + f[13*fs].i;
+    const kiss_fft_scalar t32r = f[5*fs].r - f[13*fs].r, t32i = f[5*fs].i - f[13*fs].i;
+    const kiss_fft_scalar t33r = -t32i, t33i = t32r;
+    const kiss_fft_scalar t34r = t29r + t31r, t34i = t29i + t31i;
+    const kiss_fft_scalar t35r = t29r - t31r, t35i = t29i - t31i;
+    const kiss_fft_scalar t36r = t30r + t33r, t36i = t30i + t33i;
+    const kiss_fft_scalar t37r = t30r - t33r, t37i = t30i - t33i;
+    const kiss_fft_scalar t38r = f[3*fs].r + f[11*fs].r, t38i = f[3*fs].i + f[11*fs].i;
+    const kiss_fft_scalar t39r = f[3*fs].r - f[11*fs].r, t39i = f[3*fs].i - f[11*fs].i;
+    const kiss_fft_scalar t40r = f[7*fs].r + f[15*fs].r, t40i = f[7*fs].i + f[15*fs].i;
+    const kiss_fft_scalar t41r = f[7*fs].r - f[15*fs].r, t41i = f[7*fs].i - f[15*fs].i;
+    const kiss_fft_scalar t42r = -t41i, t42i = t41r;
+    const kiss_fft_scalar t43r = t38r + t40r, t43i = t38i + t40i;
+    const kiss_fft_scalar t44r = t38r - t40r, t44i = t38i - t40i;
+    const kiss_fft_scalar t45r = t39r + t42r, t45i = t39i + t42i;
+    const kiss_fft_scalar t46r = t39r - t42r, t46i = t39i - t42i;
+    const kiss_fft_scalar t47r = t34r + t43r, t47i = t34i + t43i;
+    const kiss_fft_scalar t48r = t34r - t43r, t48i = t34i - t43i;
+    const kiss_fft_scalar t49r = -t48i, t49i = t48r;
+    const kiss_fft_scalar t50r = t16r + t47r, t50i = t16i + t47i;
+    const kiss_fft_scalar t51r = t16r - t47r, t51i = t16i - t47i;
+    const kiss_fft_scalar t52r = t17r + t49r, t52i = t17i + t49i;
+    const kiss_fft_scalar t53r = t17r - t49r, t53i = t17i - t49i;
+    const kiss_fft_scalar t54r = t36r*(kiss_fft_scalar)0.92387953251128674 - t36i*(kiss_fft_scalar)0.38268343236508978, t54i = t36i*(kiss_fft_scalar)0.92387953251128674 + t36r*(kiss_fft_scalar)0.38268343236508978;
+    const kiss_fft_scalar t55r = t45r*(kiss_fft_scalar)0.38268343236508984 - t45i*(kiss_fft_scalar)0.92387953251128674, t55i = t45i*(kiss_fft_scalar)0.38268343236508984 + t45r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t56r = t54r + t55r, t56i = t54i + t55i;
+    const kiss_fft_scalar t57r = t54r - t55r, t57i = t54i - t55i;
+    const kiss_fft_scalar t58r = -t57i, t58i = t57r;
+    const kiss_fft_scalar t59r = t25r + t56r, t59i = t25i + t56i;
+    const kiss_fft_scalar t60r = t25r - t56r, t60i = t25i - t56i;
+    const kiss_fft_scalar t61r = t26r + t58r, t61i = t26i + t58i;
+    const kiss_fft_scalar t62r = t26r - t58r, t62i = t26i - t58i;
+    const kiss_fft_scalar t63r = (t35r - t35i)*(kiss_fft_scalar)0.70710678118654757, t63i = (t35r + t35i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t64r = -(t44r + t44i)*(kiss_fft_scalar)0.70710678118654757, t64i = -(t44i - t44r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t65r = t63r + t64r, t65i = t63i + t64i;
+    const kiss_fft_scalar t66r = t63r - t64r, t66i = t63i - t64i;
+    const kiss_fft_scalar t67r = -t66i, t67i = t66r;
+    const kiss_fft_scalar t68r = t18r + t65r, t68i = t18i + t65i;
+    const kiss_fft_scalar t69r = t18r - t65r, t69i = t18i - t65i;
+    const kiss_fft_scalar t70r = t19r + t67r, t70i = t19i + t67i;
+    const kiss_fft_scalar t71r = t19r - t67r, t71i = t19i - t67i;
+    const kiss_fft_scalar t72r = t37r*(kiss_fft_scalar)0.38268343236508984 - t37i*(kiss_fft_scalar)0.92387953251128674, t72i = t37i*(kiss_fft_scalar)0.38268343236508984 + t37r*(kiss_fft_scalar)0.92387953251128674;
+    const kiss_fft_scalar t73r = t46r*(kiss_fft_scalar)-0.92387953251128685 + t46i*(kiss_fft_scalar)0.38268343236508967, t73i = t46i*(kiss_fft_scalar)-0.92387953251128685 - t46r*(kiss_fft_scalar)0.38268343236508967;
+    const kiss_fft_scalar t74r = t72r + t73r, t74i = t72i + t73i;
+    const kiss_fft_scalar t75r = t72r - t73r, t75i = t72i - t73i;
+    const kiss_fft_scalar t76r = -t75i, t76i = t75r;
+    const kiss_fft_scalar t77r = t27r + t74r, t77i = t27i + t74i;
+    const kiss_fft_scalar t78r = t27r - t74r, t78i = t27i - t74i;
+    const kiss_fft_scalar t79r = t28r + t76r, t79i = t28i + t76i;
+    const kiss_fft_scalar t80r = t28r - t76r, t80i = t28i - t76i;
+    Fout[0].r = t50r; Fout[0].i = t50i;
+    Fout[1].r = t59r; Fout[1].i = t59i;
+    Fout[2].r = t68r; Fout[2].i = t68i;
+    Fout[3].r = t77r; Fout[3].i = t77i;
+    Fout[4].r = t52r; Fout[4].i = t52i;
+    Fout[5].r = t61r; Fout[5].i = t61i;
+    Fout[6].r = t70r; Fout[6].i = t70i;
+    Fout[7].r = t79r; Fout[7].i = t79i;
+    Fout[8].r = t51r; Fout[8].i = t51i;
+    Fout[9].r = t60r; Fout[9].i = t60i;
+    Fout[10].r = t69r; Fout[10].i = t69i;
+    Fout[11].r = t78r; Fout[11].i = t78i;
+    Fout[12].r = t53r; Fout[12].i = t53i;
+    Fout[13].r = t62r; Fout[13].i = t62i;
+    Fout[14].r = t71r; Fout[14].i = t71i;
+    Fout[15].r = t80r; Fout[15].i = t80i;
+}
+
+static void kf_leaf8_fwd(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs)
+{
+    const kiss_fft_scalar t0r = f[0].r + f[4*fs].r, t0i = f[0].i + f[4*fs].i;
+    const kiss_fft_scalar t1r = f[0].r - f[4*fs].r, t1i = f[0].i - f[4*fs].i;
+    const kiss_fft_scalar t2r = f[2*fs].r + f[6*fs].r, t2i = f[2*fs].i + f[6*fs].i;
+    const kiss_fft_scalar t3r = f[2*fs].r - f[6*fs].r, t3i = f[2*fs].i - f[6*fs].i;
+    const kiss_fft_scalar t4r = t3i, t4i = -t3r;
+    const kiss_fft_scalar t5r = t0r + t2r, t5i = t0i + t2i;
+    const kiss_fft_scalar t6r = t0r - t2r, t6i = t0i - t2i;
+    const kiss_fft_scalar t7r = t1r + t4r, t7i = t1i + t4i;
+    const kiss_fft_scalar t8r = t1r - t4r, t8i = t1i - t4i;
+    const kiss_fft_scalar t9r = f[fs].r + f[5*fs].r, t9i = f[fs].i + f[5*fs].i;
+    const kiss_fft_scalar t10r = f[fs].r - f[5*fs].r, t10i = f[fs].i - f[5*fs].i;
+    const kiss_fft_scalar t11r = f[3*fs].r + f[7*fs].r, t11i = f[3*fs].i + f[7*fs].i;
+    const kiss_fft_scalar t12r = f[3*fs].r - f[7*fs].r, t12i = f[3*fs].i - f[7*fs].i;
+    const kiss_fft_scalar t13r = t9r + t11r, t13i = t9i + t11i;
+    const kiss_fft_scalar t14r = t9r - t11r, t14i = t9i - t11i;
+    const kiss_fft_scalar t15r = t14i, t15i = -t14r;
+    const kiss_fft_scalar t16r = t5r + t13r, t16i = t5i + t13i;
+    const kiss_fft_scalar t17r = t5r - t13r, t17i = t5i - t13i;
+    const kiss_fft_scalar t18r = t6r + t15r, t18i = t6i + t15i;
+    const kiss_fft_scalar t19r = t6r - t15r, t19i = t6i - t15i;
+    const kiss_fft_scalar t20r = (t10r + t10i)*(kiss_fft_scalar)0.70710678118654757, t20i = (t10i - t10r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t21r = -(t12r - t12i)*(kiss_fft_scalar)0.70710678118654757, t21i = -(t12r + t12i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t22r = t20r + t21r, t22i = t20i + t21i;
+    const kiss_fft_scalar t23r = t20r - t21r, t23i = t20i - t21i;
+    const kiss_fft_scalar t24r = t23i, t24i = -t23r;
+    const kiss_fft_scalar t25r = t7r + t22r, t25i = t7i + t22i;
+    const kiss_fft_scalar t26r = t7r - t22r, t26i = t7i - t22i;
+    const kiss_fft_scalar t27r = t8r + t24r, t27i = t8i + t24i;
+    const kiss_fft_scalar t28r = t8r - t24r, t28i = t8i - t24i;
+    Fout[0].r = t16r; Fout[0].i = t16i;
+    Fout[1].r = t25r; Fout[1].i = t25i;
+    Fout[2].r = t18r; Fout[2].i = t18i;
+    Fout[3].r = t27r; Fout[3].i = t27i;
+    Fout[4].r = t17r; Fout[4].i = t17i;
+    Fout[5].r = t26r; Fout[5].i = t26i;
+    Fout[6].r = t19r; Fout[6].i = t19i;
+    Fout[7].r = t28r; Fout[7].i = t28i;
+}
+
+static void kf_leaf8_inv(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs)
+{
+    const kiss_fft_scalar t0r = f[0].r + f[4*fs].r, t0i = f[0].i + f[4*fs].i;
+    const kiss_fft_scalar t1r = f[0].r - f[4*fs].r, t1i = f[0].i - f[4*fs].i;
+    const kiss_fft_scalar t2r = f[2*fs].r + f[6*fs].r, t2i = f[2*fs].i + f[6*fs].i;
+    const kiss_fft_scalar t3r = f[2*fs].r - f[6*fs].r, t3i = f[2*fs].i - f[6*fs].i;
+    const kiss_fft_scalar t4r = -t3i, t4i = t3r;
+    const kiss_fft_scalar t5r = t0r + t2r, t5i = t0i + t2i;
+    const kiss_fft_scalar t6r = t0r - t2r, t6i = t0i - t2i;
+    const kiss_fft_scalar t7r = t1r + t4r, t7i = t1i + t4i;
+    const kiss_fft_scalar t8r = t1r - t4r, t8i = t1i - t4i;
+    const kiss_fft_scalar t9r = f[fs].r + f[5*fs].r, t9i = f[fs].i + f[5*fs].i;
+    const kiss_fft_scalar t10r = f[fs].r - f[5*fs].r, t10i = f[fs].i - f[5*fs].i;
+    const kiss_fft_scalar t11r = f[3*fs].r + f[7*fs].r, t11i = f[3*fs].i + f[7*fs].i;
+    const kiss_fft_scalar t12r = f[3*fs].r - f[7*fs].r, t12i = f[3*fs].i - f[7*fs].i;
+    const kiss_fft_scalar t13r = t9r + t11r, t13i = t9i + t11i;
+    const kiss_fft_scalar t14r = t9r - t11r, t14i = t9i - t11i;
+    const kiss_fft_scalar t15r = -t14i, t15i = t14r;
+    const kiss_fft_scalar t16r = t5r + t13r, t16i = t5i + t13i;
+    const kiss_fft_scalar t17r = t5r - t13r, t17i = t5i - t13i;
+    const kiss_fft_scalar t18r = t6r + t15r, t18i = t6i + t15i;
+    const kiss_fft_scalar t19r = t6r - t15r, t19i = t6i - t15i;
+    const kiss_fft_scalar t20r = (t10r - t10i)*(kiss_fft_scalar)0.70710678118654757, t20i = (t10r + t10i)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t21r = -(t12r + t12i)*(kiss_fft_scalar)0.70710678118654757, t21i = -(t12i - t12r)*(kiss_fft_scalar)0.70710678118654757;
+    const kiss_fft_scalar t22r = t20r + t21r, t22i = t20i + t21i;
+    const kiss_fft_scalar t23r = t20r - t21r, t23i = t20i - t21i;
+    const kiss_fft_scalar t24r = -t23i, t24i = t23r;
+    const kiss_fft_scalar t25r = t7r + t22r, t25i = t7i + t22i;
+    const kiss_fft_scalar t26r = t7r - t22r, t26i = t7i - t22i;
+    const kiss_fft_scalar t27r = t8r + t24r, t27i = t8i + t24i;
+    const kiss_fft_scalar t28r = t8r - t24r, t28i = t8i - t24i;
+    Fout[0].r = t16r; Fout[0].i = t16i;
+    Fout[1].r = t25r; Fout[1].i = t25i;
+    Fout[2].r = t18r; Fout[2].i = t18i;
+    Fout[3].r = t27r; Fout[3].i = t27i;
+    Fout[4].r = t17r; Fout[4].i = t17i;
+    Fout[5].r = t26r; Fout[5].i = t26i;
+    Fout[6].r = t19r; Fout[6].i = t19i;
+    Fout[7].r = t28r; Fout[7].i = t28i;
+}
+
+/* Fout[0..n) = DFT of f[0], f[fs], ... f[(n-1)*fs]; n is one of the sizes above */
+static void kf_leaf(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs, int n, int inverse)
+{
+    switch (n) {
+        case 64: if (inverse) kf_leaf64_inv(Fout, f, fs); else kf_leaf64_fwd(Fout, f, fs); break;
+        case 32: if (inverse) kf_leaf32_inv(Fout, f, fs); else kf_leaf32_fwd(Fout, f, fs); break;
+        case 16: if (inverse) kf_leaf16_inv(Fout, f, fs); else kf_leaf16_fwd(Fout, f, fs); break;
+        case 8: if (inverse) kf_leaf8_inv(Fout, f, fs); else kf_leaf8_fwd(Fout, f, fs); break;
+    }
+}
+
+/* Largest codelet to finish an n-point plan with. Prefers one that leaves a power of 4 above it,
+   so the remaining stages are all radix 4; 0 when none divides n. */
+static int kf_leaf_size(int n)
+{
+    static const int sizes[] = {64, 32, 16, 8};
+    size_t i;
+    for (i = 0; i < sizeof(sizes)/sizeof(sizes[0]); ++i) {
+        int r = n / sizes[i];
+        if (n % sizes[i] == 0 && (r & (r - 1)) == 0 && (r & 0x55555555))
+            return sizes[i];
+    }
+    for (i = 0; i < sizeof(sizes)/sizeof(sizes[0]); ++i)
+        if (n % sizes[i] == 0)
+            return sizes[i];
+    return 0;
+}
+
+#endif
+#endif
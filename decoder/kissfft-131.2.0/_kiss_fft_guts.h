@@ -17,17 +17,49 @@
 #include "kiss_fft.h"
 #include "kiss_fft_log.h"
 #include <limits.h>
+#include <stdatomic.h>
 
 #define MAXFACTORS 32
+#define KF_STAGETW_ALIGN 64 /* bytes; a cache line, and an AVX-512 register */
 /* e.g. an fft of length 128 has 4 factors
  as far as kissfft is concerned
  4*4*4*2
  */
 
+/* kiss_fft_batch interleaves this many transforms, a multiple of the widest vector (8 floats),
+   as long as the block's two buffers fit in KISS_FFT_BATCH_BYTES. Past that (4096 points in float)
+   the block spills out of L2 and costs more than the narrow stages it saves. kiss_fftr_batch
+   works through its batch in runs of the same size. */
+#ifndef KISS_FFT_BATCH
+#define KISS_FFT_BATCH 8
+#endif
+#ifndef KISS_FFT_BATCH_BYTES
+#define KISS_FFT_BATCH_BYTES (512*1024)
+#endif
+
 struct kiss_fft_state{
     int nfft;
     int inverse;
     int factors[2*MAXFACTORS];
+    int vec; /* widest butterfly kernel to use, see _kiss_fft_vec.h */
+    int leaf; /* size of the codelet that ends the plan, 0 for none, see _kiss_fft_codelets.h */
+    int engine; /* KISS_FFT_ENGINE_RECURSIVE (kf_work) or KISS_FFT_ENGINE_STOCKHAM (kf_stockham) */
+    int threads; /* >1: kf_work runs its top stage in parallel, see _kiss_fft_pool.h */
+    /* per stage (p,m) of factors, radix 2-5 only: stagetw[i][(r-1)*m + k] = twiddles[r*k*nfft/(p*m)],
+       the order the butterflies read them in. Packed after twiddles[nfft] in the same block, each
+       table aligned to KF_STAGETW_ALIGN; NULL for generic radices, which index twiddles directly. */
+    kiss_fft_cpx * stagetw[MAXFACTORS];
+    /* Bluestein plans (large prime factors, see kf_bluestein): the power of two plan the convolution
+       runs through and its chirp transform, placed after the twiddles. NULL otherwise. */
+    kiss_fft_cfg bluestein;
+    kiss_fft_cpx * chirpfft;
+    /* scratch the plan owns (see KF_SCRATCH), after everything else: batchbuf for kiss_fft_batch's
+       interleaved block (NULL when the plan runs batches one transform at a time), nfft points for
+       Stockham and in-place transforms (2*M for Bluestein), genscratch for the largest generic radix */
+    kiss_fft_cpx * batchbuf;
+    kiss_fft_cpx * scratch;
+    kiss_fft_cpx * genscratch;
+    atomic_int scratchbusy, genbusy, batchbusy;
     kiss_fft_cpx twiddles[1];
 };
 
@@ -163,5 +195,15 @@ struct kiss_fft_state{
 #define  KISS_FFT_TMP_FREE(ptr) KISS_FFT_FREE(ptr)
 #endif
 
+/* n points of a plan's own scratch, so that a transform allocates nothing: mine, claimed through
+   the flag busy, unless another call on the same (shared, see kfc.h) plan holds it, in which case
+   a temporary buffer. KF_SCRATCH_PUT hands back whichever it was. */
+#define KF_SCRATCH(busy,mine,n) \
+    (atomic_exchange_explicit(busy,1,memory_order_acquire) == 0 ? (mine) \
+        : (kiss_fft_cpx*)KISS_FFT_TMP_ALLOC(sizeof(kiss_fft_cpx)*(n)))
+#define KF_SCRATCH_PUT(busy,mine,buf) \
+    do { if ((buf) == (mine)) atomic_store_explicit(busy,0,memory_order_release); \
+         else { KISS_FFT_TMP_FREE(buf); } } while (0)
+
 #endif /* _kiss_fft_guts_h */
 
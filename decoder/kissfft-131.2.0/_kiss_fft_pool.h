@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2003-2010, Mark Borgerding. All rights reserved.
+ *  This file is part of KISS FFT - https://github.com/mborgerding/kissfft
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  See COPYING file for more information.
+ */
+
+/* _kiss_fft_pool.h
+   How kissfft runs work in parallel: the top stage of kf_work and the blocks of the batch calls.
+
+   With KISS_FFT_THREADS (CMake KISSFFT_THREADS, make KISSFFT_THREADS=1) that is kiss_fft_pool.c,
+   a persistent pool of pinned workers with work-stealing deques; else OpenMP if the build has it;
+   else nothing. Either way a plan only goes parallel from a crossover size up (kf_plan_threads,
+   decided once at kiss_fft_alloc), so small transforms never touch a thread. The pool measures
+   its own crossover the first time it is asked; KISSFFT_THREADS_MIN in the environment sets it
+   instead, and KISSFFT_THREADS sets the number of threads (1 turns the pool off).
+ */
+
+#ifndef _kiss_fft_pool_h
+#define _kiss_fft_pool_h
+
+#include "_kiss_fft_guts.h"
+
+/* work units of n points and over go parallel with OpenMP, which has no calibration */
+#ifndef KISS_FFT_THREADS_MIN
+#define KISS_FFT_THREADS_MIN 16384
+#endif
+
+typedef void (*kf_task_fn)(void * arg,int i);
+
+#if defined(KISS_FFT_THREADS)
+
+/* threads to use for work of the given size in points: 1 below the crossover */
+int kf_pool_threads(size_t points);
+/* fn(arg,i) for i < n across the pool; returns once all have run. Safe from inside a task. */
+void kf_pool_for(int n,kf_task_fn fn,void * arg);
+
+#define kf_plan_threads(points) kf_pool_threads(points)
+#define kf_parallel_for(n,fn,arg) kf_pool_for(n,fn,arg)
+
+#elif defined(_OPENMP)
+#include <omp.h>
+
+static int kf_plan_threads(size_t points)
+{
+    const char * env = getenv("KISSFFT_THREADS_MIN");
+    size_t min = env ? (size_t)atol(env) : KISS_FFT_THREADS_MIN;
+    return points >= min ? omp_get_max_threads() : 1;
+}
+
+static void kf_parallel_for(int n,kf_task_fn fn,void * arg)
+{
+    int i;
+#   pragma omp parallel for if (n > 1)
+    for (i=0;i<n;++i)
+        fn(arg,i);
+}
+
+#else
+
+#define kf_plan_threads(points) 1
+
+static void kf_parallel_for(int n,kf_task_fn fn,void * arg)
+{
+    int i;
+    for (i=0;i<n;++i)
+        fn(arg,i);
+}
+
+#endif
+
+#endif /* _kiss_fft_pool_h */
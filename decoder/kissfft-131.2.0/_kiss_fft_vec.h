@@ -0,0 +1,633 @@
+/*
+ *  Copyright (c) 2003-2010, Mark Borgerding. All rights reserved.
+ *  This file is part of KISS FFT - https://github.com/mborgerding/kissfft
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  See COPYING file for more information.
+ */
+
+/* _kiss_fft_vec.h
+   Vectorised radix 2,3,4,5 butterflies for the float and int16 builds, working inside a single transform
+   (unlike USE_SIMD, which runs 4 separate transforms side by side).
+
+   The k loop of every butterfly is independent, so W consecutive k's go into one vector:
+   4 complex values per AVX2 register (2 per half register for m==2 stages), 8 per AVX-512
+   register, 2 per NEON register. Complex
+   products use FMA. On x86 the kernels are compiled with target attributes and picked at
+   kiss_fft_alloc time from the running CPU, so one binary runs everywhere.
+
+   A stage only takes a vector kernel when m is a multiple of W; anything else (and the m==1
+   leaves) stays on the scalar code. The Stockham engine's stages (kf_vstockN) vectorise along q
+   instead and need s to be a multiple of W, so its last stage (s==1) is scalar in the float build. The data layout and the results are those of the scalar
+   path, up to float rounding.
+
+   The 16 bit fixed point build has its own kernels (_kiss_fft_vec_q15.h): SSSE3 (4 complex values
+   per __m128i) and AVX2 (8 per __m256i) on x86, NEON (8 per int16x8x2_t, real and imaginary parts
+   apart) on AArch64. Those reproduce the scalar rounding exactly, so their output is the scalar
+   path's bit for bit. The int32_t build stays scalar.
+
+   Set the environment variable KISSFFT_SIMD to "scalar", "ssse3", "avx2", "avx512" or "neon" before
+   kiss_fft_alloc to cap the instruction set, e.g. to compare against the scalar path.
+ */
+
+#ifndef _kiss_fft_vec_h
+#define _kiss_fft_vec_h
+
+#define KF_VEC_SCALAR 0
+#define KF_VEC_NEON   1
+#define KF_VEC_SSSE3  1 /* the 128 bit set of x86, as NEON is of ARM; fixed point only */
+#define KF_VEC_AVX2   2
+#define KF_VEC_AVX512 3
+
+#if !defined(FIXED_POINT) && !defined(USE_SIMD) && !defined(KISS_FFT_NO_VEC) \
+    && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  define KF_VEC_X86 1
+#  include <immintrin.h>
+#elif !defined(FIXED_POINT) && !defined(USE_SIMD) && !defined(KISS_FFT_NO_VEC) \
+    && defined(__aarch64__) && defined(__ARM_NEON)
+#  define KF_VEC_ARM 1
+#  include <arm_neon.h>
+#elif defined(FIXED_POINT) && (FIXED_POINT != 32) && !defined(KISS_FFT_NO_VEC) \
+    && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  define KF_VEC_X86_Q15 1
+#  include <immintrin.h>
+#elif defined(FIXED_POINT) && (FIXED_POINT != 32) && !defined(KISS_FFT_NO_VEC) \
+    && defined(__aarch64__) && defined(__ARM_NEON)
+#  define KF_VEC_ARM_Q15 1
+#  include <arm_neon.h>
+#endif
+
+#if defined(KF_VEC_X86)
+
+/* ---- AVX2 + FMA: 4 complex floats per __m256 ---- */
+#define KF_W 4
+#define KF_V __m256
+#define KF_M __m256i
+#define KF_TARGET __attribute__((target("avx2,fma")))
+#define KF_NAME(x) x##_avx2
+#define V_BCAST(p) _mm256_castpd_ps(_mm256_broadcast_sd((const double*)(p)))
+#define V_LOAD(p) _mm256_loadu_ps((const float*)(p))
+#define V_STORE(p,v) _mm256_storeu_ps((float*)(p),(v))
+#define V_ADD _mm256_add_ps
+#define V_SUB _mm256_sub_ps
+#define V_SCALE(a,s) _mm256_mul_ps((a),_mm256_set1_ps(s))
+#define V_FMA_SCALE(c,a,s) _mm256_fmadd_ps((a),_mm256_set1_ps(s),(c))
+/* (ar*br - ai*bi, ai*br + ar*bi) on every even/odd pair */
+#define V_CMUL(a,b) _mm256_fmaddsub_ps((a),_mm256_moveldup_ps(b), \
+                        _mm256_mul_ps(_mm256_permute_ps((a),0xB1),_mm256_movehdup_ps(b)))
+#define V_SWAP(a) _mm256_permute_ps((a),0xB1)
+/* Sign masks stay integer: as float constants they are -0.0, which -ffast-math may fold to +0.0 */
+#define V_FLIP(a,m) _mm256_castsi256_ps(_mm256_xor_si256(_mm256_castps_si256(a),(m)))
+#define V_MASK_ODD  _mm256_set1_epi64x((long long)0x8000000000000000ULL)
+#define V_MASK_EVEN _mm256_set1_epi64x(0x80000000LL)
+#include "_kiss_fft_vec_bfly.h"
+#undef KF_W
+#undef KF_V
+#undef KF_M
+#undef KF_TARGET
+#undef KF_NAME
+#undef V_LOAD
+#undef V_STORE
+#undef V_ADD
+#undef V_SUB
+#undef V_SCALE
+#undef V_FMA_SCALE
+#undef V_CMUL
+#undef V_SWAP
+#undef V_FLIP
+#undef V_MASK_ODD
+#undef V_MASK_EVEN
+#undef V_BCAST
+
+/* ---- Same instruction set on 128-bit halves, for the m==2 stages: 2 complex floats per __m128 ---- */
+#define KF_W 2
+#define KF_V __m128
+#define KF_M __m128i
+#define KF_TARGET __attribute__((target("avx2,fma")))
+#define KF_NAME(x) x##_avx2x2
+#define V_BCAST(p) _mm_castpd_ps(_mm_loaddup_pd((const double*)(p)))
+#define V_LOAD(p) _mm_loadu_ps((const float*)(p))
+#define V_STORE(p,v) _mm_storeu_ps((float*)(p),(v))
+#define V_ADD _mm_add_ps
+#define V_SUB _mm_sub_ps
+#define V_SCALE(a,s) _mm_mul_ps((a),_mm_set1_ps(s))
+#define V_FMA_SCALE(c,a,s) _mm_fmadd_ps((a),_mm_set1_ps(s),(c))
+#define V_CMUL(a,b) _mm_fmaddsub_ps((a),_mm_moveldup_ps(b),_mm_mul_ps(_mm_permute_ps((a),0xB1),_mm_movehdup_ps(b)))
+#define V_SWAP(a) _mm_permute_ps((a),0xB1)
+#define V_FLIP(a,m) _mm_castsi128_ps(_mm_xor_si128(_mm_castps_si128(a),(m)))
+#define V_MASK_ODD  _mm_set1_epi64x((long long)0x8000000000000000ULL)
+#define V_MASK_EVEN _mm_set1_epi64x(0x80000000LL)
+#include "_kiss_fft_vec_bfly.h"
+#undef KF_W
+#undef KF_V
+#undef KF_M
+#undef KF_TARGET
+#undef KF_NAME
+#undef V_LOAD
+#undef V_STORE
+#undef V_ADD
+#undef V_SUB
+#undef V_SCALE
+#undef V_FMA_SCALE
+#undef V_CMUL
+#undef V_SWAP
+#undef V_FLIP
+#undef V_MASK_ODD
+#undef V_MASK_EVEN
+#undef V_BCAST
+
+/* ---- AVX-512F: 8 complex floats per __m512 ---- */
+#define KF_W 8
+#define KF_V __m512
+#define KF_M __m512i
+#define KF_TARGET __attribute__((target("avx512f")))
+#define KF_NAME(x) x##_avx512
+#define V_BCAST(p) _mm512_castpd_ps(_mm512_broadcastsd_pd(_mm_load_sd((const double*)(p))))
+#define V_LOAD(p) _mm512_loadu_ps((const float*)(p))
+#define V_STORE(p,v) _mm512_storeu_ps((float*)(p),(v))
+#define V_ADD _mm512_add_ps
+#define V_SUB _mm512_sub_ps
+#define V_SCALE(a,s) _mm512_mul_ps((a),_mm512_set1_ps(s))
+#define V_FMA_SCALE(c,a,s) _mm512_fmadd_ps((a),_mm512_set1_ps(s),(c))
+#define V_CMUL(a,b) _mm512_fmaddsub_ps((a),_mm512_moveldup_ps(b), \
+                        _mm512_mul_ps(_mm512_permute_ps((a),0xB1),_mm512_movehdup_ps(b)))
+#define V_SWAP(a) _mm512_permute_ps((a),0xB1)
+#define V_FLIP(a,m) _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a),(m)))
+#define V_MASK_ODD  _mm512_set1_epi64((long long)0x8000000000000000ULL)
+#define V_MASK_EVEN _mm512_set1_epi64(0x80000000LL)
+#include "_kiss_fft_vec_bfly.h"
+#undef KF_W
+#undef KF_V
+#undef KF_M
+#undef KF_TARGET
+#undef KF_NAME
+#undef V_LOAD
+#undef V_STORE
+#undef V_ADD
+#undef V_SUB
+#undef V_SCALE
+#undef V_FMA_SCALE
+#undef V_CMUL
+#undef V_SWAP
+#undef V_FLIP
+#undef V_MASK_ODD
+#undef V_MASK_EVEN
+#undef V_BCAST
+
+#elif defined(KF_VEC_ARM)
+
+/* ---- NEON (AArch64): 2 complex floats per float32x4_t, always present ---- */
+#define KF_W 2
+#define KF_V float32x4_t
+#define KF_M float32x4_t
+#define KF_TARGET
+#define KF_NAME(x) x##_neon
+#define V_BCAST(p) vcombine_f32(vld1_f32((const float*)(p)), vld1_f32((const float*)(p)))
+#define V_LOAD(p) vld1q_f32((const float*)(p))
+#define V_STORE(p,v) vst1q_f32((float*)(p),(v))
+#define V_ADD vaddq_f32
+#define V_SUB vsubq_f32
+#define V_SCALE(a,s) vmulq_n_f32((a),(s))
+#define V_FMA_SCALE(c,a,s) vfmaq_n_f32((c),(a),(s))
+static inline float32x4_t kf_neon_cmul(float32x4_t a, float32x4_t b)
+{
+    static const float sign[4] = { -1.f, 1.f, -1.f, 1.f };
+    float32x4_t t = vmulq_f32(a, vtrn1q_f32(b, b));            /* ar*br, ai*br */
+    float32x4_t u = vmulq_f32(vrev64q_f32(a), vtrn2q_f32(b, b)); /* ai*bi, ar*bi */
+    return vfmaq_f32(t, u, vld1q_f32(sign));
+}
+#define V_CMUL(a,b) kf_neon_cmul((a),(b))
+#define V_SWAP(a) vrev64q_f32(a)
+#define V_FLIP(a,m) vmulq_f32((a),(m))
+#define V_MASK_ODD  kf_neon_signs(1.f,-1.f)
+#define V_MASK_EVEN kf_neon_signs(-1.f,1.f)
+static inline float32x4_t kf_neon_signs(float even, float odd)
+{
+    float s[4];
+    s[0] = s[2] = even;
+    s[1] = s[3] = odd;
+    return vld1q_f32(s);
+}
+#include "_kiss_fft_vec_bfly.h"
+
+#elif defined(KF_VEC_X86_Q15)
+
+/* Q15 twiddles w = (br,bi) are kept as (br,-bi) and (bi,br): pmaddwd of a complex value with each
+   gives ar*br - ai*bi and ar*bi + ai*br, summed in 32 bits as C_MUL does. The twiddles never reach
+   -32768 (KISS_FFT_COS/SIN), so negating bi is exact. sround of a 32 bit x is bits 15..30 of
+   x + 2^14, i.e. the high half of (x + 2^14) << 1, which puts the imaginary part in place and
+   truncates both parts as the scalar casts do. pmulhrsw is (a*b + 2^14) >> 15 truncated: S_MUL. */
+typedef struct { __m128i re, im; } kf_qtw_128;
+typedef struct { __m256i re, im; } kf_qtw_256;
+
+static inline __attribute__((target("ssse3"))) kf_qtw_128 kf_qtw_ssse3(__m128i w)
+{
+    kf_qtw_128 t;
+    t.re = _mm_sign_epi16(w, _mm_set1_epi32((int)0xFFFF0001));
+    t.im = _mm_shufflehi_epi16(_mm_shufflelo_epi16(w, 0xB1), 0xB1);
+    return t;
+}
+
+static inline __attribute__((target("ssse3"))) __m128i kf_qcmul_ssse3(__m128i a, kf_qtw_128 w)
+{
+    const __m128i rnd = _mm_set1_epi32(1 << 14);
+    __m128i re = _mm_slli_epi32(_mm_add_epi32(_mm_madd_epi16(a, w.re), rnd), 1);
+    __m128i im = _mm_slli_epi32(_mm_add_epi32(_mm_madd_epi16(a, w.im), rnd), 1);
+    return _mm_or_si128(_mm_srli_epi32(re, 16), _mm_and_si128(im, _mm_set1_epi32((int)0xFFFF0000)));
+}
+
+static inline __attribute__((target("avx2"))) kf_qtw_256 kf_qtw_avx2(__m256i w)
+{
+    kf_qtw_256 t;
+    t.re = _mm256_sign_epi16(w, _mm256_set1_epi32((int)0xFFFF0001));
+    t.im = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(w, 0xB1), 0xB1);
+    return t;
+}
+
+static inline __attribute__((target("avx2"))) __m256i kf_qcmul_avx2(__m256i a, kf_qtw_256 w)
+{
+    const __m256i rnd = _mm256_set1_epi32(1 << 14);
+    __m256i re = _mm256_slli_epi32(_mm256_add_epi32(_mm256_madd_epi16(a, w.re), rnd), 1);
+    __m256i im = _mm256_slli_epi32(_mm256_add_epi32(_mm256_madd_epi16(a, w.im), rnd), 1);
+    return _mm256_blend_epi16(_mm256_srli_epi32(re, 16), im, 0xAA);
+}
+
+/* ---- SSSE3: 4 complex int16 per __m128i ---- */
+#define KF_W 4
+#define KF_V __m128i
+#define KF_T kf_qtw_128
+#define KF_M __m128i
+#define KF_TARGET __attribute__((target("ssse3")))
+#define KF_NAME(x) x##_ssse3
+#define V_LOAD(p) _mm_loadu_si128((const __m128i*)(p))
+#define V_STORE(p,v) _mm_storeu_si128((__m128i*)(p),(v))
+#define V_TLOAD(p) kf_qtw_ssse3(V_LOAD(p))
+#define V_TBCAST(p) kf_qtw_ssse3(_mm_castps_si128(_mm_load1_ps((const float*)(p))))
+#define V_ADD _mm_add_epi16
+#define V_SUB _mm_sub_epi16
+#define V_HALF(a) _mm_srai_epi16((a),1)
+#define V_MULS(a,k) _mm_mulhrs_epi16((a),_mm_set1_epi16(k))
+#define V_CMUL kf_qcmul_ssse3
+#define V_SWAP(a) _mm_shufflehi_epi16(_mm_shufflelo_epi16((a),0xB1),0xB1)
+#define V_FLIP(a,m) _mm_sign_epi16((a),(m))
+#define V_MASK_ODD  _mm_set1_epi32((int)0xFFFF0001)
+#define V_MASK_EVEN _mm_set1_epi32(0x0001FFFF)
+#include "_kiss_fft_vec_q15.h"
+#undef KF_W
+#undef KF_V
+#undef KF_T
+#undef KF_M
+#undef KF_TARGET
+#undef KF_NAME
+#undef V_LOAD
+#undef V_STORE
+#undef V_TLOAD
+#undef V_TBCAST
+#undef V_ADD
+#undef V_SUB
+#undef V_HALF
+#undef V_MULS
+#undef V_CMUL
+#undef V_SWAP
+#undef V_FLIP
+#undef V_MASK_ODD
+#undef V_MASK_EVEN
+
+/* ---- AVX2: 8 complex int16 per __m256i ---- */
+#define KF_W 8
+#define KF_V __m256i
+#define KF_T kf_qtw_256
+#define KF_M __m256i
+#define KF_TARGET __attribute__((target("avx2")))
+#define KF_NAME(x) x##_avx2
+#define V_LOAD(p) _mm256_loadu_si256((const __m256i*)(p))
+#define V_STORE(p,v) _mm256_storeu_si256((__m256i*)(p),(v))
+#define V_TLOAD(p) kf_qtw_avx2(V_LOAD(p))
+#define V_TBCAST(p) kf_qtw_avx2(_mm256_castps_si256(_mm256_broadcast_ss((const float*)(p))))
+#define V_ADD _mm256_add_epi16
+#define V_SUB _mm256_sub_epi16
+#define V_HALF(a) _mm256_srai_epi16((a),1)
+#define V_MULS(a,k) _mm256_mulhrs_epi16((a),_mm256_set1_epi16(k))
+#define V_CMUL kf_qcmul_avx2
+#define V_SWAP(a) _mm256_shufflehi_epi16(_mm256_shufflelo_epi16((a),0xB1),0xB1)
+#define V_FLIP(a,m) _mm256_sign_epi16((a),(m))
+#define V_MASK_ODD  _mm256_set1_epi32((int)0xFFFF0001)
+#define V_MASK_EVEN _mm256_set1_epi32(0x0001FFFF)
+#include "_kiss_fft_vec_q15.h"
+#undef KF_W
+#undef KF_V
+#undef KF_T
+#undef KF_M
+#undef KF_TARGET
+#undef KF_NAME
+#undef V_LOAD
+#undef V_STORE
+#undef V_TLOAD
+#undef V_TBCAST
+#undef V_ADD
+#undef V_SUB
+#undef V_HALF
+#undef V_MULS
+#undef V_CMUL
+#undef V_SWAP
+#undef V_FLIP
+#undef V_MASK_ODD
+#undef V_MASK_EVEN
+
+#elif defined(KF_VEC_ARM_Q15)
+
+/* ---- NEON (AArch64): 8 complex int16 per int16x8x2_t, real parts in val[0], imaginary in val[1] ----
+   vld2/vst2 split and rejoin the interleaved kiss_fft_cpx. C_MUL is vmull/vmlsl into 32 bits, then
+   vrshrn, which rounds like sround and narrows without saturating. vqrdmulh is S_MUL except that it
+   saturates -32768 * -32768; one side is always a twiddle or SAMP_MAX/n, never -32768. */
+static inline int16x8x2_t kf_qadd_neon(int16x8x2_t a, int16x8x2_t b)
+{
+    a.val[0] = vaddq_s16(a.val[0], b.val[0]);
+    a.val[1] = vaddq_s16(a.val[1], b.val[1]);
+    return a;
+}
+
+static inline int16x8x2_t kf_qsub_neon(int16x8x2_t a, int16x8x2_t b)
+{
+    a.val[0] = vsubq_s16(a.val[0], b.val[0]);
+    a.val[1] = vsubq_s16(a.val[1], b.val[1]);
+    return a;
+}
+
+static inline int16x8x2_t kf_qhalf_neon(int16x8x2_t a)
+{
+    a.val[0] = vshrq_n_s16(a.val[0], 1);
+    a.val[1] = vshrq_n_s16(a.val[1], 1);
+    return a;
+}
+
+static inline int16x8x2_t kf_qmuls_neon(int16x8x2_t a, int16_t k)
+{
+    a.val[0] = vqrdmulhq_n_s16(a.val[0], k);
+    a.val[1] = vqrdmulhq_n_s16(a.val[1], k);
+    return a;
+}
+
+static inline int16x8x2_t kf_qcmul_neon(int16x8x2_t a, int16x8x2_t w)
+{
+    int16x8x2_t c;
+    int32x4_t rl = vmlsl_s16(vmull_s16(vget_low_s16(a.val[0]), vget_low_s16(w.val[0])),
+                             vget_low_s16(a.val[1]), vget_low_s16(w.val[1]));
+    int32x4_t rh = vmlsl_high_s16(vmull_high_s16(a.val[0], w.val[0]), a.val[1], w.val[1]);
+    int32x4_t il = vmlal_s16(vmull_s16(vget_low_s16(a.val[0]), vget_low_s16(w.val[1])),
+                             vget_low_s16(a.val[1]), vget_low_s16(w.val[0]));
+    int32x4_t ih = vmlal_high_s16(vmull_high_s16(a.val[0], w.val[1]), a.val[1], w.val[0]);
+    c.val[0] = vrshrn_high_n_s32(vrshrn_n_s32(rl, 15), rh, 15);
+    c.val[1] = vrshrn_high_n_s32(vrshrn_n_s32(il, 15), ih, 15);
+    return c;
+}
+
+static inline int16x8x2_t kf_qswap_neon(int16x8x2_t a)
+{
+    int16x8x2_t b;
+    b.val[0] = a.val[1];
+    b.val[1] = a.val[0];
+    return b;
+}
+
+/* multiplying by -1 wraps -32768 to itself, as the scalar negation does */
+static inline int16x8x2_t kf_qflip_neon(int16x8x2_t a, int16x8x2_t m)
+{
+    a.val[0] = vmulq_s16(a.val[0], m.val[0]);
+    a.val[1] = vmulq_s16(a.val[1], m.val[1]);
+    return a;
+}
+
+static inline int16x8x2_t kf_qsigns_neon(int16_t re, int16_t im)
+{
+    int16x8x2_t m;
+    m.val[0] = vdupq_n_s16(re);
+    m.val[1] = vdupq_n_s16(im);
+    return m;
+}
+
+#define KF_W 8
+#define KF_V int16x8x2_t
+#define KF_T int16x8x2_t
+#define KF_M int16x8x2_t
+#define KF_TARGET
+#define KF_NAME(x) x##_neon
+#define V_LOAD(p) vld2q_s16((const int16_t*)(p))
+#define V_STORE(p,v) vst2q_s16((int16_t*)(p),(v))
+#define V_TLOAD(p) V_LOAD(p)
+#define V_TBCAST(p) vld2q_dup_s16((const int16_t*)(p))
+#define V_ADD kf_qadd_neon
+#define V_SUB kf_qsub_neon
+#define V_HALF kf_qhalf_neon
+#define V_MULS kf_qmuls_neon
+#define V_CMUL kf_qcmul_neon
+#define V_SWAP kf_qswap_neon
+#define V_FLIP kf_qflip_neon
+#define V_MASK_ODD  kf_qsigns_neon(1,-1)
+#define V_MASK_EVEN kf_qsigns_neon(-1,1)
+#include "_kiss_fft_vec_q15.h"
+
+#endif
+
+/* Widest instruction set this CPU (and KISSFFT_SIMD) allows. Called from kiss_fft_alloc. */
+static int kf_vec_level(void)
+{
+    int level = KF_VEC_SCALAR;
+    const char *cap;
+#if defined(KF_VEC_X86_Q15)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("ssse3"))
+        level = KF_VEC_SSSE3;
+    if (__builtin_cpu_supports("avx2"))
+        level = KF_VEC_AVX2;
+#elif defined(KF_VEC_ARM_Q15)
+    level = KF_VEC_NEON;
+#else
+    if (sizeof(kiss_fft_scalar) != sizeof(float))
+        return KF_VEC_SCALAR; /* the kernels are float only */
+#if defined(KF_VEC_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        level = KF_VEC_AVX2;
+    if (__builtin_cpu_supports("avx512f"))
+        level = KF_VEC_AVX512;
+#elif defined(KF_VEC_ARM)
+    level = KF_VEC_NEON;
+#endif
+#endif
+    cap = getenv("KISSFFT_SIMD");
+    if (cap) {
+        int limit = level;
+        if (strcmp(cap, "scalar") == 0) limit = KF_VEC_SCALAR;
+        else if (strcmp(cap, "neon") == 0) limit = KF_VEC_NEON;
+        else if (strcmp(cap, "ssse3") == 0) limit = KF_VEC_SSSE3;
+        else if (strcmp(cap, "avx2") == 0) limit = KF_VEC_AVX2;
+        if (limit < level)
+            level = limit;
+    }
+    return level;
+}
+
+/* Runs the stage's butterfly with the widest kernel whose width divides m. Returns 0 if it is the scalar code's job. */
+static int kf_vec_bfly(kiss_fft_cpx * Fout, const kiss_fft_cfg st, const kiss_fft_cpx * stw, int m, int p)
+{
+    size_t um = (size_t)m;
+    if (st->vec == KF_VEC_SCALAR || p > 5)
+        return 0;
+#if defined(KF_VEC_X86)
+    if (st->vec >= KF_VEC_AVX512 && um % 8 == 0) {
+        switch (p) {
+            case 2: kf_vbfly2_avx512(Fout,st,stw,um); return 1;
+            case 3: kf_vbfly3_avx512(Fout,st,stw,um); return 1;
+            case 4: kf_vbfly4_avx512(Fout,st,stw,um); return 1;
+            case 5: kf_vbfly5_avx512(Fout,st,stw,um); return 1;
+        }
+    }
+    if (st->vec >= KF_VEC_AVX2 && um % 4 == 0) {
+        switch (p) {
+            case 2: kf_vbfly2_avx2(Fout,st,stw,um); return 1;
+            case 3: kf_vbfly3_avx2(Fout,st,stw,um); return 1;
+            case 4: kf_vbfly4_avx2(Fout,st,stw,um); return 1;
+            case 5: kf_vbfly5_avx2(Fout,st,stw,um); return 1;
+        }
+    }
+    if (st->vec >= KF_VEC_AVX2 && um % 2 == 0) {
+        switch (p) {
+            case 2: kf_vbfly2_avx2x2(Fout,st,stw,um); return 1;
+            case 3: kf_vbfly3_avx2x2(Fout,st,stw,um); return 1;
+            case 4: kf_vbfly4_avx2x2(Fout,st,stw,um); return 1;
+            case 5: kf_vbfly5_avx2x2(Fout,st,stw,um); return 1;
+        }
+    }
+#elif defined(KF_VEC_ARM)
+    if (um % 2 == 0) {
+        switch (p) {
+            case 2: kf_vbfly2_neon(Fout,st,stw,um); return 1;
+            case 3: kf_vbfly3_neon(Fout,st,stw,um); return 1;
+            case 4: kf_vbfly4_neon(Fout,st,stw,um); return 1;
+            case 5: kf_vbfly5_neon(Fout,st,stw,um); return 1;
+        }
+    }
+#elif defined(KF_VEC_X86_Q15)
+    if (st->vec >= KF_VEC_AVX2 && um % 8 == 0) {
+        switch (p) {
+            case 2: kf_qbfly2_avx2(Fout,st,stw,um); return 1;
+            case 3: kf_qbfly3_avx2(Fout,st,stw,um); return 1;
+            case 4: kf_qbfly4_avx2(Fout,st,stw,um); return 1;
+            case 5: kf_qbfly5_avx2(Fout,st,stw,um); return 1;
+        }
+    }
+    if (um % 4 == 0) {
+        switch (p) {
+            case 2: kf_qbfly2_ssse3(Fout,st,stw,um); return 1;
+            case 3: kf_qbfly3_ssse3(Fout,st,stw,um); return 1;
+            case 4: kf_qbfly4_ssse3(Fout,st,stw,um); return 1;
+            case 5: kf_qbfly5_ssse3(Fout,st,stw,um); return 1;
+        }
+    }
+#elif defined(KF_VEC_ARM_Q15)
+    if (um % 8 == 0) {
+        switch (p) {
+            case 2: kf_qbfly2_neon(Fout,st,stw,um); return 1;
+            case 3: kf_qbfly3_neon(Fout,st,stw,um); return 1;
+            case 4: kf_qbfly4_neon(Fout,st,stw,um); return 1;
+            case 5: kf_qbfly5_neon(Fout,st,stw,um); return 1;
+        }
+    }
+#else
+    (void)Fout; (void)stw; (void)um;
+#endif
+    return 0;
+}
+
+#if defined(KF_VEC_X86_Q15) || defined(KF_VEC_ARM_Q15)
+/* The last Stockham stage (s == 1) has no q to run along: it reads x[p*j + r]. Copied to y as
+   y[j + r*m] that is the recursive engine's stage, kf_qbflyN on y in place, with the same
+   twiddles and the same results. In fixed point the copy costs far less than the scalar stage. */
+static int kf_qstock_last(const kiss_fft_cpx * x, kiss_fft_cpx * y, const kiss_fft_cfg st, const kiss_fft_cpx * stw, int p, size_t m)
+{
+    size_t j;
+    int r;
+    for (j = 0; j < m; ++j)
+        for (r = 0; r < p; ++r)
+            y[j + r*m] = x[p*j + r];
+    return kf_vec_bfly(y,st,stw,(int)m,p);
+}
+#endif
+
+/* Runs a Stockham stage with the widest kernel whose width divides s. Returns 0 if it is the scalar code's job. */
+static int kf_vec_stock(const kiss_fft_cpx * x, kiss_fft_cpx * y, const kiss_fft_cfg st, const kiss_fft_cpx * stw, int p, size_t s, size_t m)
+{
+    if (st->vec == KF_VEC_SCALAR || p > 5)
+        return 0;
+#if defined(KF_VEC_X86)
+    if (st->vec >= KF_VEC_AVX512 && s % 8 == 0) {
+        switch (p) {
+            case 2: kf_vstock2_avx512(x,y,st,stw,s,m); return 1;
+            case 3: kf_vstock3_avx512(x,y,st,stw,s,m); return 1;
+            case 4: kf_vstock4_avx512(x,y,st,stw,s,m); return 1;
+            case 5: kf_vstock5_avx512(x,y,st,stw,s,m); return 1;
+        }
+    }
+    if (st->vec >= KF_VEC_AVX2 && s % 4 == 0) {
+        switch (p) {
+            case 2: kf_vstock2_avx2(x,y,st,stw,s,m); return 1;
+            case 3: kf_vstock3_avx2(x,y,st,stw,s,m); return 1;
+            case 4: kf_vstock4_avx2(x,y,st,stw,s,m); return 1;
+            case 5: kf_vstock5_avx2(x,y,st,stw,s,m); return 1;
+        }
+    }
+    if (st->vec >= KF_VEC_AVX2 && s % 2 == 0) {
+        switch (p) {
+            case 2: kf_vstock2_avx2x2(x,y,st,stw,s,m); return 1;
+            case 3: kf_vstock3_avx2x2(x,y,st,stw,s,m); return 1;
+            case 4: kf_vstock4_avx2x2(x,y,st,stw,s,m); return 1;
+            case 5: kf_vstock5_avx2x2(x,y,st,stw,s,m); return 1;
+        }
+    }
+#elif defined(KF_VEC_ARM)
+    if (s % 2 == 0) {
+        switch (p) {
+            case 2: kf_vstock2_neon(x,y,st,stw,s,m); return 1;
+            case 3: kf_vstock3_neon(x,y,st,stw,s,m); return 1;
+            case 4: kf_vstock4_neon(x,y,st,stw,s,m); return 1;
+            case 5: kf_vstock5_neon(x,y,st,stw,s,m); return 1;
+        }
+    }
+#elif defined(KF_VEC_X86_Q15)
+    if (s == 1 && m % 4 == 0 && x != y)
+        return kf_qstock_last(x,y,st,stw,p,m);
+    if (st->vec >= KF_VEC_AVX2 && s % 8 == 0) {
+        switch (p) {
+            case 2: kf_qstock2_avx2(x,y,st,stw,s,m); return 1;
+            case 3: kf_qstock3_avx2(x,y,st,stw,s,m); return 1;
+            case 4: kf_qstock4_avx2(x,y,st,stw,s,m); return 1;
+            case 5: kf_qstock5_avx2(x,y,st,stw,s,m); return 1;
+        }
+    }
+    if (s % 4 == 0) {
+        switch (p) {
+            case 2: kf_qstock2_ssse3(x,y,st,stw,s,m); return 1;
+            case 3: kf_qstock3_ssse3(x,y,st,stw,s,m); return 1;
+            case 4: kf_qstock4_ssse3(x,y,st,stw,s,m); return 1;
+            case 5: kf_qstock5_ssse3(x,y,st,stw,s,m); return 1;
+        }
+    }
+#elif defined(KF_VEC_ARM_Q15)
+    if (s == 1 && m % 8 == 0 && x != y)
+        return kf_qstock_last(x,y,st,stw,p,m);
+    if (s % 8 == 0) {
+        switch (p) {
+            case 2: kf_qstock2_neon(x,y,st,stw,s,m); return 1;
+            case 3: kf_qstock3_neon(x,y,st,stw,s,m); return 1;
+            case 4: kf_qstock4_neon(x,y,st,stw,s,m); return 1;
+            case 5: kf_qstock5_neon(x,y,st,stw,s,m); return 1;
+        }
+    }
+#else
+    (void)x; (void)y; (void)stw; (void)s; (void)m;
+#endif
+    return 0;
+}
+
+#endif /* _kiss_fft_vec_h */
@@ -0,0 +1,215 @@
+/*
+ *  Copyright (c) 2003-2010, Mark Borgerding. All rights reserved.
+ *  This file is part of KISS FFT - https://github.com/mborgerding/kissfft
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  See COPYING file for more information.
+ */
+
+/* _kiss_fft_vec_q15.h
+   Butterfly bodies for the 16 bit fixed point build, the counterpart of _kiss_fft_vec_bfly.h.
+   Included by _kiss_fft_vec.h once per instruction set, with KF_W (complex values per vector),
+   KF_V, KF_T (a vector of twiddles in whatever form V_CMUL wants them), KF_M, KF_TARGET, KF_NAME()
+   and the V_* operations defined.
+
+   Unlike the float kernels these give the scalar code's results bit for bit, so every operation
+   stands for exactly one of the macros in _kiss_fft_guts.h and they come in the same order:
+     V_ADD, V_SUB   C_ADD/C_SUB: int16 lanes that wrap, as the scalar stores to kiss_fft_scalar do
+     V_CMUL         C_MUL: both products summed in 32 bits, then one sround
+     V_MULS(a,k)    S_MUL (and C_FIXDIV, C_MULBYSCALAR) of every component by the constant k
+     V_HALF         HALF_OF
+   S_MUL rounds each product, so a sum of two S_MULs is never folded into one multiply, and
+   -S_MUL(a,k) is never written as S_MUL(a,-k). V_SWAP then V_FLIP with V_MASK_ODD multiplies by -i,
+   with V_MASK_EVEN by +i; like the scalar code, negating -32768 wraps.
+ */
+
+#define KF_Q15_DIV(n) ((kiss_fft_scalar)(SAMP_MAX/(n))) /* DIVSCALAR's multiplier */
+
+static KF_TARGET void KF_NAME(kf_qbfly2)(kiss_fft_cpx * Fout, const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t m)
+{
+    kiss_fft_cpx * Fout2 = Fout + m;
+    size_t k;
+    (void)st;
+    for (k = 0; k < m; k += KF_W) {
+        KF_V a = V_MULS(V_LOAD(Fout + k), KF_Q15_DIV(2));
+        KF_V t = V_CMUL(V_MULS(V_LOAD(Fout2 + k), KF_Q15_DIV(2)), V_TLOAD(stw + k));
+        V_STORE(Fout2 + k, V_SUB(a, t));
+        V_STORE(Fout + k, V_ADD(a, t));
+    }
+}
+
+static KF_TARGET void KF_NAME(kf_qbfly4)(kiss_fft_cpx * Fout, const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t m)
+{
+    const KF_M rot = st->inverse ? V_MASK_EVEN : V_MASK_ODD;
+    size_t k;
+    for (k = 0; k < m; k += KF_W) {
+        KF_V f0 = V_MULS(V_LOAD(Fout + k), KF_Q15_DIV(4));
+        KF_V s0 = V_CMUL(V_MULS(V_LOAD(Fout + k + m), KF_Q15_DIV(4)), V_TLOAD(stw + k));
+        KF_V s1 = V_CMUL(V_MULS(V_LOAD(Fout + k + 2*m), KF_Q15_DIV(4)), V_TLOAD(stw + m + k));
+        KF_V s2 = V_CMUL(V_MULS(V_LOAD(Fout + k + 3*m), KF_Q15_DIV(4)), V_TLOAD(stw + 2*m + k));
+        KF_V s5 = V_SUB(f0, s1);
+        KF_V s3, s4, r;
+        f0 = V_ADD(f0, s1);
+        s3 = V_ADD(s0, s2);
+        s4 = V_SUB(s0, s2);
+        r = V_FLIP(V_SWAP(s4), rot);
+        V_STORE(Fout + k + 2*m, V_SUB(f0, s3));
+        V_STORE(Fout + k, V_ADD(f0, s3));
+        V_STORE(Fout + k + m, V_ADD(s5, r));
+        V_STORE(Fout + k + 3*m, V_SUB(s5, r));
+    }
+}
+
+static KF_TARGET void KF_NAME(kf_qbfly3)(kiss_fft_cpx * Fout, const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t m)
+{
+    const kiss_fft_scalar epi3 = st->twiddles[st->nfft/3].i;
+    const KF_M odd = V_MASK_ODD;
+    size_t k;
+    for (k = 0; k < m; k += KF_W) {
+        KF_V f0 = V_MULS(V_LOAD(Fout + k), KF_Q15_DIV(3));
+        KF_V s1 = V_CMUL(V_MULS(V_LOAD(Fout + k + m), KF_Q15_DIV(3)), V_TLOAD(stw + k));
+        KF_V s2 = V_CMUL(V_MULS(V_LOAD(Fout + k + 2*m), KF_Q15_DIV(3)), V_TLOAD(stw + m + k));
+        KF_V s3 = V_ADD(s1, s2);
+        KF_V s0 = V_MULS(V_SUB(s1, s2), epi3);
+        KF_V fm = V_SUB(f0, V_HALF(s3));
+        KF_V t = V_FLIP(V_SWAP(s0), odd);
+        V_STORE(Fout + k, V_ADD(f0, s3));
+        V_STORE(Fout + k + 2*m, V_ADD(fm, t));
+        V_STORE(Fout + k + m, V_SUB(fm, t));
+    }
+}
+
+static KF_TARGET void KF_NAME(kf_qbfly5)(kiss_fft_cpx * Fout, const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t m)
+{
+    const kiss_fft_cpx ya = st->twiddles[st->nfft/5];
+    const kiss_fft_cpx yb = st->twiddles[2*(st->nfft/5)];
+    const KF_M odd = V_MASK_ODD;
+    size_t k;
+    for (k = 0; k < m; k += KF_W) {
+        KF_V s0 = V_MULS(V_LOAD(Fout + k), KF_Q15_DIV(5));
+        KF_V s1 = V_CMUL(V_MULS(V_LOAD(Fout + k + m), KF_Q15_DIV(5)), V_TLOAD(stw + k));
+        KF_V s2 = V_CMUL(V_MULS(V_LOAD(Fout + k + 2*m), KF_Q15_DIV(5)), V_TLOAD(stw + m + k));
+        KF_V s3 = V_CMUL(V_MULS(V_LOAD(Fout + k + 3*m), KF_Q15_DIV(5)), V_TLOAD(stw + 2*m + k));
+        KF_V s4 = V_CMUL(V_MULS(V_LOAD(Fout + k + 4*m), KF_Q15_DIV(5)), V_TLOAD(stw + 3*m + k));
+        KF_V s7 = V_ADD(s1, s4), s10 = V_SUB(s1, s4);
+        KF_V s8 = V_ADD(s2, s3), s9 = V_SUB(s2, s3);
+        /* s5 = s0 + s7*ya.r + s8*yb.r,  s6 = -i*(s10*ya.i + s9*yb.i) */
+        KF_V s5 = V_ADD(V_ADD(s0, V_MULS(s7, ya.r)), V_MULS(s8, yb.r));
+        KF_V s6 = V_FLIP(V_SWAP(V_ADD(V_MULS(s10, ya.i), V_MULS(s9, yb.i))), odd);
+        /* s11 = s0 + s7*yb.r + s8*ya.r, s12 = -i*(s9*ya.i - s10*yb.i) */
+        KF_V s11 = V_ADD(V_ADD(s0, V_MULS(s7, yb.r)), V_MULS(s8, ya.r));
+        KF_V s12 = V_FLIP(V_SWAP(V_SUB(V_MULS(s9, ya.i), V_MULS(s10, yb.i))), odd);
+        V_STORE(Fout + k, V_ADD(s0, V_ADD(s7, s8)));
+        V_STORE(Fout + k + m, V_SUB(s5, s6));
+        V_STORE(Fout + k + 4*m, V_ADD(s5, s6));
+        V_STORE(Fout + k + 2*m, V_ADD(s11, s12));
+        V_STORE(Fout + k + 3*m, V_SUB(s11, s12));
+    }
+}
+
+/* Stockham stages (kf_sbflyN in kiss_fft.c), along q with the twiddles broadcast once per j */
+
+static KF_TARGET void KF_NAME(kf_qstock2)(const kiss_fft_cpx * x, kiss_fft_cpx * y, const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t s, size_t m)
+{
+    const size_t d = s*m;
+    size_t j, q;
+    (void)st;
+    for (j = 0; j < m; ++j) {
+        const KF_T w1 = V_TBCAST(stw + j);
+        const kiss_fft_cpx * a = x + 2*s*j;
+        kiss_fft_cpx * b = y + s*j;
+        for (q = 0; q < s; q += KF_W) {
+            KF_V a0 = V_MULS(V_LOAD(a + q), KF_Q15_DIV(2));
+            KF_V t = V_CMUL(V_MULS(V_LOAD(a + q + s), KF_Q15_DIV(2)), w1);
+            V_STORE(b + q, V_ADD(a0, t));
+            V_STORE(b + q + d, V_SUB(a0, t));
+        }
+    }
+}
+
+static KF_TARGET void KF_NAME(kf_qstock4)(const kiss_fft_cpx * x, kiss_fft_cpx * y, const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t s, size_t m)
+{
+    const KF_M rot = st->inverse ? V_MASK_EVEN : V_MASK_ODD;
+    const size_t d = s*m;
+    size_t j, q;
+    for (j = 0; j < m; ++j) {
+        const KF_T w1 = V_TBCAST(stw + j), w2 = V_TBCAST(stw + m + j), w3 = V_TBCAST(stw + 2*m + j);
+        const kiss_fft_cpx * a = x + 4*s*j;
+        kiss_fft_cpx * b = y + s*j;
+        for (q = 0; q < s; q += KF_W) {
+            KF_V f0 = V_MULS(V_LOAD(a + q), KF_Q15_DIV(4));
+            KF_V s0 = V_CMUL(V_MULS(V_LOAD(a + q + s), KF_Q15_DIV(4)), w1);
+            KF_V s1 = V_CMUL(V_MULS(V_LOAD(a + q + 2*s), KF_Q15_DIV(4)), w2);
+            KF_V s2 = V_CMUL(V_MULS(V_LOAD(a + q + 3*s), KF_Q15_DIV(4)), w3);
+            KF_V s5 = V_SUB(f0, s1);
+            KF_V s3, s4, r;
+            f0 = V_ADD(f0, s1);
+            s3 = V_ADD(s0, s2);
+            s4 = V_SUB(s0, s2);
+            r = V_FLIP(V_SWAP(s4), rot);
+            V_STORE(b + q + 2*d, V_SUB(f0, s3));
+            V_STORE(b + q, V_ADD(f0, s3));
+            V_STORE(b + q + d, V_ADD(s5, r));
+            V_STORE(b + q + 3*d, V_SUB(s5, r));
+        }
+    }
+}
+
+static KF_TARGET void KF_NAME(kf_qstock3)(const kiss_fft_cpx * x, kiss_fft_cpx * y, const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t s, size_t m)
+{
+    const kiss_fft_scalar epi3 = st->twiddles[st->nfft/3].i;
+    const KF_M odd = V_MASK_ODD;
+    const size_t d = s*m;
+    size_t j, q;
+    for (j = 0; j < m; ++j) {
+        const KF_T w1 = V_TBCAST(stw + j), w2 = V_TBCAST(stw + m + j);
+        const kiss_fft_cpx * a = x + 3*s*j;
+        kiss_fft_cpx * b = y + s*j;
+        for (q = 0; q < s; q += KF_W) {
+            KF_V f0 = V_MULS(V_LOAD(a + q), KF_Q15_DIV(3));
+            KF_V s1 = V_CMUL(V_MULS(V_LOAD(a + q + s), KF_Q15_DIV(3)), w1);
+            KF_V s2 = V_CMUL(V_MULS(V_LOAD(a + q + 2*s), KF_Q15_DIV(3)), w2);
+            KF_V s3 = V_ADD(s1, s2);
+            KF_V s0 = V_MULS(V_SUB(s1, s2), epi3);
+            KF_V fm = V_SUB(f0, V_HALF(s3));
+            KF_V t = V_FLIP(V_SWAP(s0), odd);
+            V_STORE(b + q, V_ADD(f0, s3));
+            V_STORE(b + q + 2*d, V_ADD(fm, t));
+            V_STORE(b + q + d, V_SUB(fm, t));
+        }
+    }
+}
+
+static KF_TARGET void KF_NAME(kf_qstock5)(const kiss_fft_cpx * x, kiss_fft_cpx * y, const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t s, size_t m)
+{
+    const kiss_fft_cpx ya = st->twiddles[st->nfft/5];
+    const kiss_fft_cpx yb = st->twiddles[2*(st->nfft/5)];
+    const KF_M odd = V_MASK_ODD;
+    const size_t d = s*m;
+    size_t j, q;
+    for (j = 0; j < m; ++j) {
+        const KF_T w1 = V_TBCAST(stw + j), w2 = V_TBCAST(stw + m + j), w3 = V_TBCAST(stw + 2*m + j), w4 = V_TBCAST(stw + 3*m + j);
+        const kiss_fft_cpx * a = x + 5*s*j;
+        kiss_fft_cpx * b = y + s*j;
+        for (q = 0; q < s; q += KF_W) {
+            KF_V s0 = V_MULS(V_LOAD(a + q), KF_Q15_DIV(5));
+            KF_V s1 = V_CMUL(V_MULS(V_LOAD(a + q + s), KF_Q15_DIV(5)), w1);
+            KF_V s2 = V_CMUL(V_MULS(V_LOAD(a + q + 2*s), KF_Q15_DIV(5)), w2);
+            KF_V s3 = V_CMUL(V_MULS(V_LOAD(a + q + 3*s), KF_Q15_DIV(5)), w3);
+            KF_V s4 = V_CMUL(V_MULS(V_LOAD(a + q + 4*s), KF_Q15_DIV(5)), w4);
+            KF_V s7 = V_ADD(s1, s4), s10 = V_SUB(s1, s4);
+            KF_V s8 = V_ADD(s2, s3), s9 = V_SUB(s2, s3);
+            KF_V s5 = V_ADD(V_ADD(s0, V_MULS(s7, ya.r)), V_MULS(s8, yb.r));
+            KF_V s6 = V_FLIP(V_SWAP(V_ADD(V_MULS(s10, ya.i), V_MULS(s9, yb.i))), odd);
+            KF_V s11 = V_ADD(V_ADD(s0, V_MULS(s7, yb.r)), V_MULS(s8, ya.r));
+            KF_V s12 = V_FLIP(V_SWAP(V_SUB(V_MULS(s9, ya.i), V_MULS(s10, yb.i))), odd);
+            V_STORE(b + q, V_ADD(s0, V_ADD(s7, s8)));
+            V_STORE(b + q + d, V_SUB(s5, s6));
+            V_STORE(b + q + 4*d, V_ADD(s5, s6));
+            V_STORE(b + q + 2*d, V_ADD(s11, s12));
+            V_STORE(b + q + 3*d, V_SUB(s11, s12));
+        }
+    }
+}
+
+#undef KF_Q15_DIV
@@ -7,93 +7,374 @@
  */
 
 #include "kfc.h"
+#include <stdatomic.h>
+#include <stdint.h>
 
-typedef struct cached_fft *kfc_cfg;
+/*
+ * The cache is a fixed table of slots, each owning at most one plan. A slot's
+ * whole life is its 64-bit state word:
+ *
+ *   0                          empty
+ *   key<<32 | KFC_BUILD        claimed, the plan is being built
+ *   key<<32 | refs             cached, refs callers holding it
+ *   key<<32 | KFC_EVICT        being freed (only ever entered with refs == 0)
+ *
+ * key = nfft<<2 | real<<1 | inverse. kfc_get takes a reference by CAS-ing
+ * refs up, which fails if the slot was evicted or rebuilt in the meantime,
+ * and eviction CASes refs==0 to KFC_EVICT, which fails while anyone holds
+ * the plan; so a plan is never freed under a caller and lookups take no lock.
+ * Slots can empty out in the middle of a probe sequence, so lookups scan the
+ * whole (small) table, starting where the key hashes to.
+ */
+#define KFC_SLOTS 32
+#define KFC_BUILD ((uint64_t)1<<31)
+#define KFC_EVICT ((uint64_t)1<<30)
+#define KFC_REFS  (KFC_EVICT-1)
+#define KFC_KEY(s) ((uint32_t)((s)>>32))
+
+/* plans are placed after this header, which stays a multiple of 16 bytes for USE_SIMD */
+#define KFC_HDR 16
 
-struct cached_fft
+struct kfc_slot
 {
-    int nfft;
-    int inverse;
-    kiss_fft_cfg cfg;
-    kfc_cfg next;
+    _Atomic uint64_t state;
+    _Atomic unsigned long last; /* kfc_tick when last handed out, for LRU eviction */
+    void * cfg;                 /* written before the state is published, freed only under KFC_EVICT */
+    size_t bytes;
+    char pad[64 - sizeof(uint64_t) - sizeof(unsigned long) - sizeof(void*) - sizeof(size_t)];
 };
 
-static kfc_cfg cache_root=NULL;
-static int ncached=0;
+static struct kfc_slot kfc_slots[KFC_SLOTS];
+static _Atomic size_t kfc_bytes;
+static _Atomic size_t kfc_budget = KFC_BUDGET;
+static _Atomic unsigned long kfc_tick;
+
+#define KFC_HOME(key) ((int)(((key) * 2654435761u) >> 27) & (KFC_SLOTS-1))
+
+/* The self test steps in at these points to replay interleavings with another thread */
+#ifdef KFC_TEST
+#define KFC_RACE_MISS 0     /* lookup found nothing, about to claim */
+#define KFC_RACE_BACKOFF 1  /* gave a claim back to another thread's */
+static void kfc_race(uint32_t key,int event);
+#else
+#define kfc_race(key,event) ((void)0)
+#endif
+
+static size_t kfc_plan_size(int nfft,int inverse,int real)
+{
+    size_t len = 0;
+    if (real)
+        kiss_fftr_alloc_engine(nfft,inverse,KISS_FFT_ENGINE_AUTO,NULL,&len);
+    else
+        kiss_fft_alloc_engine(nfft,inverse,KISS_FFT_ENGINE_AUTO,NULL,&len);
+    return len;
+}
+
+/* mem is KFC_HDR + len bytes; the plan goes after the header, which records the slot (-1: not cached) */
+static void * kfc_plan_build(char * mem,size_t len,int nfft,int inverse,int real,int slot)
+{
+    *(int*)mem = slot;
+    if (real)
+        return kiss_fftr_alloc_engine(nfft,inverse,KISS_FFT_ENGINE_AUTO,mem + KFC_HDR,&len);
+    return kiss_fft_alloc_engine(nfft,inverse,KISS_FFT_ENGINE_AUTO,mem + KFC_HDR,&len);
+}
+
+/* Frees the least recently used plan nobody holds, other than slot skip. Returns 0 if there is none. */
+static int kfc_evict_one(int skip)
+{
+    for (;;) {
+        int i, victim = -1;
+        uint64_t vs = 0;
+        unsigned long oldest = 0;
+        for (i=0;i<KFC_SLOTS;++i) {
+            uint64_t s = atomic_load(&kfc_slots[i].state);
+            unsigned long last = atomic_load_explicit(&kfc_slots[i].last,memory_order_relaxed);
+            if (i == skip || s == 0 || (s & (KFC_BUILD|KFC_EVICT|KFC_REFS)))
+                continue;
+            if (victim < 0 || (long)(last - oldest) < 0) {
+                victim = i;
+                vs = s;
+                oldest = last;
+            }
+        }
+        if (victim < 0)
+            return 0;
+        if (atomic_compare_exchange_strong(&kfc_slots[victim].state,&vs,vs|KFC_EVICT)) {
+            atomic_fetch_sub(&kfc_bytes,kfc_slots[victim].bytes);
+            KISS_FFT_FREE((char*)kfc_slots[victim].cfg - KFC_HDR);
+            kfc_slots[victim].cfg = NULL;
+            atomic_store(&kfc_slots[victim].state,0);
+            return 1;
+        }
+        /* someone took or evicted it first: look again */
+    }
+}
 
-static kiss_fft_cfg find_cached_fft(int nfft,int inverse)
+static void * kfc_get_plan(int nfft,int inverse,int real)
 {
+    const uint32_t key = ((uint32_t)nfft<<2) | (uint32_t)(real<<1) | (uint32_t)(inverse!=0);
+    const int home = KFC_HOME(key);
+    struct kfc_slot * slot;
     size_t len;
-    kfc_cfg  cur=cache_root;
-    kfc_cfg  prev=NULL;
-    while ( cur ) {
-        if ( cur->nfft == nfft && inverse == cur->inverse )
-            break;/*found the right node*/
-        prev = cur;
-        cur = prev->next;
+    char * mem;
+    void * cfg;
+    int i, idx;
+
+    for (;;) {
+        /* lookup */
+        for (i=0;i<KFC_SLOTS;++i) {
+            slot = &kfc_slots[(home+i) & (KFC_SLOTS-1)];
+            uint64_t s = atomic_load(&slot->state);
+            if (KFC_KEY(s) != key || (s & KFC_EVICT))
+                continue;
+            if (s & KFC_BUILD)
+                break;  /* another thread is building it: wait for it */
+            if ((s & KFC_REFS) != KFC_REFS && atomic_compare_exchange_weak(&slot->state,&s,s+1)) {
+                atomic_store_explicit(&slot->last,atomic_fetch_add_explicit(&kfc_tick,1,memory_order_relaxed),
+                        memory_order_relaxed);
+                return slot->cfg;
+            }
+            break;      /* it changed under us: start over */
+        }
+        if (i < KFC_SLOTS)
+            continue;
+        kfc_race(key,KFC_RACE_MISS);
+
+        /* not cached: claim an empty slot, making room if the table is full */
+        idx = -1;
+        for (i=0;i<KFC_SLOTS && idx<0;++i) {
+            uint64_t s = 0;
+            int j = (home+i) & (KFC_SLOTS-1);
+            if (atomic_compare_exchange_strong(&kfc_slots[j].state,&s,((uint64_t)key<<32)|KFC_BUILD))
+                idx = j;
+        }
+        if (idx < 0) {
+            if (kfc_evict_one(-1))
+                continue;
+            /* every slot is held: hand out a plan of its own, freed by kfc_put */
+            len = kfc_plan_size(nfft,inverse,real);
+            mem = (char*)KISS_FFT_MALLOC(KFC_HDR + len);
+            if (mem == NULL)
+                return NULL;
+            if ((cfg = kfc_plan_build(mem,len,nfft,inverse,real,-1)) == NULL)
+                KISS_FFT_FREE(mem);
+            return cfg;
+        }
+
+        /* Two threads can claim the same key at once. Whichever claimed second sees the other's
+           claim here, in whatever slot it is, and backs off; it cannot tell whether the other
+           has already looked and gone ahead. If both see each other, both retry. */
+        for (i=0;i<KFC_SLOTS;++i) {
+            uint64_t s = atomic_load(&kfc_slots[i].state);
+            if (i != idx && KFC_KEY(s) == key && !(s & KFC_EVICT))
+                break;
+        }
+        if (i < KFC_SLOTS) {
+            atomic_store(&kfc_slots[idx].state,0);
+            kfc_race(key,KFC_RACE_BACKOFF);
+            continue;
+        }
+        break;
     }
-    if (cur== NULL) {
-        /* no cached node found, need to create a new one*/
-        kiss_fft_alloc(nfft,inverse,0,&len);
-#ifdef USE_SIMD
-        int padding = (16-sizeof(struct cached_fft)) & 15;
-        // make sure the cfg aligns on a 16 byte boundary
-        len += padding;
-#endif
-        cur = (kfc_cfg)KISS_FFT_MALLOC((sizeof(struct cached_fft) + len ));
-        if (cur == NULL)
-            return NULL;
-        cur->cfg = (kiss_fft_cfg)(cur+1);
-#ifdef USE_SIMD
-        cur->cfg = (kiss_fft_cfg) ((char*)(cur+1)+padding);
-#endif
-        kiss_fft_alloc(nfft,inverse,cur->cfg,&len);
-        cur->nfft=nfft;
-        cur->inverse=inverse;
-        cur->next = NULL;
-        if ( prev )
-            prev->next = cur;
-        else
-            cache_root = cur;
-        ++ncached;
+
+    slot = &kfc_slots[idx];
+    len = kfc_plan_size(nfft,inverse,real);
+    mem = (char*)KISS_FFT_MALLOC(KFC_HDR + len);
+    if (mem == NULL) {
+        atomic_store(&slot->state,0);
+        return NULL;
+    }
+    slot->cfg = kfc_plan_build(mem,len,nfft,inverse,real,idx);
+    if (slot->cfg == NULL) {
+        KISS_FFT_FREE(mem);
+        atomic_store(&slot->state,0);
+        return NULL;
     }
-    return cur->cfg;
+    slot->bytes = KFC_HDR + len;
+    atomic_store_explicit(&slot->last,atomic_fetch_add_explicit(&kfc_tick,1,memory_order_relaxed),memory_order_relaxed);
+
+    /* stay within the budget by dropping idle plans, oldest first */
+    atomic_fetch_add(&kfc_bytes,slot->bytes);
+    while (atomic_load(&kfc_bytes) > atomic_load(&kfc_budget) && kfc_evict_one(idx))
+        ;
+
+    atomic_store(&slot->state,((uint64_t)key<<32) | 1);  /* publish, holding one reference */
+    return slot->cfg;
+}
+
+kiss_fft_cfg kfc_get(int nfft,int inverse)
+{
+    return (kiss_fft_cfg)kfc_get_plan(nfft,inverse,0);
+}
+
+kiss_fftr_cfg kfc_getr(int nfft,int inverse)
+{
+    return (kiss_fftr_cfg)kfc_get_plan(nfft,inverse,1);
+}
+
+void kfc_put(void * cfg)
+{
+    char * mem;
+    int slot;
+    if (cfg == NULL)
+        return;
+    mem = (char*)cfg - KFC_HDR;
+    slot = *(int*)mem;
+    if (slot < 0)
+        KISS_FFT_FREE(mem);
+    else
+        atomic_fetch_sub(&kfc_slots[slot].state,1);
+}
+
+void kfc_set_budget(size_t bytes)
+{
+    atomic_store(&kfc_budget,bytes);
+    while (atomic_load(&kfc_bytes) > bytes && kfc_evict_one(-1))
+        ;
 }
 
 void kfc_cleanup(void)
 {
-    kfc_cfg  cur=cache_root;
-    kfc_cfg  next=NULL;
-    while (cur){
-        next = cur->next;
-        free(cur);
-        cur=next;
-    }
-    ncached=0;
-    cache_root = NULL;
+    while (kfc_evict_one(-1))
+        ;
 }
+
 void kfc_fft(int nfft, const kiss_fft_cpx * fin,kiss_fft_cpx * fout)
 {
-    kiss_fft( find_cached_fft(nfft,0),fin,fout );
+    kiss_fft_cfg cfg = kfc_get(nfft,0);
+    kiss_fft( cfg,fin,fout );
+    kfc_put(cfg);
 }
 
 void kfc_ifft(int nfft, const kiss_fft_cpx * fin,kiss_fft_cpx * fout)
 {
-    kiss_fft( find_cached_fft(nfft,1),fin,fout );
+    kiss_fft_cfg cfg = kfc_get(nfft,1);
+    kiss_fft( cfg,fin,fout );
+    kfc_put(cfg);
 }
 
 #ifdef KFC_TEST
+#include <stdio.h>
+#include <string.h>
+
+static int ncached(void)
+{
+    int i, n = 0;
+    for (i=0;i<KFC_SLOTS;++i)
+        if (atomic_load(&kfc_slots[i].state) != 0)
+            ++n;
+    return n;
+}
+
 static void check(int nc)
 {
-    if (ncached != nc) {
-        fprintf(stderr,"ncached should be %d,but it is %d\n",nc,ncached);
+    if (ncached() != nc) {
+        fprintf(stderr,"ncached should be %d,but it is %d\n",nc,ncached());
         exit(1);
     }
 }
 
+/* Replays thread A claiming a key in a slot above home, and looking, between this thread's lookup
+   and its own claim of home. This thread must back off, whichever slot is lower. */
+static uint32_t race_key;
+static int race_slot = -1, race_backoffs;
+
+static void kfc_race(uint32_t key,int event)
+{
+    if (key != race_key)
+        return;
+    if (event == KFC_RACE_MISS && race_slot < 0) {
+        race_slot = (KFC_HOME(key) + 5) & (KFC_SLOTS-1);
+        atomic_store(&kfc_slots[race_slot].state,((uint64_t)key<<32)|KFC_BUILD);
+    } else if (event == KFC_RACE_BACKOFF) {
+        ++race_backoffs;
+        atomic_store(&kfc_slots[race_slot].state,0);  /* A gives up, so this thread can go on */
+    }
+}
+
+static void test_claim_race(void)
+{
+    kiss_fft_cfg cfg;
+    race_key = (uint32_t)768<<2;
+    cfg = kfc_get(768,0);
+    if (cfg == NULL || race_backoffs != 1) {
+        fprintf(stderr,"a claim in a higher slot was not seen: %d back-offs\n",race_backoffs);
+        exit(1);
+    }
+    check(1);
+    kfc_put(cfg);
+    race_key = 0;
+    kfc_cleanup();
+    check(0);
+}
+
+#ifndef _WIN32
+#include <pthread.h>
+
+#define NTHREADS 8
+static const int sizes[] = { 64, 100, 240, 256, 480, 512, 1000, 1024 };
+static kiss_fft_cpx in[1024], ref[8][1024];
+
+/* every thread runs every size many times: all of them must get correct output and share one plan per size */
+static void * hammer(void * arg)
+{
+    kiss_fft_cpx out[1024];
+    long t = (long)arg;
+    int i;
+    for (i=0;i<4000;++i) {
+        int s = (int)((i + t) % 8);
+        kfc_fft(sizes[s],in,out);
+        if (memcmp(out,ref[s],sizeof(kiss_fft_cpx)*sizes[s]) != 0) {
+            fprintf(stderr,"thread %ld got a wrong %d-point FFT\n",t,sizes[s]);
+            exit(1);
+        }
+    }
+    return NULL;
+}
+
+static void test_threads(void)
+{
+    pthread_t th[NTHREADS];
+    long t;
+    int s, i;
+    for (i=0;i<1024;++i) {
+#ifdef USE_SIMD
+        in[i].r = _mm_set1_ps((float)(rand() % 1000));
+        in[i].i = _mm_set1_ps((float)(rand() % 1000));
+#else
+        in[i].r = (kiss_fft_scalar)(rand() % 1000);
+        in[i].i = (kiss_fft_scalar)(rand() % 1000);
+#endif
+    }
+    for (s=0;s<8;++s) {
+        kiss_fft_cfg cfg = kiss_fft_alloc_engine(sizes[s],0,KISS_FFT_ENGINE_AUTO,NULL,NULL);
+        kiss_fft(cfg,in,ref[s]);
+        kiss_fft_free(cfg);
+    }
+    for (t=0;t<NTHREADS;++t)
+        pthread_create(&th[t],NULL,hammer,(void*)t);
+    for (t=0;t<NTHREADS;++t)
+        pthread_join(th[t],NULL);
+    check(8);
+
+    /* again with plans evicted and rebuilt all the time */
+    kfc_set_budget(1);
+    for (t=0;t<NTHREADS;++t)
+        pthread_create(&th[t],NULL,hammer,(void*)t);
+    for (t=0;t<NTHREADS;++t)
+        pthread_join(th[t],NULL);
+    kfc_set_budget(KFC_BUDGET);
+    kfc_cleanup();
+    check(0);
+}
+#endif
+
 int main(void)
 {
     kiss_fft_cpx buf1[1024],buf2[1024];
+    kiss_fft_cfg held, cfg;
+    kiss_fftr_cfg rcfg;
+    int i;
     memset(buf1,0,sizeof(buf1));
     check(0);
     kfc_fft(512,buf1,buf2);
@@ -102,8 +383,48 @@ int main(void)
     check(1);
     kfc_ifft(512,buf1,buf2);
     check(2);
+    rcfg = kfc_getr(512,0);
+    check(3);
+    if (kfc_getr(512,0) != rcfg) {
+        fprintf(stderr,"the same real plan should come back\n");
+        exit(1);
+    }
+    kfc_put(rcfg);
+    kfc_put(rcfg);
     kfc_cleanup();
     check(0);
+
+    /* a budget of about one plan: idle plans go, held ones stay */
+    held = kfc_get(4096,0);
+    kfc_set_budget(1);
+    check(1);
+    for (i=1;i<=4;++i) {
+        cfg = kfc_get(256*i,0);
+        kfc_put(cfg);
+    }
+    check(2);
+    kfc_put(held);
+    kfc_set_budget(KFC_BUDGET);
+    check(2);
+    kfc_cleanup();
+    check(0);
+
+    /* more plans held than there are slots: the extra ones are not cached */
+    {
+        kiss_fft_cfg many[KFC_SLOTS+2];
+        for (i=0;i<KFC_SLOTS+2;++i)
+            many[i] = kfc_get(16+i,0);
+        check(KFC_SLOTS);
+        for (i=0;i<KFC_SLOTS+2;++i)
+            kfc_put(many[i]);
+        kfc_cleanup();
+        check(0);
+    }
+
+    test_claim_race();
+#ifndef _WIN32
+    test_threads();
+#endif
     return 0;
 }
 #endif
@@ -9,6 +9,7 @@
 #ifndef KFC_H
 #define KFC_H
 #include "kiss_fft.h"
+#include "kiss_fftr.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -25,26 +26,45 @@ The first time kfc_fft or kfc_ifft for a given FFT size, the cfg
 object is created for it.  All subsequent calls use the cached 
 configuration object.
 
-NOTE:
-You should probably not use this if your program will be using a lot 
-of various sizes of FFTs.  There is a linear search through the
-cached objects.  If you are only using one or two FFT sizes, this
-will be negligible. Otherwise, you may want to use another method 
-of managing the cfg objects.
- 
- There is no automated cleanup of the cached objects.  This could lead 
-to large memory usage in a program that uses a lot of *DIFFERENT* 
-sized FFTs.  If you want to force all cached cfg objects to be freed,
-call kfc_cleanup.
- 
+The cache is safe to use from any number of threads. Plans are keyed by
+(nfft, direction, complex or real); the datatype is the one this library was
+built for. Lookups take no lock: a thread that finds its plan takes a
+reference with one atomic compare-and-swap, and threads asking for the same
+missing plan wait for a single copy to be built rather than building their own.
+Complex plans use KISS_FFT_ENGINE_AUTO.
+
+kfc_get and kfc_getr hand out a cached plan, shared read-only with every other
+caller of the same key, which stays valid until the matching kfc_put. Hold it
+for as long as you keep using it (e.g. for the life of a stream) and the hot
+path never touches the cache at all.
+
+Plans nobody holds are evicted, least recently used first, to keep the cache
+under its memory budget (KFC_BUDGET bytes unless set with kfc_set_budget) and
+within its 32 slots. Held plans are never evicted, so the cache only goes over
+budget while its callers hold more than that; a kfc_get when all slots are held
+returns a plan of its own, which kfc_put frees.
  */
 
+#ifndef KFC_BUDGET
+#define KFC_BUDGET (16*1024*1024)
+#endif
+
+/* a shared plan for nfft points, or NULL on failure; give it back with kfc_put */
+kiss_fft_cfg KISS_FFT_API kfc_get(int nfft,int inverse);
+/* the same for kiss_fftr (nfft even); the returned cfg goes back through kfc_put as well */
+kiss_fftr_cfg KISS_FFT_API kfc_getr(int nfft,int inverse);
+/* releases a plan from kfc_get or kfc_getr */
+void KISS_FFT_API kfc_put(void * cfg);
+
+/* caps the bytes held by idle cached plans, evicting what is over */
+void KISS_FFT_API kfc_set_budget(size_t bytes);
+
 /*forward complex FFT */
 void KISS_FFT_API kfc_fft(int nfft, const kiss_fft_cpx * fin,kiss_fft_cpx * fout);
 /*reverse complex FFT */
 void KISS_FFT_API kfc_ifft(int nfft, const kiss_fft_cpx * fin,kiss_fft_cpx * fout);
 
-/*free all cached objects*/
+/*free all cached objects that are not held*/
 void KISS_FFT_API kfc_cleanup(void);
 
 #ifdef __cplusplus
@@ -11,23 +11,39 @@
 /* The guts header contains all the multiplication and addition macros that are defined for
  fixed or floating point complex numbers.  It also delares the kf_ internal functions.
  */
+#include "_kiss_fft_vec.h"
+/* Vectorised butterflies (AVX2/AVX-512/NEON, SSSE3/AVX2/NEON for int16) chosen at runtime */
+#include "_kiss_fft_codelets.h"
+/* Generated straight-line leaf DFTs (tools/kf_codelets.py) that end floating point plans */
+#include "_kiss_fft_pool.h"
+/* Where the parallel parts run: the thread pool, OpenMP or nowhere */
+
+#if !defined(FIXED_POINT) && !defined(USE_SIMD) && !defined(KISS_FFT_NO_BLUESTEIN)
+#define KF_BLUESTEIN 1
+/* The smallest prime factor that makes a plan run as a Bluestein convolution (kf_bluestein)
+   instead of through kf_bfly_generic, whose cost grows with the size of the factor. Factors of
+   this size and up take Bluestein. The two break even around 19 with the vector butterflies and
+   around 29 without. */
+#ifndef KISS_FFT_BLUESTEIN_MIN
+#define KISS_FFT_BLUESTEIN_MIN 29
+#endif
+#endif
 
 static void kf_bfly2(
         kiss_fft_cpx * Fout,
-        const size_t fstride,
-        const kiss_fft_cfg st,
+        const kiss_fft_cpx * stw,
         int m
         )
 {
     kiss_fft_cpx * Fout2;
-    kiss_fft_cpx * tw1 = st->twiddles;
+    const kiss_fft_cpx * tw1 = stw;
     kiss_fft_cpx t;
     Fout2 = Fout + m;
     do{
         C_FIXDIV(*Fout,2); C_FIXDIV(*Fout2,2);
 
         C_MUL (t,  *Fout2 , *tw1);
-        tw1 += fstride;
+        ++tw1;
         C_SUB( *Fout2 ,  *Fout , t );
         C_ADDTO( *Fout ,  t );
         ++Fout2;
@@ -37,19 +53,21 @@ static void kf_bfly2(
 
 static void kf_bfly4(
         kiss_fft_cpx * Fout,
-        const size_t fstride,
         const kiss_fft_cfg st,
+        const kiss_fft_cpx * stw,
         const size_t m
         )
 {
-    kiss_fft_cpx *tw1,*tw2,*tw3;
+    const kiss_fft_cpx *tw1,*tw2,*tw3;
     kiss_fft_cpx scratch[6];
     size_t k=m;
     const size_t m2=2*m;
     const size_t m3=3*m;
 
 
-    tw3 = tw2 = tw1 = st->twiddles;
+    tw1 = stw;
+    tw2 = stw + m;
+    tw3 = stw + m2;
 
     do {
         C_FIXDIV(*Fout,4); C_FIXDIV(Fout[m],4); C_FIXDIV(Fout[m2],4); C_FIXDIV(Fout[m3],4);
@@ -63,9 +81,9 @@ static void kf_bfly4(
         C_ADD( scratch[3] , scratch[0] , scratch[2] );
         C_SUB( scratch[4] , scratch[0] , scratch[2] );
         C_SUB( Fout[m2], *Fout, scratch[3] );
-        tw1 += fstride;
-        tw2 += fstride*2;
-        tw3 += fstride*3;
+        ++tw1;
+        ++tw2;
+        ++tw3;
         C_ADDTO( *Fout , scratch[3] );
 
         if(st->inverse) {
@@ -87,17 +105,19 @@ static void kf_bfly3(
          kiss_fft_cpx * Fout,
          const size_t fstride,
          const kiss_fft_cfg st,
+         const kiss_fft_cpx * stw,
          size_t m
          )
 {
      size_t k=m;
      const size_t m2 = 2*m;
-     kiss_fft_cpx *tw1,*tw2;
+     const kiss_fft_cpx *tw1,*tw2;
      kiss_fft_cpx scratch[5];
      kiss_fft_cpx epi3;
      epi3 = st->twiddles[fstride*m];
 
-     tw1=tw2=st->twiddles;
+     tw1=stw;
+     tw2=stw+m;
 
      do{
          C_FIXDIV(*Fout,3); C_FIXDIV(Fout[m],3); C_FIXDIV(Fout[m2],3);
@@ -107,8 +127,8 @@ static void kf_bfly3(
 
          C_ADD(scratch[3],scratch[1],scratch[2]);
          C_SUB(scratch[0],scratch[1],scratch[2]);
-         tw1 += fstride;
-         tw2 += fstride*2;
+         ++tw1;
+         ++tw2;
 
          Fout[m].r = Fout->r - HALF_OF(scratch[3].r);
          Fout[m].i = Fout->i - HALF_OF(scratch[3].i);
@@ -131,6 +151,7 @@ static void kf_bfly5(
         kiss_fft_cpx * Fout,
         const size_t fstride,
         const kiss_fft_cfg st,
+        const kiss_fft_cpx * stw,
         int m
         )
 {
@@ -138,7 +159,6 @@ static void kf_bfly5(
     int u;
     kiss_fft_cpx scratch[13];
     kiss_fft_cpx * twiddles = st->twiddles;
-    kiss_fft_cpx *tw;
     kiss_fft_cpx ya,yb;
     ya = twiddles[fstride*m];
     yb = twiddles[fstride*2*m];
@@ -149,15 +169,14 @@ static void kf_bfly5(
     Fout3=Fout0+3*m;
     Fout4=Fout0+4*m;
 
-    tw=st->twiddles;
     for ( u=0; u<m; ++u ) {
         C_FIXDIV( *Fout0,5); C_FIXDIV( *Fout1,5); C_FIXDIV( *Fout2,5); C_FIXDIV( *Fout3,5); C_FIXDIV( *Fout4,5);
         scratch[0] = *Fout0;
 
-        C_MUL(scratch[1] ,*Fout1, tw[u*fstride]);
-        C_MUL(scratch[2] ,*Fout2, tw[2*u*fstride]);
-        C_MUL(scratch[3] ,*Fout3, tw[3*u*fstride]);
-        C_MUL(scratch[4] ,*Fout4, tw[4*u*fstride]);
+        C_MUL(scratch[1] ,*Fout1, stw[u]);
+        C_MUL(scratch[2] ,*Fout2, stw[m+u]);
+        C_MUL(scratch[3] ,*Fout3, stw[2*m+u]);
+        C_MUL(scratch[4] ,*Fout4, stw[3*m+u]);
 
         C_ADD( scratch[7],scratch[1],scratch[4]);
         C_SUB( scratch[10],scratch[1],scratch[4]);
@@ -202,7 +221,7 @@ static void kf_bfly_generic(
     kiss_fft_cpx t;
     int Norig = st->nfft;
 
-    kiss_fft_cpx * scratch = (kiss_fft_cpx*)KISS_FFT_TMP_ALLOC(sizeof(kiss_fft_cpx)*p);
+    kiss_fft_cpx * scratch = KF_SCRATCH(&st->genbusy,st->genscratch,p);
     if (scratch == NULL){
         KISS_FFT_ERROR("Memory allocation failed.");
         return;
@@ -229,7 +248,26 @@ static void kf_bfly_generic(
             k += m;
         }
     }
-    KISS_FFT_TMP_FREE(scratch);
+    KF_SCRATCH_PUT(&st->genbusy,st->genscratch,scratch);
+}
+
+static void kf_work(kiss_fft_cpx * Fout,const kiss_fft_cpx * f,const size_t fstride,int in_stride,
+        int * factors,const kiss_fft_cfg st);
+
+/* kf_work's top stage: the p sub-transforms as tasks for kf_parallel_for */
+struct kf_work_task
+{
+    kiss_fft_cpx * Fout;
+    const kiss_fft_cpx * f;
+    int in_stride, p, m;
+    int * factors;
+    kiss_fft_cfg st;
+};
+
+static void kf_work_sub(void * arg,int k)
+{
+    const struct kf_work_task * t = (const struct kf_work_task*)arg;
+    kf_work(t->Fout + k*t->m,t->f + (size_t)t->in_stride*k,t->p,t->in_stride,t->factors,t->st);
 }
 
 static
@@ -243,32 +281,43 @@ void kf_work(
         )
 {
     kiss_fft_cpx * Fout_beg=Fout;
+    const kiss_fft_cpx * stw = st->stagetw[(factors - st->factors)/2]; /* this stage's twiddles */
     const int p=*factors++; /* the radix  */
     const int m=*factors++; /* stage's fft length/p */
     const kiss_fft_cpx * Fout_end = Fout + p*m;
 
-#ifdef _OPENMP
-    // use openmp extensions at the
-    // top-level (not recursive)
-    if (fstride==1 && p<=5 && m!=1)
+    // plans past the crossover (kf_plan_threads) run the p sub-transforms of
+    // the top level (not recursive) on different threads, see _kiss_fft_pool.h
+    if (fstride==1 && p<=5 && m!=1 && st->threads > 1)
     {
-        int k;
-
-        // execute the p different work units in different threads
-#       pragma omp parallel for
-        for (k=0;k<p;++k)
-            kf_work( Fout +k*m, f+ fstride*in_stride*k,fstride*p,in_stride,factors,st);
+        struct kf_work_task t;
+        t.Fout = Fout;
+        t.f = f;
+        t.in_stride = in_stride;
+        t.p = p;
+        t.m = m;
+        t.factors = factors;
+        t.st = st;
+        kf_parallel_for(p,kf_work_sub,&t);
         // all threads have joined by this point
 
+        if (kf_vec_bfly(Fout,st,stw,m,p))
+            return;
         switch (p) {
-            case 2: kf_bfly2(Fout,fstride,st,m); break;
-            case 3: kf_bfly3(Fout,fstride,st,m); break;
-            case 4: kf_bfly4(Fout,fstride,st,m); break;
-            case 5: kf_bfly5(Fout,fstride,st,m); break;
+            case 2: kf_bfly2(Fout,stw,m); break;
+            case 3: kf_bfly3(Fout,fstride,st,stw,m); break;
+            case 4: kf_bfly4(Fout,st,stw,m); break;
+            case 5: kf_bfly5(Fout,fstride,st,stw,m); break;
             default: kf_bfly_generic(Fout,fstride,st,m,p); break;
         }
         return;
     }
+
+#ifdef KF_CODELETS
+    if (m==1 && p==st->leaf) {
+        kf_leaf(Fout,f,fstride*in_stride,p,st->inverse);
+        return;
+    }
 #endif
 
     if (m==1) {
@@ -290,15 +339,271 @@ void kf_work(
     Fout=Fout_beg;
 
     // recombine the p smaller DFTs
+    if (kf_vec_bfly(Fout,st,stw,m,p))
+        return;
     switch (p) {
-        case 2: kf_bfly2(Fout,fstride,st,m); break;
-        case 3: kf_bfly3(Fout,fstride,st,m); break;
-        case 4: kf_bfly4(Fout,fstride,st,m); break;
-        case 5: kf_bfly5(Fout,fstride,st,m); break;
+        case 2: kf_bfly2(Fout,stw,m); break;
+        case 3: kf_bfly3(Fout,fstride,st,stw,m); break;
+        case 4: kf_bfly4(Fout,st,stw,m); break;
+        case 5: kf_bfly5(Fout,fstride,st,stw,m); break;
         default: kf_bfly_generic(Fout,fstride,st,m,p); break;
     }
 }
 
+/*
+ * Stockham autosort engine (KISS_FFT_ENGINE_STOCKHAM).
+ *
+ * The same stages as kf_work, run breadth first and in reverse (innermost
+ * first): each stage reads the whole sequence from x and writes it to y, then
+ * the two buffers swap. With s the product of the radices of the stages
+ * outside this one and m=n/(s*p), a radix-p stage takes
+ *   y[q + s*(j + t*m)] = DFT_p( w^(j*r*s) * x[q + s*(p*j + r)], r=0..p-1 )[t]
+ * for j<m, q<s. Every read and write runs along q with unit stride and the
+ * output comes out in natural order without a separate permutation. The
+ * twiddles go on the inputs, as in kf_bflyN, which keeps fixed point in range.
+ * xs is the input stride, in_stride for the first stage and 1 afterwards;
+ * stw is the stage's packed table, stw[(r-1)*m + j] = w^(j*r*s).
+ */
+static void kf_sbfly2(const kiss_fft_cpx * x, size_t xs, kiss_fft_cpx * y,
+        const kiss_fft_cpx * stw, size_t s, size_t m)
+{
+    const size_t d = s*m, e = s*xs;
+    size_t j,q;
+    for (j=0;j<m;++j) {
+        const kiss_fft_cpx w1 = stw[j];
+        for (q=0;q<s;++q) {
+            const kiss_fft_cpx * a = x + (q + 2*s*j)*xs;
+            kiss_fft_cpx * b = y + q + s*j;
+            kiss_fft_cpx a0 = a[0], a1 = a[e], t;
+            C_FIXDIV(a0,2); C_FIXDIV(a1,2);
+            C_MUL(t, a1, w1);
+            C_ADD(b[0], a0, t);
+            C_SUB(b[d], a0, t);
+        }
+    }
+}
+
+static void kf_sbfly3(const kiss_fft_cpx * x, size_t xs, kiss_fft_cpx * y,
+        const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t s, size_t m)
+{
+    const kiss_fft_cpx epi3 = st->twiddles[st->nfft/3];
+    const size_t d = s*m, e = s*xs;
+    size_t j,q;
+    for (j=0;j<m;++j) {
+        const kiss_fft_cpx w1 = stw[j], w2 = stw[m+j];
+        for (q=0;q<s;++q) {
+            const kiss_fft_cpx * a = x + (q + 3*s*j)*xs;
+            kiss_fft_cpx * b = y + q + s*j;
+            kiss_fft_cpx a0 = a[0], a1 = a[e], a2 = a[2*e];
+            kiss_fft_cpx scratch[4];
+            C_FIXDIV(a0,3); C_FIXDIV(a1,3); C_FIXDIV(a2,3);
+
+            C_MUL(scratch[1],a1,w1);
+            C_MUL(scratch[2],a2,w2);
+            C_ADD(scratch[3],scratch[1],scratch[2]);
+            C_SUB(scratch[0],scratch[1],scratch[2]);
+
+            scratch[1].r = a0.r - HALF_OF(scratch[3].r);
+            scratch[1].i = a0.i - HALF_OF(scratch[3].i);
+            C_MULBYSCALAR( scratch[0] , epi3.i );
+            C_ADD(b[0],a0,scratch[3]);
+
+            b[2*d].r = scratch[1].r + scratch[0].i;
+            b[2*d].i = scratch[1].i - scratch[0].r;
+            b[d].r = scratch[1].r - scratch[0].i;
+            b[d].i = scratch[1].i + scratch[0].r;
+        }
+    }
+}
+
+static void kf_sbfly4(const kiss_fft_cpx * x, size_t xs, kiss_fft_cpx * y,
+        const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t s, size_t m)
+{
+    const size_t d = s*m, e = s*xs;
+    size_t j,q;
+    for (j=0;j<m;++j) {
+        const kiss_fft_cpx w1 = stw[j], w2 = stw[m+j], w3 = stw[2*m+j];
+        for (q=0;q<s;++q) {
+            const kiss_fft_cpx * a = x + (q + 4*s*j)*xs;
+            kiss_fft_cpx * b = y + q + s*j;
+            kiss_fft_cpx a0 = a[0], a1 = a[e], a2 = a[2*e], a3 = a[3*e];
+            kiss_fft_cpx scratch[6];
+            C_FIXDIV(a0,4); C_FIXDIV(a1,4); C_FIXDIV(a2,4); C_FIXDIV(a3,4);
+
+            C_MUL(scratch[0],a1,w1);
+            C_MUL(scratch[1],a2,w2);
+            C_MUL(scratch[2],a3,w3);
+
+            C_SUB( scratch[5] , a0, scratch[1] );
+            C_ADDTO( a0, scratch[1] );
+            C_ADD( scratch[3] , scratch[0] , scratch[2] );
+            C_SUB( scratch[4] , scratch[0] , scratch[2] );
+            C_SUB( b[2*d], a0, scratch[3] );
+            C_ADD( b[0], a0, scratch[3] );
+
+            if (st->inverse) {
+                b[d].r = scratch[5].r - scratch[4].i;
+                b[d].i = scratch[5].i + scratch[4].r;
+                b[3*d].r = scratch[5].r + scratch[4].i;
+                b[3*d].i = scratch[5].i - scratch[4].r;
+            }else{
+                b[d].r = scratch[5].r + scratch[4].i;
+                b[d].i = scratch[5].i - scratch[4].r;
+                b[3*d].r = scratch[5].r - scratch[4].i;
+                b[3*d].i = scratch[5].i + scratch[4].r;
+            }
+        }
+    }
+}
+
+static void kf_sbfly5(const kiss_fft_cpx * x, size_t xs, kiss_fft_cpx * y,
+        const kiss_fft_cfg st, const kiss_fft_cpx * stw, size_t s, size_t m)
+{
+    const kiss_fft_cpx ya = st->twiddles[st->nfft/5], yb = st->twiddles[2*(st->nfft/5)];
+    const size_t d = s*m, e = s*xs;
+    size_t j,q;
+    for (j=0;j<m;++j) {
+        const kiss_fft_cpx w1 = stw[j], w2 = stw[m+j], w3 = stw[2*m+j], w4 = stw[3*m+j];
+        for (q=0;q<s;++q) {
+            const kiss_fft_cpx * a = x + (q + 5*s*j)*xs;
+            kiss_fft_cpx * b = y + q + s*j;
+            kiss_fft_cpx a1 = a[e], a2 = a[2*e], a3 = a[3*e], a4 = a[4*e];
+            kiss_fft_cpx scratch[13];
+            scratch[0] = a[0];
+            C_FIXDIV(scratch[0],5); C_FIXDIV(a1,5); C_FIXDIV(a2,5); C_FIXDIV(a3,5); C_FIXDIV(a4,5);
+
+            C_MUL(scratch[1],a1,w1);
+            C_MUL(scratch[2],a2,w2);
+            C_MUL(scratch[3],a3,w3);
+            C_MUL(scratch[4],a4,w4);
+
+            C_ADD( scratch[7],scratch[1],scratch[4]);
+            C_SUB( scratch[10],scratch[1],scratch[4]);
+            C_ADD( scratch[8],scratch[2],scratch[3]);
+            C_SUB( scratch[9],scratch[2],scratch[3]);
+
+            b[0].r = scratch[0].r + scratch[7].r + scratch[8].r;
+            b[0].i = scratch[0].i + scratch[7].i + scratch[8].i;
+
+            scratch[5].r = scratch[0].r + S_MUL(scratch[7].r,ya.r) + S_MUL(scratch[8].r,yb.r);
+            scratch[5].i = scratch[0].i + S_MUL(scratch[7].i,ya.r) + S_MUL(scratch[8].i,yb.r);
+
+            scratch[6].r =  S_MUL(scratch[10].i,ya.i) + S_MUL(scratch[9].i,yb.i);
+            scratch[6].i = -S_MUL(scratch[10].r,ya.i) - S_MUL(scratch[9].r,yb.i);
+
+            C_SUB(b[d],scratch[5],scratch[6]);
+            C_ADD(b[4*d],scratch[5],scratch[6]);
+
+            scratch[11].r = scratch[0].r + S_MUL(scratch[7].r,yb.r) + S_MUL(scratch[8].r,ya.r);
+            scratch[11].i = scratch[0].i + S_MUL(scratch[7].i,yb.r) + S_MUL(scratch[8].i,ya.r);
+            scratch[12].r = - S_MUL(scratch[10].i,yb.i) + S_MUL(scratch[9].i,ya.i);
+            scratch[12].i = S_MUL(scratch[10].r,yb.i) - S_MUL(scratch[9].r,ya.i);
+
+            C_ADD(b[2*d],scratch[11],scratch[12]);
+            C_SUB(b[3*d],scratch[11],scratch[12]);
+        }
+    }
+}
+
+static void kf_sbfly_generic(const kiss_fft_cpx * x, size_t xs, kiss_fft_cpx * y,
+        const kiss_fft_cfg st, size_t s, size_t m, int p)
+{
+    const kiss_fft_cpx * tw = st->twiddles;
+    const size_t n = (size_t)st->nfft;
+    const size_t d = s*m, e = s*xs;
+    size_t j,q,r,t,k,twidx;
+    kiss_fft_cpx u;
+
+    kiss_fft_cpx * scratch = KF_SCRATCH(&st->genbusy,st->genscratch,p);
+    if (scratch == NULL){
+        KISS_FFT_ERROR("Memory allocation failed.");
+        return;
+    }
+
+    for (j=0;j<m;++j) {
+        for (q=0;q<s;++q) {
+            const kiss_fft_cpx * a = x + (q + (size_t)p*s*j)*xs;
+            kiss_fft_cpx * b = y + q + s*j;
+            for (r=0;r<(size_t)p;++r) {
+                scratch[r] = a[r*e];
+                C_FIXDIV(scratch[r],p);
+            }
+            /* as kf_bfly_generic: input r of output k=j+t*m takes twiddles[r*k*s] */
+            for (t=0;t<(size_t)p;++t) {
+                k = j + t*m;
+                b[t*d] = scratch[0];
+                twidx = 0;
+                for (r=1;r<(size_t)p;++r) {
+                    twidx += s*k;
+                    if (twidx>=n) twidx-=n;
+                    C_MUL(u,scratch[r],tw[twidx]);
+                    C_ADDTO(b[t*d],u);
+                }
+            }
+        }
+    }
+    KF_SCRATCH_PUT(&st->genbusy,st->genscratch,scratch);
+}
+
+/* stage i of the plan. nb transforms interleaved element by element (see kf_batch_block) are the
+   same stage with s scaled by nb: element k of transform b sits at k*nb + b, i.e. q' = q*nb + b.
+   The radix 2-5 kernels only read twiddles through stw, so they run unchanged; the generic one
+   indexes twiddles by s and must have nb == 1. */
+static void kf_stockham_stage(const kiss_fft_cpx * x, size_t xs, kiss_fft_cpx * y,
+        const kiss_fft_cfg st, int i, size_t nb)
+{
+    const int p = st->factors[2*i];
+    const size_t m = (size_t)st->factors[2*i+1];
+    const size_t s = (size_t)st->nfft / ((size_t)p*m) * nb;
+    const kiss_fft_cpx * stw = st->stagetw[i];
+    if (xs == 1 && kf_vec_stock(x,y,st,stw,p,s,m))
+        return;
+    switch (p) {
+        case 2: kf_sbfly2(x,xs,y,stw,s,m); break;
+        case 3: kf_sbfly3(x,xs,y,st,stw,s,m); break;
+        case 4: kf_sbfly4(x,xs,y,st,stw,s,m); break;
+        case 5: kf_sbfly5(x,xs,y,st,stw,s,m); break;
+        default: kf_sbfly_generic(x,xs,y,st,s,m,p); break;
+    }
+}
+
+static void kf_stockham(const kiss_fft_cfg st, const kiss_fft_cpx * fin, int in_stride,
+        kiss_fft_cpx * fout, kiss_fft_cpx * buf)
+{
+    const int * factors = st->factors;
+    const kiss_fft_cpx * x = fin;
+    size_t xs = (size_t)in_stride;
+    int stages = 0, i;
+    kiss_fft_cpx * y;
+
+    do { ++stages; } while (factors[2*stages-1] > 1);
+
+    /* pick the first destination so that the last stage lands in fout */
+    y = (stages & 1) ? fout : buf;
+    if (fin == fout && y == fout) {
+        if (xs == 1) {
+            /* in place: the first stage has m == 1, so each butterfly reads and writes the same
+               p points. It runs on fout itself and the even number of stages left ping-pong back */
+            kf_stockham_stage(fout,1,fout,st,--stages,1);
+            y = buf;
+        }else{
+            /* strided in place: the first stage must not overwrite input still to be read */
+            size_t k;
+            for (k=0;k<(size_t)st->nfft;++k)
+                buf[k] = fin[k*xs];
+            x = buf;
+            xs = 1;
+        }
+    }
+
+    for (i=stages-1;i>=0;--i) {
+        kf_stockham_stage(x,xs,y,st,i,1);
+        x = y;
+        xs = 1;
+        y = (y == fout) ? buf : fout;
+    }
+}
+
 /*  facbuf is populated by p1,m1,p2,m2, ...
     where
     p[i] * m[i] = m[i-1]
@@ -327,6 +632,169 @@ void kf_factor(int n,int * facbuf)
     } while (n > 1);
 }
 
+/*  Same as kf_factor, but with the plan ending in the largest leaf codelet that divides n,
+    e.g. 1024 becomes 4,256 4,64 64,1 instead of 4,256 4,64 4,16 4,4 4,1  */
+static
+void kf_plan(int n,int * facbuf,int * leaf)
+{
+    *leaf = 0;
+#ifdef KF_CODELETS
+    *leaf = kf_leaf_size(n);
+    if (*leaf) {
+        if (n > *leaf) {
+            kf_factor(n / *leaf,facbuf);
+            while (facbuf[1] != 1) {
+                facbuf[1] *= *leaf;
+                facbuf += 2;
+            }
+            facbuf[1] *= *leaf;
+            facbuf += 2;
+        }
+        facbuf[0] = *leaf;
+        facbuf[1] = 1;
+        return;
+    }
+#endif
+    kf_factor(n,facbuf);
+}
+
+/* Entries in the stage table of radix p over m, padded so the next table stays aligned */
+static size_t kf_stagetw_len(int p,int m)
+{
+    const size_t align = KF_STAGETW_ALIGN / sizeof(kiss_fft_cpx);
+    if (p > 5)
+        return 0;
+    return ((size_t)(p-1)*m + align-1) / align * align;
+}
+
+/* Bytes for the stage tables of a plan, including the slack to align the first one */
+static size_t kf_stagetw_size(const int * factors)
+{
+    size_t len = 0;
+    do {
+        len += kf_stagetw_len(factors[0],factors[1]);
+        factors += 2;
+    } while (factors[-1] > 1);
+    return sizeof(kiss_fft_cpx)*len + KF_STAGETW_ALIGN;
+}
+
+/* The largest radix kf_bfly_generic/kf_sbfly_generic will see, 0 for none */
+static size_t kf_generic_max(const int * factors)
+{
+    size_t p = 0;
+    do {
+        if (factors[0] > 5 && (size_t)factors[0] > p)
+            p = (size_t)factors[0];
+        factors += 2;
+    } while (factors[-1] > 1);
+    return p;
+}
+
+/*
+ * Points of the block kiss_fft_batch interleaves KISS_FFT_BATCH transforms through (two buffers of
+ * nb*nfft), 0 for plans that go one transform at a time. Interleaving is only worth it with the
+ * vector butterflies, and needs a plan of radix 2-5 stages only: no generic radix, leaf codelet
+ * or Bluestein (which never gets here).
+ */
+static size_t kf_batch_len(int nfft,const int * factors,int vec,int leaf)
+{
+    const size_t len = (size_t)2*KISS_FFT_BATCH*nfft;
+    if (vec == KF_VEC_SCALAR || leaf || kf_generic_max(factors) || sizeof(kiss_fft_cpx)*len > KISS_FFT_BATCH_BYTES)
+        return 0;
+    return len;
+}
+
+/* Lays the stage tables out from mem on, copying from the full twiddle table */
+static void kf_stagetw_init(kiss_fft_cfg st,char * mem)
+{
+    const int * factors = st->factors;
+    kiss_fft_cpx * tw = (kiss_fft_cpx*)(mem + ((KF_STAGETW_ALIGN - (size_t)mem % KF_STAGETW_ALIGN) % KF_STAGETW_ALIGN));
+    int i = 0;
+    do {
+        const int p = factors[0], m = factors[1];
+        const size_t fstride = (size_t)st->nfft / ((size_t)p*m);
+        int r,k;
+        st->stagetw[i] = NULL;
+        if (p <= 5) {
+            st->stagetw[i] = tw;
+            for (r=1;r<p;++r)
+                for (k=0;k<m;++k)
+                    tw[(r-1)*m + k] = st->twiddles[r*k*fstride];
+            tw += kf_stagetw_len(p,m);
+        }
+        factors += 2;
+        ++i;
+    } while (factors[-1] > 1);
+}
+
+#ifdef KF_BLUESTEIN
+/*
+ * Bluestein's algorithm: with c[n] = exp(-+i*pi*n^2/nfft), nk = (n^2 + k^2 - (k-n)^2)/2 turns the DFT into
+ *   X[k] = c[k] * sum_n (x[n]*c[n]) * conj(c[k-n])
+ * a convolution, done circularly at M >= 2*nfft-1 points, a power of two, through st->bluestein
+ * (a forward M-point plan; the inverse transform conjugates around it). For a Bluestein plan
+ * st->twiddles holds c and st->chirpfft the transform of conj(c), wrapped and scaled by 1/M.
+ */
+static void kf_bluestein(const kiss_fft_cfg st,const kiss_fft_cpx * fin,kiss_fft_cpx * fout,int in_stride)
+{
+    const int n = st->nfft, M = st->bluestein->nfft;
+    const kiss_fft_cpx * c = st->twiddles;
+    kiss_fft_cpx * a, * b, t;
+    int k;
+
+    a = KF_SCRATCH(&st->scratchbusy,st->scratch,2*M);
+    if (a == NULL){
+        KISS_FFT_ERROR("Memory allocation error.");
+        return;
+    }
+    b = a + M;
+    for (k=0;k<n;++k)
+        C_MUL(a[k],fin[(size_t)k*in_stride],c[k]);
+    memset(a+n,0,sizeof(kiss_fft_cpx)*(M-n));
+
+    kiss_fft_stride(st->bluestein,a,b,1);
+    for (k=0;k<M;++k) {
+        C_MUL(t,b[k],st->chirpfft[k]);
+        b[k].r = t.r;
+        b[k].i = -t.i;
+    }
+    kiss_fft_stride(st->bluestein,b,a,1);
+    for (k=0;k<n;++k) {
+        t.r = a[k].r;
+        t.i = -a[k].i;
+        C_MUL(fout[k],t,c[k]);
+    }
+    KF_SCRATCH_PUT(&st->scratchbusy,st->scratch,a);
+}
+
+/* Fills in the chirp and its transform once st->bluestein is in place */
+static void kf_bluestein_init(kiss_fft_cfg st)
+{
+    const int n = st->nfft, M = st->bluestein->nfft;
+    const double pi=3.141592653589793238462643383279502884197169399375105820974944;
+    const kiss_fft_scalar scale = (kiss_fft_scalar)(1.0/M);
+    int k;
+
+    for (k=0;k<n;++k) {
+        /* k^2 mod 2n keeps the phase exact for large k */
+        double phase = -pi*(double)(((long long)k*k) % (2*(long long)n)) / n;
+        if (st->inverse)
+            phase *= -1;
+        kf_cexp(st->twiddles+k,phase);
+    }
+    memset(st->chirpfft,0,sizeof(kiss_fft_cpx)*M);
+    for (k=0;k<n;++k) {
+        st->chirpfft[k].r = st->twiddles[k].r;
+        st->chirpfft[k].i = -st->twiddles[k].i;
+        if (k)
+            st->chirpfft[M-k] = st->chirpfft[k];
+    }
+    kiss_fft(st->bluestein,st->chirpfft,st->chirpfft);
+    for (k=0;k<M;++k)
+        C_MULBYSCALAR(st->chirpfft[k],scale);
+}
+#endif
+
 /*
  *
  * User-callable function to allocate all necessary storage space for the fft.
@@ -334,13 +802,53 @@ void kf_factor(int n,int * facbuf)
  * The return value is a contiguous block of memory, allocated with malloc.  As such,
  * It can be freed with free(), rather than a kiss_fft-specific function.
  * */
-kiss_fft_cfg kiss_fft_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem )
+kiss_fft_cfg kiss_fft_alloc_engine(int nfft,int inverse_fft,int engine,void * mem,size_t * lenmem )
 {
     KISS_FFT_ALIGN_CHECK(mem)
 
     kiss_fft_cfg st=NULL;
-    size_t memneeded = KISS_FFT_ALIGN_SIZE_UP(sizeof(struct kiss_fft_state)
-        + sizeof(kiss_fft_cpx)*(nfft-1)); /* twiddle factors*/
+    int factors[2*MAXFACTORS];
+    int i;
+    int leaf = 0;
+    const int vec = kf_vec_level();
+    size_t twsize, scroff, memneeded, batch = 0;
+    int bluestein = 0;
+    size_t sublen = 0;
+
+    if (engine == KISS_FFT_ENGINE_AUTO) {
+        const char * env = getenv("KISSFFT_ENGINE");
+        if (env && strcmp(env,"recursive") == 0)
+            engine = KISS_FFT_ENGINE_RECURSIVE;
+        else if (env && strcmp(env,"stockham") == 0)
+            engine = KISS_FFT_ENGINE_STOCKHAM;
+        else
+            engine = vec == KF_VEC_SCALAR ? KISS_FFT_ENGINE_RECURSIVE : KISS_FFT_ENGINE_STOCKHAM;
+    }
+    kf_factor(nfft,factors);
+#ifdef KF_BLUESTEIN
+    /* kf_factor puts the largest prime last; bluestein becomes the convolution length M */
+    for (i=0;factors[2*i+1]>1;++i) {}
+    if (factors[2*i] >= KISS_FFT_BLUESTEIN_MIN) {
+        while (bluestein < 2*nfft-1)
+            bluestein = bluestein ? 2*bluestein : 1;
+        kiss_fft_alloc_engine(bluestein,0,engine,NULL,&sublen);
+    }
+#endif
+    if (engine == KISS_FFT_ENGINE_RECURSIVE && !bluestein)
+        kf_plan(nfft,factors,&leaf);
+
+    twsize = sizeof(struct kiss_fft_state) + sizeof(kiss_fft_cpx)*(nfft-1); /* twiddle factors*/
+    if (bluestein) {
+        /* then the chirp transform and the M-point plan, then scratch for the convolution */
+        twsize = (twsize + 15) & ~(size_t)15;
+        scroff = (twsize + sizeof(kiss_fft_cpx)*bluestein + sublen + 15) & ~(size_t)15;
+        memneeded = KISS_FFT_ALIGN_SIZE_UP(scroff + sizeof(kiss_fft_cpx)*2*bluestein);
+    }else{
+        /* then the stage tables, then scratch for a batch block, one transform and a generic butterfly */
+        batch = kf_batch_len(nfft,factors,vec,leaf);
+        scroff = (twsize + kf_stagetw_size(factors) + 15) & ~(size_t)15;
+        memneeded = KISS_FFT_ALIGN_SIZE_UP(scroff + sizeof(kiss_fft_cpx)*(batch + nfft + kf_generic_max(factors)));
+    }
 
     if ( lenmem==NULL ) {
         st = ( kiss_fft_cfg)KISS_FFT_MALLOC( memneeded );
@@ -350,9 +858,30 @@ kiss_fft_cfg kiss_fft_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem
         *lenmem = memneeded;
     }
     if (st) {
-        int i;
         st->nfft=nfft;
         st->inverse = inverse_fft;
+        st->vec = vec;
+        st->engine = engine;
+        st->leaf = leaf;
+        st->threads = kf_plan_threads((size_t)nfft);
+        memcpy(st->factors,factors,sizeof(factors));
+        st->bluestein = NULL;
+        st->chirpfft = NULL;
+        st->batchbuf = batch ? (kiss_fft_cpx*)((char*)st + scroff) : NULL;
+        st->scratch = (kiss_fft_cpx*)((char*)st + scroff) + batch;
+        st->genscratch = st->scratch + nfft;
+        atomic_init(&st->scratchbusy,0);
+        atomic_init(&st->genbusy,0);
+        atomic_init(&st->batchbusy,0);
+#ifdef KF_BLUESTEIN
+        if (bluestein) {
+            st->chirpfft = (kiss_fft_cpx*)((char*)st + twsize);
+            st->genscratch = NULL;
+            st->bluestein = kiss_fft_alloc_engine(bluestein,0,engine,st->chirpfft + bluestein,&sublen);
+            kf_bluestein_init(st);
+            return st;
+        }
+#endif
 
         for (i=0;i<nfft;++i) {
             const double pi=3.141592653589793238462643383279502884197169399375105820974944;
@@ -362,23 +891,63 @@ kiss_fft_cfg kiss_fft_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem
             kf_cexp(st->twiddles+i, phase );
         }
 
-        kf_factor(nfft,st->factors);
+        kf_stagetw_init(st,(char*)st + twsize);
     }
     return st;
 }
 
+kiss_fft_cfg kiss_fft_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem )
+{
+#if defined(KF_VEC_X86_Q15) || defined(KF_VEC_ARM_Q15)
+    /* the int16 kernels are at their fastest on Stockham, and the engines agree to the bit */
+    return kiss_fft_alloc_engine(nfft,inverse_fft,KISS_FFT_ENGINE_AUTO,mem,lenmem);
+#else
+    const char * engine = getenv("KISSFFT_ENGINE");
+    if (engine && strcmp(engine,"stockham") == 0)
+        return kiss_fft_alloc_engine(nfft,inverse_fft,KISS_FFT_ENGINE_STOCKHAM,mem,lenmem);
+    return kiss_fft_alloc_engine(nfft,inverse_fft,KISS_FFT_ENGINE_RECURSIVE,mem,lenmem);
+#endif
+}
+
 
 void kiss_fft_stride(kiss_fft_cfg st,const kiss_fft_cpx *fin,kiss_fft_cpx *fout,int in_stride)
 {
+#ifdef KF_BLUESTEIN
+    if (st->bluestein) {
+        if (fout == NULL){
+            KISS_FFT_ERROR("fout buffer NULL.");
+            return;
+        }
+        kf_bluestein(st,fin,fout,in_stride);
+        return;
+    }
+#endif
+    /* Stockham stages have no parallel form; a plan past the thread crossover takes kf_work */
+    if (st->engine == KISS_FFT_ENGINE_STOCKHAM && st->threads <= 1) {
+        kiss_fft_cpx * buf;
+        if (fout == NULL){
+            KISS_FFT_ERROR("fout buffer NULL.");
+            return;
+        }
+        buf = KF_SCRATCH(&st->scratchbusy,st->scratch,st->nfft);
+        if (buf == NULL){
+            KISS_FFT_ERROR("Memory allocation error.");
+            return;
+        }
+        kf_stockham(st,fin,in_stride,fout,buf);
+        KF_SCRATCH_PUT(&st->scratchbusy,st->scratch,buf);
+        return;
+    }
     if (fin == fout) {
         //NOTE: this is not really an in-place FFT algorithm.
-        //It just performs an out-of-place FFT into a temp buffer
+        //It just performs an out-of-place FFT into the plan's scratch and copies it back.
+        //The Stockham engine (kf_stockham) is the one that works in place.
         if (fout == NULL){
             KISS_FFT_ERROR("fout buffer NULL.");
         return;
         }
 
-        kiss_fft_cpx * tmpbuf = (kiss_fft_cpx*)KISS_FFT_TMP_ALLOC( sizeof(kiss_fft_cpx)*st->nfft);
+        kiss_fft_cpx * tmpbuf = KF_SCRATCH(&st->scratchbusy,st->scratch,st->nfft);
         if (tmpbuf == NULL){
             KISS_FFT_ERROR("Memory allocation error.");
         return;
@@ -388,7 +957,7 @@ void kiss_fft_stride(kiss_fft_cfg st,const kiss_fft_cpx *fin,kiss_fft_cpx *fout,
 
         kf_work(tmpbuf,fin,1,in_stride, st->factors,st);
         memcpy(fout,tmpbuf,sizeof(kiss_fft_cpx)*st->nfft);
-        KISS_FFT_TMP_FREE(tmpbuf);
+        KF_SCRATCH_PUT(&st->scratchbusy,st->scratch,tmpbuf);
     }else{
         kf_work( fout, fin, 1,in_stride, st->factors,st );
     }
@@ -399,6 +968,105 @@ void kiss_fft(kiss_fft_cfg cfg,const kiss_fft_cpx *fin,kiss_fft_cpx *fout)
     kiss_fft_stride(cfg,fin,fout,1);
 }
 
+/*
+ * Batches. Transposing nb inputs so that element k of transform b lands at k*nb + b turns every
+ * stage of the nb transforms into one Stockham stage with s scaled by nb (kf_stockham_stage),
+ * so the plan is walked once per block and the late stages, whose s is too small to fill a
+ * vector in a single transform, run full width. Plans that can (kf_batch_len) carry the block
+ * in batchbuf; anything else goes one transform at a time.
+ */
+
+/* nb transforms through buf, which holds 2*nb*nfft */
+static void kf_batch_block(const kiss_fft_cfg st, size_t nb,
+        const kiss_fft_cpx * fin, size_t in_stride, size_t in_dist,
+        kiss_fft_cpx * fout, size_t out_dist, kiss_fft_cpx * buf)
+{
+    const size_t n = (size_t)st->nfft;
+    kiss_fft_cpx * x = buf, * y = buf + n*nb, * t;
+    size_t k,b;
+    int i = 0;
+
+    for (k=0;k<n;++k)
+        for (b=0;b<nb;++b)
+            x[k*nb + b] = fin[b*in_dist + k*in_stride];
+
+    while (st->factors[2*i+1] > 1) ++i;
+    for (;i>=0;--i) {
+        kf_stockham_stage(x,1,y,st,i,nb);
+        t = x; x = y; y = t;
+    }
+
+    for (b=0;b<nb;++b)
+        for (k=0;k<n;++k)
+            fout[b*out_dist + k] = x[k*nb + b];
+}
+
+struct kf_batch_task
+{
+    kiss_fft_cfg st;
+    const kiss_fft_cpx * fin;
+    kiss_fft_cpx * fout;
+    size_t in_stride, in_dist, out_dist;
+    int blocks;
+};
+
+/* task j < blocks is the j-th interleaved block, the ones after it the leftover transforms */
+static void kf_batch_sub(void * arg,int j)
+{
+    const struct kf_batch_task * t = (const struct kf_batch_task*)arg;
+    const size_t nb = KISS_FFT_BATCH;
+    size_t first;
+    kiss_fft_cpx * buf;
+
+    if (j >= t->blocks) {
+        first = (size_t)t->blocks*nb + (size_t)(j - t->blocks);
+        kiss_fft_stride(t->st,t->fin + first*t->in_dist,t->fout + first*t->out_dist,(int)t->in_stride);
+        return;
+    }
+    first = (size_t)j*nb;
+    buf = KF_SCRATCH(&t->st->batchbusy,t->st->batchbuf,2*nb*t->st->nfft);
+    if (buf == NULL) {
+        KISS_FFT_ERROR("Memory allocation error.");
+        return;
+    }
+    kf_batch_block(t->st,nb,t->fin + first*t->in_dist,t->in_stride,t->in_dist,
+            t->fout + first*t->out_dist,t->out_dist,buf);
+    KF_SCRATCH_PUT(&t->st->batchbusy,t->st->batchbuf,buf);
+}
+
+void kiss_fft_batch(kiss_fft_cfg st,int howmany,const kiss_fft_cpx *fin,int in_stride,int in_dist,
+        kiss_fft_cpx *fout,int out_dist)
+{
+    const size_t nb = KISS_FFT_BATCH;
+    struct kf_batch_task t;
+    int tasks, j;
+
+    if (howmany <= 0)
+        return;
+    if (fout == NULL){
+        KISS_FFT_ERROR("fout buffer NULL.");
+        return;
+    }
+
+    /* whole blocks interleaved, the rest one at a time */
+    t.st = st;
+    t.fin = fin;
+    t.fout = fout;
+    t.in_stride = (size_t)in_stride;
+    t.in_dist = (size_t)in_dist;
+    t.out_dist = (size_t)out_dist;
+    t.blocks = st->batchbuf ? howmany / (int)nb : 0;
+    tasks = howmany - t.blocks*((int)nb - 1);
+
+    /* in parallel when the whole batch is past the crossover, the first block to claim it in the
+       plan's batchbuf and the others in one of their own; else block after block in batchbuf */
+    if (kf_plan_threads((size_t)howmany*st->nfft) > 1) {
+        kf_parallel_for(tasks,kf_batch_sub,&t);
+        return;
+    }
+    for (j=0;j<tasks;++j)
+        kf_batch_sub(&t,j);
+}
 
 void kiss_fft_cleanup(void)
 {
@@ -47,11 +47,21 @@ extern "C" {
 */
 
 /* User may override KISS_FFT_MALLOC and/or KISS_FFT_FREE. */
+
+/* Test hook: with KISS_FFT_COUNT_ALLOCS the default KISS_FFT_MALLOC counts its calls in
+   kiss_fft_allocs, which the program defines (see test/test_alloc.c). */
+#ifdef KISS_FFT_COUNT_ALLOCS
+extern long kiss_fft_allocs;
+# define KISS_FFT_COUNTED(p) (++kiss_fft_allocs,(p))
+#else
+# define KISS_FFT_COUNTED(p) (p)
+#endif
+
 #ifdef USE_SIMD
 # include <xmmintrin.h>
 # define kiss_fft_scalar __m128
 # ifndef KISS_FFT_MALLOC
-#  define KISS_FFT_MALLOC(nbytes) _mm_malloc(nbytes,16)
+#  define KISS_FFT_MALLOC(nbytes) KISS_FFT_COUNTED(_mm_malloc(nbytes,16))
 #  define KISS_FFT_ALIGN_CHECK(ptr) 
 #  define KISS_FFT_ALIGN_SIZE_UP(size) ((size + 15UL) & ~0xFUL)
 # endif
@@ -62,7 +72,7 @@ extern "C" {
 # define KISS_FFT_ALIGN_CHECK(ptr)
 # define KISS_FFT_ALIGN_SIZE_UP(size) (size)
 # ifndef KISS_FFT_MALLOC
-#  define KISS_FFT_MALLOC malloc
+#  define KISS_FFT_MALLOC(nbytes) KISS_FFT_COUNTED(malloc(nbytes))
 # endif
 # ifndef KISS_FFT_FREE
 #  define KISS_FFT_FREE free
@@ -112,10 +122,32 @@ typedef struct kiss_fft_state* kiss_fft_cfg;
  *  If lenmem is not NULL and ( mem is NULL or *lenmem is not large enough),
  *      then the function returns NULL and places the minimum cfg 
  *      buffer size in *lenmem.
+ *
+ *  The cfg holds pointers into itself (the per-stage twiddle tables), so it
+ *  must stay where it was placed: don't memcpy it somewhere else and use that.
  * */
 
 kiss_fft_cfg KISS_FFT_API kiss_fft_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem);
 
+/*
+ *  kiss_fft_alloc_engine
+ *
+ *  Same as kiss_fft_alloc, choosing how kiss_fft runs the plan:
+ *    KISS_FFT_ENGINE_RECURSIVE  depth-first recursion with strided reads (what kiss_fft_alloc uses,
+ *                               except in the int16_t build, where it takes KISS_FFT_ENGINE_AUTO)
+ *    KISS_FFT_ENGINE_STOCKHAM   iterative, breadth-first stages that ping-pong between
+ *                               fout and a scratch buffer with unit-stride access
+ *    KISS_FFT_ENGINE_AUTO       Stockham when the vectorised butterflies are available
+ *                               (see _kiss_fft_vec.h), where it is the faster of the two, else recursive
+ *  Both give the same results up to rounding, and in fixed point exactly the same results. KISSFFT_ENGINE=recursive or =stockham in the
+ *  environment overrides kiss_fft_alloc and KISS_FFT_ENGINE_AUTO, e.g. for the tests.
+ * */
+#define KISS_FFT_ENGINE_RECURSIVE 0
+#define KISS_FFT_ENGINE_STOCKHAM 1
+#define KISS_FFT_ENGINE_AUTO 2
+
+kiss_fft_cfg KISS_FFT_API kiss_fft_alloc_engine(int nfft,int inverse_fft,int engine,void * mem,size_t * lenmem);
+
 /*
  * kiss_fft(cfg,in_out_buf)
  *
@@ -133,6 +165,21 @@ void KISS_FFT_API kiss_fft(kiss_fft_cfg cfg,const kiss_fft_cpx *fin,kiss_fft_cpx
  * */
 void KISS_FFT_API kiss_fft_stride(kiss_fft_cfg cfg,const kiss_fft_cpx *fin,kiss_fft_cpx *fout,int fin_stride);
 
+/*
+ * kiss_fft_batch
+ *
+ * howmany transforms with one cfg: transform j reads fin[j*in_dist + k*in_stride] and writes
+ * fout[j*out_dist + k], k < nfft. Same results as calling kiss_fft_stride on each, faster for
+ * many transforms: where the vector butterflies are available, Stockham plans
+ * (kiss_fft_alloc_engine) whose radices are all 2-5 run KISS_FFT_BATCH transforms at a time
+ * interleaved element by element, so every stage fills the vectors; the rest of the batch and
+ * other plans run one transform at a time. A batch past the threading crossover is split
+ * across threads (see _kiss_fft_pool.h). fout may be fin when in_stride is 1 and out_dist equals in_dist;
+ * other overlaps are undefined.
+ * */
+void KISS_FFT_API kiss_fft_batch(kiss_fft_cfg cfg,int howmany,const kiss_fft_cpx *fin,int in_stride,int in_dist,
+        kiss_fft_cpx *fout,int out_dist);
+
 /* If kiss_fft_alloc allocated a buffer, it is one contiguous 
    buffer and can be simply free()d when no longer needed*/
 #define kiss_fft_free KISS_FFT_FREE
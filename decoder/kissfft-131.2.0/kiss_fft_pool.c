@@ -0,0 +1,368 @@
+/*
+ *  Copyright (c) 2003-2010, Mark Borgerding. All rights reserved.
+ *  This file is part of KISS FFT - https://github.com/mborgerding/kissfft
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  See COPYING file for more information.
+ */
+
+#if defined(KISS_FFT_THREADS) && defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* pthread_setaffinity_np, sched_getaffinity */
+#endif
+
+#ifdef KISS_FFT_THREADS
+
+#include "_kiss_fft_pool.h"
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * The pool starts on first use: one worker per CPU the process may run on, less one for the
+ * caller, each pinned to its own CPU. Every worker owns a deque; threads outside the pool
+ * share one more. kf_pool_for(n,...) is a parallel for: it pushes up to n-1 entries naming
+ * the job onto the caller's deque, runs indices itself, and every thread that picks up an
+ * entry claims indices from the same counter until they run out. Owners pop the newest entry
+ * (the innermost job, still in cache), thieves take the oldest from the other deques. Once its
+ * indices are gone the caller takes back the entries nobody picked up, helps with other jobs
+ * while the rest finish, and returns when no thread still holds an entry, so the job can live
+ * on its stack. Idle workers spin for a while, since transforms tend to come in runs, then
+ * sleep on a condition variable until something is pushed.
+ */
+#define KF_POOL_MAX 64     /* workers */
+#define KF_DEQUE 256       /* entries per deque */
+#define KF_SPIN 20000      /* polls before an idle worker sleeps */
+#define KF_INJECT KF_POOL_MAX /* the deque of threads outside the pool */
+
+/* the crossover: parallel once the serial time is this many pool round trips */
+#define KF_POOL_GAIN 8
+
+typedef struct kf_job
+{
+    kf_task_fn fn;
+    void * arg;
+    int n;
+    atomic_int next;  /* next index to run */
+    atomic_int done;  /* indices finished */
+    atomic_int refs;  /* entries taken by a thread that has not let go of the job yet */
+} kf_job;
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    int top, bottom;  /* entries top..bottom-1, modulo KF_DEQUE */
+    kf_job * ring[KF_DEQUE];
+} kf_deque;
+
+static struct
+{
+    int workers;
+    kf_deque deques[KF_POOL_MAX + 1];
+    atomic_int queued;  /* entries in all deques */
+    atomic_int idle;    /* workers asleep, or about to be */
+    pthread_mutex_t sleep_lock;
+    pthread_cond_t wake;
+    atomic_int calibrated; /* 0 not yet, 1 measuring, 2 done */
+    size_t min_points;
+} kf_pool;
+
+static pthread_once_t kf_pool_once = PTHREAD_ONCE_INIT;
+static _Thread_local int kf_self = KF_INJECT;
+
+static void kf_push(kf_deque * d,kf_job * job,int count,int * pushed)
+{
+    pthread_mutex_lock(&d->lock);
+    *pushed = 0;
+    while (*pushed < count && d->bottom - d->top < KF_DEQUE) {
+        d->ring[d->bottom % KF_DEQUE] = job;
+        ++d->bottom;
+        ++*pushed;
+    }
+    pthread_mutex_unlock(&d->lock);
+}
+
+static kf_job * kf_pop(kf_deque * d,int newest)
+{
+    kf_job * job = NULL;
+    pthread_mutex_lock(&d->lock);
+    if (d->bottom > d->top) {
+        if (newest)
+            job = d->ring[--d->bottom % KF_DEQUE];
+        else
+            job = d->ring[d->top++ % KF_DEQUE];
+        if (d->top == d->bottom)
+            d->top = d->bottom = 0;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return job;
+}
+
+/* removes the entries still naming job, returns how many */
+static int kf_reclaim(kf_deque * d,kf_job * job)
+{
+    int i, kept, removed;
+    pthread_mutex_lock(&d->lock);
+    kept = d->top;
+    for (i = d->top; i < d->bottom; ++i)
+        if (d->ring[i % KF_DEQUE] != job)
+            d->ring[kept++ % KF_DEQUE] = d->ring[i % KF_DEQUE];
+    removed = d->bottom - kept;
+    d->bottom = kept;
+    pthread_mutex_unlock(&d->lock);
+    return removed;
+}
+
+/* an entry to run: the newest of our own, else the oldest of someone else's */
+static kf_job * kf_take(void)
+{
+    kf_job * job;
+    int i;
+    if (atomic_load_explicit(&kf_pool.queued,memory_order_relaxed) == 0)
+        return NULL;
+    job = kf_pop(&kf_pool.deques[kf_self],1);
+    /* the workers' deques then the shared one, as 0..workers, starting after our own */
+    for (i = 1; job == NULL && i <= kf_pool.workers; ++i) {
+        int v = ((kf_self == KF_INJECT ? kf_pool.workers : kf_self) + i) % (kf_pool.workers + 1);
+        job = kf_pop(&kf_pool.deques[v == kf_pool.workers ? KF_INJECT : v],0);
+    }
+    if (job)
+        atomic_fetch_sub(&kf_pool.queued,1);
+    return job;
+}
+
+static void kf_run(kf_job * job)
+{
+    int i;
+    while ((i = atomic_fetch_add(&job->next,1)) < job->n) {
+        job->fn(job->arg,i);
+        atomic_fetch_add(&job->done,1);
+    }
+}
+
+/* run an entry taken from a deque; the job may be gone right after the last line */
+static void kf_run_entry(kf_job * job)
+{
+    kf_run(job);
+    atomic_fetch_sub(&job->refs,1);
+}
+
+static void * kf_worker(void * arg)
+{
+    int spins = 0;
+    kf_self = (int)(size_t)arg;
+    for (;;) {
+        kf_job * job = kf_take();
+        if (job) {
+            kf_run_entry(job);
+            spins = 0;
+            continue;
+        }
+        if (++spins < KF_SPIN) {
+            if ((spins & 63) == 0)
+                sched_yield();
+            continue;
+        }
+        pthread_mutex_lock(&kf_pool.sleep_lock);
+        atomic_fetch_add(&kf_pool.idle,1);
+        while (atomic_load(&kf_pool.queued) == 0)
+            pthread_cond_wait(&kf_pool.wake,&kf_pool.sleep_lock);
+        atomic_fetch_sub(&kf_pool.idle,1);
+        pthread_mutex_unlock(&kf_pool.sleep_lock);
+        spins = 0;
+    }
+    return NULL;
+}
+
+static void kf_pool_start(void)
+{
+    const char * env = getenv("KISSFFT_THREADS");
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int i, cpus[KF_POOL_MAX + 1], ncpus = 0;
+#ifdef __linux__
+    cpu_set_t set;
+    if (sched_getaffinity(0,sizeof(set),&set) == 0) {
+        for (i = 0; i < CPU_SETSIZE && ncpus <= KF_POOL_MAX; ++i)
+            if (CPU_ISSET(i,&set))
+                cpus[ncpus++] = i;
+        threads = ncpus;
+    }
+#endif
+    if (env)
+        threads = atoi(env);
+    if (threads > KF_POOL_MAX + 1)
+        threads = KF_POOL_MAX + 1;
+
+    for (i = 0; i <= KF_POOL_MAX; ++i)
+        pthread_mutex_init(&kf_pool.deques[i].lock,NULL);
+    pthread_mutex_init(&kf_pool.sleep_lock,NULL);
+    pthread_cond_init(&kf_pool.wake,NULL);
+
+    /* set before any worker reads it; a worker that fails to start only leaves an empty deque */
+    kf_pool.workers = threads > 1 ? threads - 1 : 0;
+    for (i = 0; i < kf_pool.workers; ++i) {
+        pthread_t t;
+        pthread_attr_t attr;
+        int err;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr,PTHREAD_CREATE_DETACHED);
+        err = pthread_create(&t,&attr,kf_worker,(void*)(size_t)i);
+        pthread_attr_destroy(&attr);
+        if (err != 0)
+            continue;
+#ifdef __linux__
+        /* worker i on the i+1-th allowed CPU, leaving the first to the caller; only
+           when there are enough of them, since two pinned to one CPU would take turns */
+        if (ncpus >= threads) {
+            CPU_ZERO(&set);
+            CPU_SET(cpus[i + 1],&set);
+            pthread_setaffinity_np(t,sizeof(set),&set);
+        }
+#endif
+    }
+}
+
+void kf_pool_for(int n,kf_task_fn fn,void * arg)
+{
+    kf_job job;
+    kf_deque * d;
+    int pushed = 0;
+
+    pthread_once(&kf_pool_once,kf_pool_start);
+    if (n <= 1 || kf_pool.workers == 0) {
+        int i;
+        for (i = 0; i < n; ++i)
+            fn(arg,i);
+        return;
+    }
+
+    job.fn = fn;
+    job.arg = arg;
+    job.n = n;
+    atomic_init(&job.next,0);
+    atomic_init(&job.done,0);
+    atomic_init(&job.refs,0);
+
+    d = &kf_pool.deques[kf_self];
+    atomic_store(&job.refs,n - 1 < kf_pool.workers ? n - 1 : kf_pool.workers);
+    kf_push(d,&job,atomic_load(&job.refs),&pushed);
+    atomic_fetch_sub(&job.refs,atomic_load(&job.refs) - pushed);
+    atomic_fetch_add(&kf_pool.queued,pushed);
+    if (atomic_load(&kf_pool.idle) > 0) {
+        pthread_mutex_lock(&kf_pool.sleep_lock);
+        pthread_cond_broadcast(&kf_pool.wake);
+        pthread_mutex_unlock(&kf_pool.sleep_lock);
+    }
+
+    kf_run(&job);
+
+    pushed = kf_reclaim(d,&job);
+    if (pushed) {
+        atomic_fetch_sub(&kf_pool.queued,pushed);
+        atomic_fetch_sub(&job.refs,pushed);
+    }
+    while (atomic_load(&job.done) < n || atomic_load(&job.refs) > 0) {
+        kf_job * other = kf_take();
+        if (other)
+            kf_run_entry(other);
+        else
+            sched_yield();
+    }
+}
+
+static double kf_now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC,&t);
+    return t.tv_sec + t.tv_nsec*1e-9;
+}
+
+/* every task waits until all have started, so the caller cannot run them all by itself */
+static void kf_rendezvous(void * arg,int i)
+{
+    atomic_int * arrived = (atomic_int*)arg;
+    double deadline = 0;
+    (void)i;
+    atomic_fetch_add(arrived,1);
+    while (atomic_load(arrived) < kf_pool.workers + 1) {
+        if (deadline == 0)
+            deadline = kf_now() + 0.01;
+        else if (kf_now() > deadline)
+            break;
+        sched_yield();
+    }
+}
+
+/*
+ * The crossover: the round trip of a parallel for that needs every thread against the time
+ * of a serial 4096-point transform, scaled as n log n. The smallest power of two whose
+ * estimated time covers KF_POOL_GAIN round trips, and every size above it, goes parallel.
+ * Plans allocated while this runs (its own included) stay serial.
+ */
+static size_t kf_pool_calibrate(void)
+{
+    const int n = 4096;
+    double trip = 1e9, fft = 1e9, t;
+    kiss_fft_cpx * buf;
+    kiss_fft_cfg cfg;
+    size_t points;
+    int i, r;
+
+    for (r = 0; r < 200; ++r) {
+        atomic_int arrived = 0;
+        t = kf_now();
+        kf_pool_for(kf_pool.workers + 1,kf_rendezvous,&arrived);
+        t = kf_now() - t;
+        if (r >= 20 && t < trip)
+            trip = t;
+    }
+
+    cfg = kiss_fft_alloc_engine(n,0,KISS_FFT_ENGINE_AUTO,NULL,NULL);
+    buf = (kiss_fft_cpx*)KISS_FFT_MALLOC(sizeof(kiss_fft_cpx)*2*n);
+    if (cfg == NULL || buf == NULL) {
+        KISS_FFT_FREE(cfg);
+        KISS_FFT_FREE(buf);
+        return (size_t)-1;
+    }
+    memset(buf,0,sizeof(kiss_fft_cpx)*n);
+    for (r = 0; r < 5; ++r) {
+        t = kf_now();
+        kiss_fft(cfg,buf,buf + n);
+        t = kf_now() - t;
+        if (t < fft)
+            fft = t;
+    }
+    KISS_FFT_FREE(cfg);
+    KISS_FFT_FREE(buf);
+
+    for (i = 6; i < 30; ++i) {
+        points = (size_t)1 << i;
+        if (fft * points * i / (n * 12.0) >= KF_POOL_GAIN * trip)
+            return points;
+    }
+    return (size_t)-1;
+}
+
+int kf_pool_threads(size_t points)
+{
+    int state = 0;
+    pthread_once(&kf_pool_once,kf_pool_start);
+    if (kf_pool.workers == 0)
+        return 1;
+    if (atomic_compare_exchange_strong(&kf_pool.calibrated,&state,1)) {
+        const char * env = getenv("KISSFFT_THREADS_MIN");
+        kf_pool.min_points = env ? (size_t)atol(env) : kf_pool_calibrate();
+        atomic_store(&kf_pool.calibrated,2);
+    } else if (state == 1) {
+        return 1;
+    }
+    return points >= kf_pool.min_points ? kf_pool.workers + 1 : 1;
+}
+
+#else
+
+typedef int kf_pool_unused; /* ISO C wants something in every translation unit */
+
+#endif /* KISS_FFT_THREADS */
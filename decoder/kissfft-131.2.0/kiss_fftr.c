@@ -8,17 +8,18 @@
 
 #include "kiss_fftr.h"
 #include "_kiss_fft_guts.h"
+#include "_kiss_fft_pool.h"
 
+/* three pointers and an int: a multiple of 16 bytes, which the USE_SIMD substate after it needs */
 struct kiss_fftr_state{
     kiss_fft_cfg substate;
-    kiss_fft_cpx * tmpbuf;
+    kiss_fft_cpx * tmpbuf; /* claimed through tmpbusy, see KF_SCRATCH */
     kiss_fft_cpx * super_twiddles;
-#ifdef USE_SIMD
-    void * pad;
-#endif
+    atomic_int tmpbusy;
 };
 
-kiss_fftr_cfg kiss_fftr_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem)
+/* engine < 0: the complex plan comes from kiss_fft_alloc, else from kiss_fft_alloc_engine */
+static kiss_fftr_cfg kf_fftr_alloc(int nfft,int inverse_fft,int engine,void * mem,size_t * lenmem)
 {
 	KISS_FFT_ALIGN_CHECK(mem)
 
@@ -32,7 +33,10 @@ kiss_fftr_cfg kiss_fftr_alloc(int nfft,int inverse_fft,void * mem,size_t * lenme
     }
     nfft >>= 1;
 
-    kiss_fft_alloc (nfft, inverse_fft, NULL, &subsize);
+    if (engine < 0)
+        kiss_fft_alloc (nfft, inverse_fft, NULL, &subsize);
+    else
+        kiss_fft_alloc_engine (nfft, inverse_fft, engine, NULL, &subsize);
     memneeded = sizeof(struct kiss_fftr_state) + subsize + sizeof(kiss_fft_cpx) * ( nfft * 3 / 2);
 
     if (lenmem == NULL) {
@@ -48,7 +52,11 @@ kiss_fftr_cfg kiss_fftr_alloc(int nfft,int inverse_fft,void * mem,size_t * lenme
     st->substate = (kiss_fft_cfg) (st + 1); /*just beyond kiss_fftr_state struct */
     st->tmpbuf = (kiss_fft_cpx *) (((char *) st->substate) + subsize);
     st->super_twiddles = st->tmpbuf + nfft;
-    kiss_fft_alloc(nfft, inverse_fft, st->substate, &subsize);
+    atomic_init(&st->tmpbusy,0);
+    if (engine < 0)
+        kiss_fft_alloc(nfft, inverse_fft, st->substate, &subsize);
+    else
+        kiss_fft_alloc_engine(nfft, inverse_fft, engine, st->substate, &subsize);
 
     for (i = 0; i < nfft/2; ++i) {
         double phase =
@@ -60,22 +68,25 @@ kiss_fftr_cfg kiss_fftr_alloc(int nfft,int inverse_fft,void * mem,size_t * lenme
     return st;
 }
 
-void kiss_fftr(kiss_fftr_cfg st,const kiss_fft_scalar *timedata,kiss_fft_cpx *freqdata)
+kiss_fftr_cfg kiss_fftr_alloc(int nfft,int inverse_fft,void * mem,size_t * lenmem)
 {
-    /* input buffer timedata is stored row-wise */
-    int k,ncfft;
-    kiss_fft_cpx fpnk,fpk,f1k,f2k,tw,tdc;
+    return kf_fftr_alloc(nfft,inverse_fft,-1,mem,lenmem);
+}
 
-    if ( st->substate->inverse) {
-        KISS_FFT_ERROR("kiss fft usage error: improper alloc");
-        return;/* The caller did not call the correct function */
-    }
+kiss_fftr_cfg kiss_fftr_alloc_engine(int nfft,int inverse_fft,int engine,void * mem,size_t * lenmem)
+{
+    return kf_fftr_alloc(nfft,inverse_fft,engine,mem,lenmem);
+}
 
-    ncfft = st->substate->nfft;
+/* the spectrum of the real input from tmpbuf, the transform of its even/odd samples packed as complex;
+   tmpbuf may be freqdata */
+static void kf_fftr_split(kiss_fftr_cfg st,const kiss_fft_cpx *tmpbuf,kiss_fft_cpx *freqdata)
+{
+    int k;
+    const int ncfft = st->substate->nfft;
+    kiss_fft_cpx fpnk,fpk,f1k,f2k,tw,tdc;
 
-    /*perform the parallel fft of two real signals packed in real,imag*/
-    kiss_fft( st->substate , (const kiss_fft_cpx*)timedata, st->tmpbuf );
-    /* The real part of the DC element of the frequency spectrum in st->tmpbuf
+    /* The real part of the DC element of the frequency spectrum in tmpbuf
      * contains the sum of the even-numbered elements of the input time sequence
      * The imag part is the sum of the odd-numbered elements
      *
@@ -85,8 +96,8 @@ void kiss_fftr(kiss_fftr_cfg st,const kiss_fft_scalar *timedata,kiss_fft_cpx *fr
      *      yielding Nyquist bin of input time sequence
      */
 
-    tdc.r = st->tmpbuf[0].r;
-    tdc.i = st->tmpbuf[0].i;
+    tdc.r = tmpbuf[0].r;
+    tdc.i = tmpbuf[0].i;
     C_FIXDIV(tdc,2);
     CHECK_OVERFLOW_OP(tdc.r ,+, tdc.i);
     CHECK_OVERFLOW_OP(tdc.r ,-, tdc.i);
@@ -99,9 +110,9 @@ void kiss_fftr(kiss_fftr_cfg st,const kiss_fft_scalar *timedata,kiss_fft_cpx *fr
 #endif
 
     for ( k=1;k <= ncfft/2 ; ++k ) {
-        fpk    = st->tmpbuf[k];
-        fpnk.r =   st->tmpbuf[ncfft-k].r;
-        fpnk.i = - st->tmpbuf[ncfft-k].i;
+        fpk    = tmpbuf[k];
+        fpnk.r =   tmpbuf[ncfft-k].r;
+        fpnk.i = - tmpbuf[ncfft-k].i;
         C_FIXDIV(fpk,2);
         C_FIXDIV(fpnk,2);
 
@@ -116,21 +127,35 @@ void kiss_fftr(kiss_fftr_cfg st,const kiss_fft_scalar *timedata,kiss_fft_cpx *fr
     }
 }
 
-void kiss_fftri(kiss_fftr_cfg st,const kiss_fft_cpx *freqdata,kiss_fft_scalar *timedata)
+void kiss_fftr(kiss_fftr_cfg st,const kiss_fft_scalar *timedata,kiss_fft_cpx *freqdata)
 {
+    kiss_fft_cpx * tmpbuf;
     /* input buffer timedata is stored row-wise */
-    int k, ncfft;
-
-    if (st->substate->inverse == 0) {
+    if ( st->substate->inverse) {
         KISS_FFT_ERROR("kiss fft usage error: improper alloc");
         return;/* The caller did not call the correct function */
     }
 
-    ncfft = st->substate->nfft;
+    tmpbuf = KF_SCRATCH(&st->tmpbusy,st->tmpbuf,st->substate->nfft);
+    if (tmpbuf == NULL) {
+        KISS_FFT_ERROR("Memory allocation error.");
+        return;
+    }
+    /*perform the parallel fft of two real signals packed in real,imag*/
+    kiss_fft( st->substate , (const kiss_fft_cpx*)timedata, tmpbuf );
+    kf_fftr_split(st,tmpbuf,freqdata);
+    KF_SCRATCH_PUT(&st->tmpbusy,st->tmpbuf,tmpbuf);
+}
+
+/* the inverse of kf_fftr_split: the packed complex spectrum whose transform is timedata */
+static void kf_fftri_merge(kiss_fftr_cfg st,const kiss_fft_cpx *freqdata,kiss_fft_cpx *tmpbuf)
+{
+    int k;
+    const int ncfft = st->substate->nfft;
 
-    st->tmpbuf[0].r = freqdata[0].r + freqdata[ncfft].r;
-    st->tmpbuf[0].i = freqdata[0].r - freqdata[ncfft].r;
-    C_FIXDIV(st->tmpbuf[0],2);
+    tmpbuf[0].r = freqdata[0].r + freqdata[ncfft].r;
+    tmpbuf[0].i = freqdata[0].r - freqdata[ncfft].r;
+    C_FIXDIV(tmpbuf[0],2);
 
     for (k = 1; k <= ncfft / 2; ++k) {
         kiss_fft_cpx fk, fnkc, fek, fok, tmp;
@@ -143,13 +168,133 @@ void kiss_fftri(kiss_fftr_cfg st,const kiss_fft_cpx *freqdata,kiss_fft_scalar *t
         C_ADD (fek, fk, fnkc);
         C_SUB (tmp, fk, fnkc);
         C_MUL (fok, tmp, st->super_twiddles[k-1]);
-        C_ADD (st->tmpbuf[k],     fek, fok);
-        C_SUB (st->tmpbuf[ncfft - k], fek, fok);
+        C_ADD (tmpbuf[k],     fek, fok);
+        C_SUB (tmpbuf[ncfft - k], fek, fok);
 #ifdef USE_SIMD
-        st->tmpbuf[ncfft - k].i *= _mm_set1_ps(-1.0);
+        tmpbuf[ncfft - k].i *= _mm_set1_ps(-1.0);
 #else
-        st->tmpbuf[ncfft - k].i *= -1;
+        tmpbuf[ncfft - k].i *= -1;
 #endif
     }
-    kiss_fft (st->substate, st->tmpbuf, (kiss_fft_cpx *) timedata);
+}
+
+void kiss_fftri(kiss_fftr_cfg st,const kiss_fft_cpx *freqdata,kiss_fft_scalar *timedata)
+{
+    kiss_fft_cpx * tmpbuf;
+    /* input buffer timedata is stored row-wise */
+    if (st->substate->inverse == 0) {
+        KISS_FFT_ERROR("kiss fft usage error: improper alloc");
+        return;/* The caller did not call the correct function */
+    }
+
+    tmpbuf = KF_SCRATCH(&st->tmpbusy,st->tmpbuf,st->substate->nfft);
+    if (tmpbuf == NULL) {
+        KISS_FFT_ERROR("Memory allocation error.");
+        return;
+    }
+    kf_fftri_merge(st,freqdata,tmpbuf);
+    kiss_fft (st->substate, tmpbuf, (kiss_fft_cpx *) timedata);
+    KF_SCRATCH_PUT(&st->tmpbusy,st->tmpbuf,tmpbuf);
+}
+
+/*
+ * Batches: KISS_FFT_BATCH transforms at a time go through kiss_fft_batch, with the split/merge
+ * done per transform in the caller's buffers: the split only ever reads the two bins it writes,
+ * so it runs in place on freqdata, and the merge writes the packed complex view of timedata,
+ * which the run then transforms in place. That view needs even distances.
+ */
+struct kf_fftr_task
+{
+    kiss_fftr_cfg st;
+    int howmany;
+    const kiss_fft_scalar * tin;  /* forward */
+    kiss_fft_scalar * tout;       /* inverse */
+    const kiss_fft_cpx * fin;
+    kiss_fft_cpx * fout;
+    size_t in_dist, out_dist;
+};
+
+static void kf_fftr_run(void * arg,int j)
+{
+    const struct kf_fftr_task * t = (const struct kf_fftr_task*)arg;
+    const int nb = KISS_FFT_BATCH;
+    const size_t first = (size_t)j*nb;
+    const int cnt = t->howmany - j*nb < nb ? t->howmany - j*nb : nb;
+    int k;
+
+    if (t->tin) {
+        kiss_fft_cpx * fout = t->fout + first*t->out_dist;
+        kiss_fft_batch(t->st->substate, cnt, (const kiss_fft_cpx*)(t->tin + first*t->in_dist), 1,
+                (int)t->in_dist/2, fout, (int)t->out_dist);
+        for (k = 0; k < cnt; ++k)
+            kf_fftr_split(t->st, fout + (size_t)k*t->out_dist, fout + (size_t)k*t->out_dist);
+    }else{
+        kiss_fft_cpx * tout = (kiss_fft_cpx*)(t->tout + first*t->out_dist);
+        for (k = 0; k < cnt; ++k)
+            kf_fftri_merge(t->st, t->fin + (first + k)*t->in_dist, tout + (size_t)k*(t->out_dist/2));
+        kiss_fft_batch(t->st->substate, cnt, tout, 1, (int)t->out_dist/2, tout, (int)t->out_dist/2);
+    }
+}
+
+/* the runs of KISS_FFT_BATCH, in parallel past the thread crossover */
+static void kf_fftr_runs(struct kf_fftr_task * t)
+{
+    const int nb = KISS_FFT_BATCH;
+    const int runs = (t->howmany + nb - 1) / nb;
+    int j;
+
+    if (t->howmany <= 0)
+        return;
+    if (kf_plan_threads((size_t)t->howmany*t->st->substate->nfft) > 1) {
+        kf_parallel_for(runs, kf_fftr_run, t);
+        return;
+    }
+    for (j = 0; j < runs; ++j)
+        kf_fftr_run(t, j);
+}
+
+void kiss_fftr_batch(kiss_fftr_cfg st,int howmany,const kiss_fft_scalar *timedata,int in_dist,
+        kiss_fft_cpx *freqdata,int out_dist)
+{
+    struct kf_fftr_task t;
+
+    if ( st->substate->inverse) {
+        KISS_FFT_ERROR("kiss fft usage error: improper alloc");
+        return;/* The caller did not call the correct function */
+    }
+    if (in_dist & 1) {
+        KISS_FFT_ERROR("kiss_fftr_batch: in_dist must be even.");
+        return;
+    }
+    memset(&t, 0, sizeof(t));
+    t.st = st;
+    t.howmany = howmany;
+    t.tin = timedata;
+    t.fout = freqdata;
+    t.in_dist = (size_t)in_dist;
+    t.out_dist = (size_t)out_dist;
+    kf_fftr_runs(&t);
+}
+
+void kiss_fftri_batch(kiss_fftr_cfg st,int howmany,const kiss_fft_cpx *freqdata,int in_dist,
+        kiss_fft_scalar *timedata,int out_dist)
+{
+    struct kf_fftr_task t;
+
+    if (st->substate->inverse == 0) {
+        KISS_FFT_ERROR("kiss fft usage error: improper alloc");
+        return;/* The caller did not call the correct function */
+    }
+    if (out_dist & 1) {
+        KISS_FFT_ERROR("kiss_fftri_batch: out_dist must be even.");
+        return;
+    }
+    memset(&t, 0, sizeof(t));
+    t.st = st;
+    t.howmany = howmany;
+    t.fin = freqdata;
+    t.tout = timedata;
+    t.in_dist = (size_t)in_dist;
+    t.out_dist = (size_t)out_dist;
+    kf_fftr_runs(&t);
 }
@@ -33,6 +33,12 @@ kiss_fftr_cfg KISS_FFT_API kiss_fftr_alloc(int nfft,int inverse_fft,void * mem,
  If you don't care to allocate space, use mem = lenmem = NULL 
 */
 
+kiss_fftr_cfg KISS_FFT_API kiss_fftr_alloc_engine(int nfft,int inverse_fft,int engine,void * mem, size_t * lenmem);
+/*
+ As kiss_fftr_alloc, with the engine of the complex half-length transform as in kiss_fft_alloc_engine.
+ KISS_FFT_ENGINE_AUTO gives plans that kiss_fftr_batch can interleave (see kiss_fft_batch).
+*/
+
 
 void KISS_FFT_API kiss_fftr(kiss_fftr_cfg cfg,const kiss_fft_scalar *timedata,kiss_fft_cpx *freqdata);
 /*
@@ -46,6 +52,20 @@ void KISS_FFT_API kiss_fftri(kiss_fftr_cfg cfg,const kiss_fft_cpx *freqdata,kiss
  output timedata has nfft scalar points
 */
 
+void KISS_FFT_API kiss_fftr_batch(kiss_fftr_cfg cfg,int howmany,const kiss_fft_scalar *timedata,int in_dist,
+        kiss_fft_cpx *freqdata,int out_dist);
+/*
+ howmany forward transforms, the j-th from timedata + j*in_dist (in_dist even) to freqdata + j*out_dist.
+ Runs through kiss_fft_batch; the buffers must not overlap.
+*/
+
+void KISS_FFT_API kiss_fftri_batch(kiss_fftr_cfg cfg,int howmany,const kiss_fft_cpx *freqdata,int in_dist,
+        kiss_fft_scalar *timedata,int out_dist);
+/*
+ howmany inverse transforms, the j-th from freqdata + j*in_dist to timedata + j*out_dist (out_dist even).
+ The buffers must not overlap.
+*/
+
 #define kiss_fftr_free KISS_FFT_FREE
 
 #ifdef __cplusplus
@@ -358,4 +358,368 @@ class kissfft
         std::vector<std::size_t> _stageRemainder;
         mutable std::vector<cpx_t> _scratchbuf;
 };
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#include <array>
+
+namespace kissfft_fixed_detail
+{
+    template <typename scalar_t>
+    struct twiddle_t { scalar_t re, im; };
+
+    constexpr long double pi = 3.141592653589793238462643383279502884L;
+
+    // std::sin and std::cos are not constexpr; these only see |x| <= pi/2
+    constexpr long double sin_series(const long double x)
+    {
+        long double term = x, sum = x;
+        for (int k=1;k<=14;++k) {
+            term *= -x*x / ((2*k)*(2*k+1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    constexpr long double cos_series(const long double x)
+    {
+        long double term = 1, sum = 1;
+        for (int k=1;k<=14;++k) {
+            term *= -x*x / ((2*k-1)*(2*k));
+            sum += term;
+        }
+        return sum;
+    }
+
+    /* exp(-+2*pi*i*j/n); the quadrant is taken out in integers so the series stays accurate */
+    template <typename scalar_t>
+    constexpr twiddle_t<scalar_t> twiddle(std::size_t j, const std::size_t n, const bool inverse)
+    {
+        j %= n;
+        const std::size_t quadrant = 4*j / n;
+        const long double x = pi/2 * (long double)(4*j - quadrant*n) / n;
+        const long double c = cos_series(x), s = sin_series(x);
+        long double re = c, im = s;
+        switch (quadrant) {
+            case 1: re = -s; im = c; break;
+            case 2: re = -c; im = -s; break;
+            case 3: re = s; im = -c; break;
+        }
+        return { (scalar_t)re, (scalar_t)(inverse ? im : -im) };
+    }
+
+    struct plan_t
+    {
+        std::size_t stages = 0;
+        std::array<std::size_t,64> radix {};
+        std::array<std::size_t,64> remainder {};
+        std::array<std::size_t,64> twoffset {}; // where each stage's twiddles start in the packed table
+        std::size_t twsize = 0;
+        bool generic = false;                   // some radix above 5 needs the full table
+    };
+
+    /* the same factorisation as kissfft's constructor: 4's, then 2's, then 3,5,7,9,... */
+    constexpr plan_t factor(const std::size_t nfft)
+    {
+        plan_t plan;
+        std::size_t n = nfft;
+        std::size_t p = 4;
+        do {
+            while (n % p) {
+                switch (p) {
+                    case 4: p = 2; break;
+                    case 2: p = 3; break;
+                    default: p += 2; break;
+                }
+                if (p*p>n)
+                    p = n;// no more factors
+            }
+            n /= p;
+            plan.radix[plan.stages] = p;
+            plan.remainder[plan.stages] = n;
+            plan.twoffset[plan.stages] = plan.twsize;
+            if (p <= 5)
+                plan.twsize += (p-1)*n;
+            else
+                plan.generic = true;
+            ++plan.stages;
+        }while(n>1);
+        return plan;
+    }
+
+    /* for a radix-p stage over m at stride fstride: entry (q-1)*m+k is twiddle q*k*fstride */
+    template <typename scalar_t, std::size_t nfft, bool inverse>
+    constexpr auto stage_twiddles()
+    {
+        constexpr plan_t plan = factor(nfft);
+        std::array<twiddle_t<scalar_t>, plan.twsize ? plan.twsize : 1> tw {};
+        for (std::size_t s=0;s<plan.stages;++s) {
+            const std::size_t p = plan.radix[s];
+            const std::size_t m = plan.remainder[s];
+            const std::size_t fstride = nfft / (p*m);
+            if (p > 5)
+                continue;
+            for (std::size_t q=1;q<p;++q)
+                for (std::size_t k=0;k<m;++k)
+                    tw[plan.twoffset[s] + (q-1)*m + k] = twiddle<scalar_t>(q*k*fstride,nfft,inverse);
+        }
+        return tw;
+    }
+
+    /* the whole table, for the generic butterfly */
+    template <typename scalar_t, std::size_t nfft, bool inverse>
+    constexpr auto full_twiddles()
+    {
+        constexpr plan_t plan = factor(nfft);
+        std::array<twiddle_t<scalar_t>, plan.generic ? nfft : 1> tw {};
+        for (std::size_t i=0;plan.generic && i<nfft;++i)
+            tw[i] = twiddle<scalar_t>(i,nfft,inverse);
+        return tw;
+    }
+
+    /* exp(-+i*pi*k/nfft), the twiddles of transform_real's post processing */
+    template <typename scalar_t, std::size_t nfft, bool inverse>
+    constexpr auto real_twiddles()
+    {
+        std::array<twiddle_t<scalar_t>, nfft/2+1> tw {};
+        for (std::size_t k=0;k<=nfft/2;++k)
+            tw[k] = twiddle<scalar_t>(k,2*nfft,inverse);
+        return tw;
+    }
+}
+
+/// A @c kissfft whose size is a template argument.
+///
+/// The factorisation, the twiddle factors and the order of the stages are all
+/// worked out by the compiler: the stages are unrolled into one function per
+/// stage with the radix, the stride and the length as constants, and the
+/// twiddles live in @c std::array tables in static storage, packed per stage
+/// in the order the butterflies read them. Nothing is allocated, an object
+/// has no state, and @c transform() and @c transform_real() give the same
+/// results as @c kissfft<scalar_t> built with @c nfft and @c inverse.
+///
+/// kissfft_fixed<float,1024>, <float,2048> and <float,4096> are the sizes
+/// the decoder runs; testcpp checks them and times them against kissfft.
+/// Needs C++17.
+template <typename scalar_t, std::size_t nfft, bool inverse = false>
+class kissfft_fixed
+{
+    public:
+
+        typedef std::complex<scalar_t> cpx_t;
+
+        static_assert(nfft > 0, "kissfft_fixed needs at least one point");
+
+        static constexpr std::size_t size() { return nfft; }
+        static constexpr std::size_t stages() { return _plan.stages; }
+
+        /// Same as kissfft::transform(); @c fft_in and @c fft_out must not overlap.
+        void transform(const cpx_t * fft_in, cpx_t * fft_out, const std::size_t in_stride = 1) const
+        {
+            work<0,1>(fft_out,fft_in,in_stride);
+        }
+
+        /// Same as kissfft::transform_real(): the DFT of @c 2*nfft real values,
+        /// packed into @c nfft complex ones.
+        void transform_real( const scalar_t * const src,
+                             cpx_t * const dst ) const
+        {
+            const std::size_t N = nfft;
+
+            transform( reinterpret_cast<const cpx_t*>(src), dst );
+
+            dst[0] = cpx_t( dst[0].real() + dst[0].imag(),
+                               dst[0].real() - dst[0].imag() );
+
+            for ( std::size_t k = 1; 2*k < N; ++k )
+            {
+                const cpx_t w = (scalar_t)0.5 * cpx_t(
+                     dst[k].real() + dst[N-k].real(),
+                     dst[k].imag() - dst[N-k].imag() );
+                const cpx_t z = (scalar_t)0.5 * cpx_t(
+                     dst[k].imag() + dst[N-k].imag(),
+                    -dst[k].real() + dst[N-k].real() );
+                const cpx_t tz = mul( z, _realtw[k] );
+                dst[  k] =       w + tz;
+                dst[N-k] = std::conj( w - tz );
+            }
+            if ( N % 2 == 0 )
+                dst[N/2] = std::conj( dst[N/2] );
+        }
+
+    private:
+
+        typedef kissfft_fixed_detail::twiddle_t<scalar_t> twiddle_t;
+
+        static constexpr kissfft_fixed_detail::plan_t _plan = kissfft_fixed_detail::factor(nfft);
+
+        static constexpr auto _stagetw = kissfft_fixed_detail::stage_twiddles<scalar_t,nfft,inverse>();
+        static constexpr auto _fulltw = kissfft_fixed_detail::full_twiddles<scalar_t,nfft,inverse>();
+        static constexpr auto _realtw = kissfft_fixed_detail::real_twiddles<scalar_t,nfft,inverse>();
+
+        /* spelled out: std::complex's operator* checks for infinities and NaNs */
+        static cpx_t mul(const cpx_t & a, const twiddle_t & w)
+        {
+            return cpx_t( a.real()*w.re - a.imag()*w.im,
+                          a.real()*w.im + a.imag()*w.re );
+        }
+
+        template <std::size_t stage, std::size_t fstride>
+        static void work(cpx_t * fft_out, const cpx_t * fft_in, const std::size_t in_stride)
+        {
+            constexpr std::size_t p = _plan.radix[stage];
+            constexpr std::size_t m = _plan.remainder[stage];
+
+            if constexpr (m == 1) {
+                for (std::size_t q=0;q<p;++q)
+                    fft_out[q] = fft_in[q*fstride*in_stride];
+            } else {
+                for (std::size_t q=0;q<p;++q)
+                    work<stage+1,fstride*p>(fft_out + q*m, fft_in + q*fstride*in_stride, in_stride);
+            }
+
+            // recombine the p smaller DFTs
+            if constexpr (p == 2) kf_bfly2<m>(fft_out, &_stagetw[_plan.twoffset[stage]]);
+            else if constexpr (p == 3) kf_bfly3<m>(fft_out, &_stagetw[_plan.twoffset[stage]]);
+            else if constexpr (p == 4) kf_bfly4<m>(fft_out, &_stagetw[_plan.twoffset[stage]]);
+            else if constexpr (p == 5) kf_bfly5<m>(fft_out, &_stagetw[_plan.twoffset[stage]]);
+            else kf_bfly_generic<p,m,fstride>(fft_out);
+        }
+
+        template <std::size_t m>
+        static void kf_bfly2(cpx_t * const Fout, const twiddle_t * const tw)
+        {
+            for (std::size_t k=0;k<m;++k) {
+                const cpx_t t = mul(Fout[m+k], tw[k]);
+                Fout[m+k] = Fout[k] - t;
+                Fout[k] += t;
+            }
+        }
+
+        template <std::size_t m>
+        static void kf_bfly3(cpx_t * const Fout, const twiddle_t * const tw)
+        {
+            constexpr scalar_t epi3 = kissfft_fixed_detail::twiddle<scalar_t>(1,3,inverse).im;
+            cpx_t scratch[4];
+
+            for (std::size_t k=0;k<m;++k) {
+                scratch[1] = mul(Fout[k+m],   tw[k]);
+                scratch[2] = mul(Fout[k+2*m], tw[m+k]);
+
+                scratch[3] = scratch[1] + scratch[2];
+                scratch[0] = (scratch[1] - scratch[2]) * epi3;
+
+                Fout[k+m] = Fout[k] - scratch[3]*scalar_t(0.5);
+                Fout[k] += scratch[3];
+
+                Fout[k+2*m] = cpx_t( Fout[k+m].real() + scratch[0].imag() , Fout[k+m].imag() - scratch[0].real() );
+                Fout[k+m] += cpx_t( -scratch[0].imag(),scratch[0].real() );
+            }
+        }
+
+        template <std::size_t m>
+        static void kf_bfly4(cpx_t * const Fout, const twiddle_t * const tw)
+        {
+            constexpr scalar_t negative_if_inverse = inverse ? -1 : +1;
+            cpx_t scratch[6];
+
+            for (std::size_t k=0;k<m;++k) {
+                scratch[0] = mul(Fout[k+  m], tw[k]);
+                scratch[1] = mul(Fout[k+2*m], tw[m+k]);
+                scratch[2] = mul(Fout[k+3*m], tw[2*m+k]);
+                scratch[5] = Fout[k] - scratch[1];
+
+                Fout[k] += scratch[1];
+                scratch[3] = scratch[0] + scratch[2];
+                scratch[4] = scratch[0] - scratch[2];
+                scratch[4] = cpx_t( scratch[4].imag()*negative_if_inverse ,
+                                      -scratch[4].real()*negative_if_inverse );
+
+                Fout[k+2*m]  = Fout[k] - scratch[3];
+                Fout[k    ]+= scratch[3];
+                Fout[k+  m] = scratch[5] + scratch[4];
+                Fout[k+3*m] = scratch[5] - scratch[4];
+            }
+        }
+
+        template <std::size_t m>
+        static void kf_bfly5(cpx_t * const Fout, const twiddle_t * const tw)
+        {
+            constexpr twiddle_t ya = kissfft_fixed_detail::twiddle<scalar_t>(1,5,inverse);
+            constexpr twiddle_t yb = kissfft_fixed_detail::twiddle<scalar_t>(2,5,inverse);
+            cpx_t scratch[13];
+
+            for (std::size_t u=0;u<m;++u) {
+                scratch[0] = Fout[u];
+
+                scratch[1] = mul(Fout[u+  m], tw[u]);
+                scratch[2] = mul(Fout[u+2*m], tw[m+u]);
+                scratch[3] = mul(Fout[u+3*m], tw[2*m+u]);
+                scratch[4] = mul(Fout[u+4*m], tw[3*m+u]);
+
+                scratch[7] = scratch[1] + scratch[4];
+                scratch[10]= scratch[1] - scratch[4];
+                scratch[8] = scratch[2] + scratch[3];
+                scratch[9] = scratch[2] - scratch[3];
+
+                Fout[u] += scratch[7];
+                Fout[u] += scratch[8];
+
+                scratch[5] = scratch[0] + cpx_t(
+                        scratch[7].real()*ya.re + scratch[8].real()*yb.re,
+                        scratch[7].imag()*ya.re + scratch[8].imag()*yb.re
+                        );
+
+                scratch[6] =  cpx_t(
+                         scratch[10].imag()*ya.im + scratch[9].imag()*yb.im,
+                        -scratch[10].real()*ya.im - scratch[9].real()*yb.im
+                        );
+
+                Fout[u+  m] = scratch[5] - scratch[6];
+                Fout[u+4*m] = scratch[5] + scratch[6];
+
+                scratch[11] = scratch[0] +
+                    cpx_t(
+                            scratch[7].real()*yb.re + scratch[8].real()*ya.re,
+                            scratch[7].imag()*yb.re + scratch[8].imag()*ya.re
+                            );
+
+                scratch[12] = cpx_t(
+                        -scratch[10].imag()*yb.im + scratch[9].imag()*ya.im,
+                         scratch[10].real()*yb.im - scratch[9].real()*ya.im
+                        );
+
+                Fout[u+2*m] = scratch[11] + scratch[12];
+                Fout[u+3*m] = scratch[11] - scratch[12];
+            }
+        }
+
+        template <std::size_t p, std::size_t m, std::size_t fstride>
+        static void kf_bfly_generic(cpx_t * const Fout)
+        {
+            std::array<cpx_t,p> scratch;
+
+            for ( std::size_t u=0; u<m; ++u ) {
+                std::size_t k = u;
+                for ( std::size_t q1=0 ; q1<p ; ++q1 ) {
+                    scratch[q1] = Fout[ k  ];
+                    k += m;
+                }
+
+                k=u;
+                for ( std::size_t q1=0 ; q1<p ; ++q1 ) {
+                    std::size_t twidx=0;
+                    Fout[ k ] = scratch[0];
+                    for ( std::size_t q=1;q<p;++q ) {
+                        twidx += fstride * k;
+                        if (twidx>=nfft)
+                          twidx-=nfft;
+                        Fout[ k ] += mul(scratch[q], _fulltw[twidx]);
+                    }
+                    k += m;
+                }
+            }
+        }
+};
+#endif
+
 #endif
@@ -7,6 +7,9 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
 #include <sys/times.h>
 #include <unistd.h>
 #include "kiss_fft.h"
@@ -29,6 +32,223 @@ int getdims(int * dims, char * arg)
     return ndims;
 }
 
+/*
+   -m runs the benchmark matrix for this build instead of one size: complex and real, out of place and
+   in place, over powers of two from 64 to 65536 and mixed-radix sizes (-n picks one size instead, -q
+   only the sizes up to 4096). Each cell is timed -R times (default 10) over enough calls to take -t ms
+   (default 20) and reported as ns per call and GFLOPS (5 N log2 N flops per complex transform, half
+   that per real one), each with a 95% confidence interval on the mean. -f json (default) or csv picks
+   the output; test/benchmatrix.py merges the output of several builds and compares against a baseline.
+ */
+
+static const int matrix_sizes[] = {
+    64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536,
+    96, 240, 480, 1000, 1536, 3000, 6144, 12000, 30000, 48000
+};
+
+#define MATRIX_QUICK_MAX 4096
+#define MATRIX_MAX_SAMPLES 100
+
+/* two-sided 95% quantiles of Student's t, for 1 to 30 degrees of freedom */
+static const double t95[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+};
+
+typedef struct {
+    int nfft;
+    int real;
+    int inplace;
+    long calls;         /* per sample */
+    double ns, ns_lo, ns_hi;
+} bench_cell;
+
+static const char * datatype_name(void)
+{
+#if defined(USE_SIMD)
+    return "simd";
+#elif defined(FIXED_POINT) && (FIXED_POINT == 32)
+    return "int32_t";
+#elif defined(FIXED_POINT)
+    return "int16_t";
+#else
+    return sizeof(kiss_fft_scalar) == sizeof(double) ? "double" : "float";
+#endif
+}
+
+/* transforms per call: the SIMD build runs four side by side */
+static int datatype_lanes(void)
+{
+#ifdef USE_SIMD
+    return 4;
+#else
+    return 1;
+#endif
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC,&ts);
+    return ts.tv_sec*1e9 + ts.tv_nsec;
+}
+
+/* uniform in [-1/2,1/2) of full scale, so no kernel is timed on zeros */
+static void fill_random(kiss_fft_cpx * buf,size_t n)
+{
+#ifdef USE_SIMD
+    float * x = (float*)buf;
+    size_t k, count = n*2*4;
+#else
+    kiss_fft_scalar * x = (kiss_fft_scalar*)buf;
+    size_t k, count = n*2;
+#endif
+    for (k=0;k<count;++k) {
+        double d = rand()/((double)RAND_MAX+1) - 0.5;
+#if defined(FIXED_POINT) && (FIXED_POINT == 32)
+        x[k] = (kiss_fft_scalar)(d*2147483647.0);
+#elif defined(FIXED_POINT)
+        x[k] = (kiss_fft_scalar)(d*32767.0);
+#else
+        x[k] = d;
+#endif
+    }
+}
+
+static double time_calls(void * cfg,int real,kiss_fft_cpx * in,kiss_fft_cpx * out,long calls)
+{
+    double t0 = now_ns();
+    long i;
+    if (real)
+        for (i=0;i<calls;++i)
+            kiss_fftr( (kiss_fftr_cfg)cfg ,(kiss_fft_scalar*)in,out );
+    else
+        for (i=0;i<calls;++i)
+            kiss_fft( (kiss_fft_cfg)cfg ,in,out );
+    return now_ns() - t0;
+}
+
+static void bench_cell_run(bench_cell * c,int samples,double sample_ns)
+{
+    /* nfft complex values hold both a complex input and a real input with its nfft/2+1 outputs */
+    size_t nbytes = sizeof(kiss_fft_cpx)*(c->nfft+1);
+    kiss_fft_cpx * src = (kiss_fft_cpx*)KISS_FFT_MALLOC(nbytes);
+    kiss_fft_cpx * in = (kiss_fft_cpx*)KISS_FFT_MALLOC(nbytes);
+    kiss_fft_cpx * out = c->inplace ? in : (kiss_fft_cpx*)KISS_FFT_MALLOC(nbytes);
+    void * cfg = c->real ? (void*)kiss_fftr_alloc(c->nfft,0,0,0) : (void*)kiss_fft_alloc(c->nfft,0,0,0);
+    double x[MATRIX_MAX_SAMPLES];
+    double sum = 0, var = 0, half, fastest;
+    int s;
+
+    fill_random(src,c->nfft+1);
+    memcpy(in,src,nbytes);
+    if (out != in)
+        memset(out,0,nbytes);
+
+    /* double the calls until one sample takes long enough; that also warms the caches */
+    c->calls = 1;
+    while (time_calls(cfg,c->real,in,out,c->calls) < sample_ns && c->calls < (1L<<30)) {
+        c->calls *= 2;
+        memcpy(in,src,nbytes);
+    }
+
+    /* in place, each call transforms the last one's output, so every sample starts again from the
+       same random input */
+    for (s=0;s<samples;++s) {
+        memcpy(in,src,nbytes);
+        x[s] = time_calls(cfg,c->real,in,out,c->calls) / c->calls;
+        sum += x[s];
+        if (s == 0 || x[s] < fastest)
+            fastest = x[s];
+    }
+    c->ns = sum / samples;
+    for (s=0;s<samples;++s)
+        var += (x[s]-c->ns)*(x[s]-c->ns);
+    half = samples > 1 ? t95[(samples-2 < 29 ? samples-2 : 29)] * sqrt(var/(samples-1)/samples) : 0;
+    /* a few noisy samples can put the interval below zero; nothing runs faster than the fastest call seen */
+    c->ns_lo = c->ns - half > fastest ? c->ns - half : fastest;
+    c->ns_hi = c->ns + half;
+
+    free(cfg);
+    KISS_FFT_FREE(src);
+    KISS_FFT_FREE(in);
+    if (out != in)
+        KISS_FFT_FREE(out);
+}
+
+/* what kiss_fft_alloc runs when KISSFFT_ENGINE is not set: the int16 build lets it choose */
+#if defined(FIXED_POINT) && (FIXED_POINT != 32)
+#define DEFAULT_ENGINE "auto"
+#else
+#define DEFAULT_ENGINE "recursive"
+#endif
+
+static double cell_flops(const bench_cell * c)
+{
+    return (c->real ? 2.5 : 5.0) * c->nfft * log2((double)c->nfft) * datatype_lanes();
+}
+
+static int run_matrix(int nfft,int quick,int samples,double sample_ms,int csv)
+{
+    const char * simd = getenv("KISSFFT_SIMD") ? getenv("KISSFFT_SIMD") : "auto";
+    const char * engine = getenv("KISSFFT_ENGINE") ? getenv("KISSFFT_ENGINE") : DEFAULT_ENGINE;
+    int nsizes = nfft ? 1 : (int)(sizeof(matrix_sizes)/sizeof(matrix_sizes[0]));
+    int first = 1;
+    int k,real,inplace;
+
+    if (samples < 2 || samples > MATRIX_MAX_SAMPLES) {
+        fprintf(stderr,"-R must be from 2 to %d\n",MATRIX_MAX_SAMPLES);
+        return 1;
+    }
+
+    if (csv)
+        printf("datatype,lanes,simd,engine,nfft,kind,placement,ns,ns_ci_lo,ns_ci_hi,gflops,gflops_ci_lo,gflops_ci_hi,samples,calls\n");
+    else
+        printf("{\n  \"datatype\": \"%s\",\n  \"lanes\": %d,\n  \"simd\": \"%s\",\n  \"engine\": \"%s\",\n  \"results\": [",
+                datatype_name(),datatype_lanes(),simd,engine);
+
+    for (k=0;k<nsizes;++k) {
+        int n = nfft ? nfft : matrix_sizes[k];
+        if (quick && n > MATRIX_QUICK_MAX)
+            continue;
+        for (real=0;real<2;++real) {
+            if (real && (n & 1))
+                continue;
+            for (inplace=0;inplace<2;++inplace) {
+                bench_cell c;
+                double flops;
+                const char * kind = real ? "real" : "complex";
+                const char * placement = inplace ? "in-place" : "out-of-place";
+
+                c.nfft = n;
+                c.real = real;
+                c.inplace = inplace;
+                bench_cell_run(&c,samples,sample_ms*1e6);
+                flops = cell_flops(&c);
+
+                if (csv)
+                    printf("%s,%d,%s,%s,%d,%s,%s,%.2f,%.2f,%.2f,%.4f,%.4f,%.4f,%d,%ld\n",
+                            datatype_name(),datatype_lanes(),simd,engine,n,kind,placement,
+                            c.ns,c.ns_lo,c.ns_hi,flops/c.ns,flops/c.ns_hi,flops/c.ns_lo,samples,c.calls);
+                else
+                    printf("%s\n    {\"nfft\": %d, \"kind\": \"%s\", \"placement\": \"%s\", "
+                            "\"ns\": %.2f, \"ns_ci95\": [%.2f, %.2f], "
+                            "\"gflops\": %.4f, \"gflops_ci95\": [%.4f, %.4f], \"samples\": %d, \"calls\": %ld}",
+                            first ? "" : ",",n,kind,placement,
+                            c.ns,c.ns_lo,c.ns_hi,flops/c.ns,flops/c.ns_hi,flops/c.ns_lo,samples,c.calls);
+                first = 0;
+                fflush(stdout);
+            }
+        }
+    }
+    if (!csv)
+        printf("\n  ]\n}\n");
+
+    kiss_fft_cleanup();
+    return 0;
+}
+
 int main(int argc,char ** argv)
 {
     int k;
@@ -39,18 +259,40 @@ int main(int argc,char ** argv)
     kiss_fft_cpx * buf;
     kiss_fft_cpx * bufout;
     int real = 0;
+    int matrix = 0, quick = 0, csv = 0, samples = 10, sized = 0;
+    double sample_ms = 20;
 
     nfft[0] = 1024;// default
 
     while (1) {
-        int c = getopt (argc, argv, "n:ix:r");
+        int c = getopt (argc, argv, "n:ix:rmqf:R:t:");
         if (c == -1)
             break;
         switch (c) {
             case 'r':
                 real = 1;
                 break;
+            case 'm':
+                matrix = 1;
+                break;
+            case 'q':
+                quick = 1;
+                break;
+            case 'f':
+                if (strcmp(optarg,"csv") != 0 && strcmp(optarg,"json") != 0) {
+                    fprintf(stderr,"-f must be json or csv, not %s\n",optarg);
+                    return 1;
+                }
+                csv = strcmp(optarg,"csv") == 0;
+                break;
+            case 'R':
+                samples = atoi(optarg);
+                break;
+            case 't':
+                sample_ms = atof(optarg);
+                break;
             case 'n':
+                sized = 1;
                 ndims = getdims(nfft, optarg );
                 if (nfft[0] != kiss_fft_next_fast_size(nfft[0]) ) {
                     int ng = kiss_fft_next_fast_size(nfft[0]);
@@ -65,6 +307,9 @@ int main(int argc,char ** argv)
                 break;
         }
     }
+    if (matrix)
+        return run_matrix(sized && ndims == 1 ? nfft[0] : 0,quick,samples,sample_ms,csv);
+
     int nbytes = sizeof(kiss_fft_cpx);
     for (k=0;k<ndims;++k)
         nbytes *= nfft[k];
@@ -119,7 +364,9 @@ int main(int argc,char ** argv)
     fprintf(stderr,"KISS\tnfft=");
     for (k=0;k<ndims;++k)
         fprintf(stderr, "%d,",nfft[k]);
-    fprintf(stderr,"\tnumffts=%d\n" ,numffts);
+    fprintf(stderr,"\tnumffts=%d" ,numffts);
+    fprintf(stderr,"\tKISSFFT_SIMD=%s" ,getenv("KISSFFT_SIMD") ? getenv("KISSFFT_SIMD") : "auto");
+    fprintf(stderr,"\tKISSFFT_ENGINE=%s\n" ,getenv("KISSFFT_ENGINE") ? getenv("KISSFFT_ENGINE") : DEFAULT_ENGINE);
     pstats_report();
 
     kiss_fft_cleanup();
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+#  Copyright (c) 2003-2019, Mark Borgerding. All rights reserved.
+#  This file is part of KISS FFT - https://github.com/mborgerding/kissfft
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#  See COPYING file for more information.
+"""Runs the benchmark matrix (bm_kiss -m) of one or more kissfft builds and merges the results.
+
+    benchmatrix.py [options] bm_kiss-float bm_kiss-double bm_kiss-int16_t ...
+
+Each build runs once as it is and once more per --variant, a comma separated list of environment
+settings such as KISSFFT_ENGINE=stockham or KISSFFT_SIMD=scalar. The merged rows go out as JSON or
+CSV. With --baseline (an earlier output of this script, either format) every row is compared with
+the same row there: it is slower or faster only when the change is over --tolerance percent and
+the two 95% confidence intervals do not overlap. Any slower row makes the exit code 1.
+"""
+from __future__ import absolute_import, division, print_function
+import argparse
+import csv
+import io
+import json
+import os
+import subprocess
+import sys
+
+KEY = ('datatype', 'simd', 'engine', 'nfft', 'kind', 'placement')
+CSV_FIELDS = ('datatype', 'lanes', 'simd', 'engine', 'nfft', 'kind', 'placement', 'ns', 'ns_ci_lo', 'ns_ci_hi',
+              'gflops', 'gflops_ci_lo', 'gflops_ci_hi', 'samples', 'calls')
+
+
+def run_build(exe, variant, args):
+    env = dict(os.environ)
+    for setting in filter(None, variant.split(',')):
+        name, _, value = setting.partition('=')
+        env[name] = value
+    cmd = [exe, '-m', '-f', 'json', '-R', str(args.samples), '-t', str(args.ms)]
+    if args.quick:
+        cmd.append('-q')
+    if args.nfft:
+        cmd += ['-n', str(args.nfft)]
+    sys.stderr.write('running %s %s\n' % (' '.join(cmd), variant))
+    run = json.loads(subprocess.check_output(cmd, env=env).decode())
+    rows = []
+    for r in run['results']:
+        row = dict((k, run[k]) for k in ('datatype', 'lanes', 'simd', 'engine'))
+        row.update(nfft=r['nfft'], kind=r['kind'], placement=r['placement'], ns=r['ns'],
+                   ns_ci_lo=r['ns_ci95'][0], ns_ci_hi=r['ns_ci95'][1], gflops=r['gflops'],
+                   gflops_ci_lo=r['gflops_ci95'][0], gflops_ci_hi=r['gflops_ci95'][1],
+                   samples=r['samples'], calls=r['calls'])
+        rows.append(row)
+    return rows
+
+
+def write_rows(rows, fmt, out):
+    if fmt == 'csv':
+        w = csv.DictWriter(out, fieldnames=CSV_FIELDS, lineterminator='\n')
+        w.writeheader()
+        w.writerows(rows)
+    else:
+        json.dump({'results': rows}, out, indent=1)
+        out.write('\n')
+
+
+def read_rows(path):
+    with io.open(path) as f:
+        text = f.read()
+    if text.lstrip().startswith('{'):
+        return json.loads(text)['results']
+    rows = list(csv.DictReader(io.StringIO(text)))
+    for row in rows:
+        for k in ('lanes', 'nfft', 'samples', 'calls'):
+            row[k] = int(row[k])
+        for k in ('ns', 'ns_ci_lo', 'ns_ci_hi', 'gflops', 'gflops_ci_lo', 'gflops_ci_hi'):
+            row[k] = float(row[k])
+    return rows
+
+
+def compare(rows, baseline, tolerance):
+    base = dict((tuple(r[k] for k in KEY), r) for r in baseline)
+    slower = 0
+    print('%-8s %-9s %-9s %6s %-7s %-12s %11s %11s %8s' %
+          ('datatype', 'simd', 'engine', 'nfft', 'kind', 'placement', 'base ns', 'ns', 'change'))
+    for r in rows:
+        b = base.get(tuple(r[k] for k in KEY))
+        if b is None:
+            continue
+        change = 100.0 * (r['ns'] / b['ns'] - 1)
+        verdict = ''
+        if change > tolerance and r['ns_ci_lo'] > b['ns_ci_hi']:
+            verdict = 'SLOWER'
+            slower += 1
+        elif change < -tolerance and r['ns_ci_hi'] < b['ns_ci_lo']:
+            verdict = 'faster'
+        print('%-8s %-9s %-9s %6d %-7s %-12s %11.1f %11.1f %+7.1f%% %s' %
+              (r['datatype'], r['simd'], r['engine'], r['nfft'], r['kind'], r['placement'], b['ns'], r['ns'],
+               change, verdict))
+    print('%d row(s) slower than the baseline by more than %g%%' % (slower, tolerance))
+    return slower
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    p.add_argument('builds', nargs='+', help='bm_kiss executables, one per build')
+    p.add_argument('--variant', action='append', default=[], help='extra run with these VAR=VALUE,... settings')
+    p.add_argument('--quick', action='store_true', help='only sizes up to 4096')
+    p.add_argument('--nfft', type=int, help='one size instead of the matrix')
+    p.add_argument('--samples', type=int, default=10, help='timed samples per cell (default 10)')
+    p.add_argument('--ms', type=float, default=20, help='milliseconds per sample (default 20)')
+    p.add_argument('--format', choices=('json', 'csv'), default='json')
+    p.add_argument('--out', help='write the results here instead of stdout')
+    p.add_argument('--baseline', help='earlier results to compare against')
+    p.add_argument('--tolerance', type=float, default=5, help='percent change that counts (default 5)')
+    args = p.parse_args()
+
+    rows = []
+    for exe in args.builds:
+        for variant in [''] + args.variant:
+            rows += run_build(exe, variant, args)
+
+    if args.out:
+        with io.open(args.out, 'w') as out:
+            write_rows(rows, args.format, out)
+    elif not args.baseline:
+        write_rows(rows, args.format, sys.stdout)
+
+    if args.baseline:
+        return 1 if compare(rows, read_rows(args.baseline), args.tolerance) else 0
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
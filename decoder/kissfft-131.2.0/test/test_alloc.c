@@ -0,0 +1,177 @@
+/*
+ *  Copyright (c) 2003-2010, Mark Borgerding. All rights reserved.
+ *  This file is part of KISS FFT - https://github.com/mborgerding/kissfft
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  See COPYING file for more information.
+ */
+
+/* Once a plan exists, transforms allocate nothing: built together with the library sources and
+   KISS_FFT_COUNT_ALLOCS (see kiss_fft.h), so that every KISS_FFT_MALLOC bumps kiss_fft_allocs,
+   this runs each kind of call a few times after a first one and fails on any allocation. A batch
+   split across threads gives every block but one a buffer of its own, so ctest runs this with the
+   threading crossover past its largest batch. */
+
+#include "kiss_fftr.h"
+#include "kfc.h"
+
+long kiss_fft_allocs = 0;
+
+#define REPS 4
+
+static int failures = 0;
+
+static void expect_none(const char * what,int nfft,long before)
+{
+    if (kiss_fft_allocs != before) {
+        printf("%s nfft=%d: %ld allocation(s) in %d calls\n",what,nfft,kiss_fft_allocs - before,REPS);
+        ++failures;
+    }
+}
+
+static void check_complex(int nfft,int engine)
+{
+    const char * name = engine == KISS_FFT_ENGINE_STOCKHAM ? "stockham" : "recursive";
+    kiss_fft_cfg cfg = kiss_fft_alloc_engine(nfft,0,engine,NULL,NULL);
+    kiss_fft_cpx * in = (kiss_fft_cpx*)KISS_FFT_MALLOC(sizeof(kiss_fft_cpx)*2*nfft);
+    kiss_fft_cpx * out = (kiss_fft_cpx*)KISS_FFT_MALLOC(sizeof(kiss_fft_cpx)*nfft);
+    long before;
+    int r;
+
+    memset(in,0,sizeof(kiss_fft_cpx)*2*nfft);
+    kiss_fft(cfg,in,out);
+
+    before = kiss_fft_allocs;
+    for (r=0;r<REPS;++r)
+        kiss_fft(cfg,in,out);
+    expect_none(name,nfft,before);
+
+    before = kiss_fft_allocs;
+    for (r=0;r<REPS;++r)
+        kiss_fft(cfg,in,in);
+    expect_none(engine == KISS_FFT_ENGINE_STOCKHAM ? "stockham in place" : "recursive in place",nfft,before);
+
+    before = kiss_fft_allocs;
+    for (r=0;r<REPS;++r)
+        kiss_fft_stride(cfg,in,in,2);
+    expect_none(engine == KISS_FFT_ENGINE_STOCKHAM ? "stockham strided in place" : "recursive strided in place",nfft,before);
+
+    KISS_FFT_FREE(in);
+    KISS_FFT_FREE(out);
+    kiss_fft_free(cfg);
+}
+
+static void check_real(int nfft)
+{
+    kiss_fftr_cfg fwd = kiss_fftr_alloc(nfft,0,NULL,NULL);
+    kiss_fftr_cfg inv = kiss_fftr_alloc(nfft,1,NULL,NULL);
+    kiss_fft_scalar * t = (kiss_fft_scalar*)KISS_FFT_MALLOC(sizeof(kiss_fft_scalar)*nfft);
+    kiss_fft_cpx * f = (kiss_fft_cpx*)KISS_FFT_MALLOC(sizeof(kiss_fft_cpx)*(nfft/2+1));
+    long before;
+    int r;
+
+    memset(t,0,sizeof(kiss_fft_scalar)*nfft);
+    kiss_fftr(fwd,t,f);
+    kiss_fftri(inv,f,t);
+
+    before = kiss_fft_allocs;
+    for (r=0;r<REPS;++r) {
+        kiss_fftr(fwd,t,f);
+        kiss_fftri(inv,f,t);
+    }
+    expect_none("real",nfft,before);
+
+    KISS_FFT_FREE(t);
+    KISS_FFT_FREE(f);
+    kiss_fftr_free(fwd);
+    kiss_fftr_free(inv);
+}
+
+/* two whole blocks of KISS_FFT_BATCH (8) and some left over, through plans that interleave and plans
+   that don't */
+#define HOWMANY 19
+
+static void check_batch(int nfft,int engine)
+{
+    const char * name = engine == KISS_FFT_ENGINE_STOCKHAM ? "stockham batch" : "recursive batch";
+    kiss_fft_cfg cfg = kiss_fft_alloc_engine(nfft,0,engine,NULL,NULL);
+    kiss_fftr_cfg fwd = kiss_fftr_alloc_engine(2*nfft,0,engine,NULL,NULL);
+    kiss_fftr_cfg inv = kiss_fftr_alloc_engine(2*nfft,1,engine,NULL,NULL);
+    kiss_fft_cpx * in = (kiss_fft_cpx*)KISS_FFT_MALLOC(sizeof(kiss_fft_cpx)*HOWMANY*(nfft+1));
+    kiss_fft_cpx * out = (kiss_fft_cpx*)KISS_FFT_MALLOC(sizeof(kiss_fft_cpx)*HOWMANY*(nfft+1));
+    kiss_fft_scalar * t = (kiss_fft_scalar*)KISS_FFT_MALLOC(sizeof(kiss_fft_scalar)*HOWMANY*2*nfft);
+    long before;
+    int r;
+
+    memset(in,0,sizeof(kiss_fft_cpx)*HOWMANY*(nfft+1));
+    memset(t,0,sizeof(kiss_fft_scalar)*HOWMANY*2*nfft);
+    kiss_fft_batch(cfg,HOWMANY,in,1,nfft,out,nfft);
+    kiss_fftr_batch(fwd,HOWMANY,t,2*nfft,out,nfft+1);
+    kiss_fftri_batch(inv,HOWMANY,out,nfft+1,t,2*nfft);
+
+    before = kiss_fft_allocs;
+    for (r=0;r<REPS;++r)
+        kiss_fft_batch(cfg,HOWMANY,in,1,nfft,out,nfft);
+    expect_none(name,nfft,before);
+
+    before = kiss_fft_allocs;
+    for (r=0;r<REPS;++r)
+        kiss_fft_batch(cfg,HOWMANY,in,1,nfft,in,nfft);
+    expect_none(engine == KISS_FFT_ENGINE_STOCKHAM ? "stockham batch in place" : "recursive batch in place",nfft,before);
+
+    before = kiss_fft_allocs;
+    for (r=0;r<REPS;++r) {
+        kiss_fftr_batch(fwd,HOWMANY,t,2*nfft,out,nfft+1);
+        kiss_fftri_batch(inv,HOWMANY,out,nfft+1,t,2*nfft);
+    }
+    expect_none(engine == KISS_FFT_ENGINE_STOCKHAM ? "stockham real batch" : "recursive real batch",nfft,before);
+
+    KISS_FFT_FREE(in);
+    KISS_FFT_FREE(out);
+    KISS_FFT_FREE(t);
+    kiss_fft_free(cfg);
+    kiss_fftr_free(fwd);
+    kiss_fftr_free(inv);
+}
+
+static void check_kfc(int nfft)
+{
+    kiss_fft_cpx * buf = (kiss_fft_cpx*)KISS_FFT_MALLOC(sizeof(kiss_fft_cpx)*nfft);
+    long before;
+    int r;
+
+    memset(buf,0,sizeof(kiss_fft_cpx)*nfft);
+    kfc_fft(nfft,buf,buf);
+
+    before = kiss_fft_allocs;
+    for (r=0;r<REPS;++r)
+        kfc_fft(nfft,buf,buf);
+    expect_none("kfc",nfft,before);
+
+    KISS_FFT_FREE(buf);
+}
+
+int main(void)
+{
+    /* radix 2-5 with and without leaf codelets, generic radices 7 and 37, and (in floating point,
+       see KISS_FFT_BLUESTEIN_MIN) Bluestein plans for 1009 and 2*3*101 */
+    static const int sizes[] = { 8, 60, 64, 240, 1000, 1024, 2048, 4096, 7*64, 37*8, 1009, 2*3*101 };
+    size_t s;
+
+    for (s=0;s<sizeof(sizes)/sizeof(sizes[0]);++s) {
+        check_complex(sizes[s],KISS_FFT_ENGINE_RECURSIVE);
+        check_complex(sizes[s],KISS_FFT_ENGINE_STOCKHAM);
+        check_real(2*sizes[s]);
+        check_batch(sizes[s],KISS_FFT_ENGINE_RECURSIVE);
+        check_batch(sizes[s],KISS_FFT_ENGINE_STOCKHAM);
+        check_kfc(sizes[s]);
+    }
+    kfc_cleanup();
+
+    if (failures) {
+        printf("%d check(s) allocated\n",failures);
+        return 1;
+    }
+    printf("no allocations after the first call\n");
+    return 0;
+}
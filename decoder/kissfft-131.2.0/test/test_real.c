@@ -67,6 +67,257 @@ double snr_compare( kiss_fft_cpx * vec1,kiss_fft_cpx * vec2, int n)
     return snr;
 }
 
+/*
+ * Each feature that stands in for another is checked against it on one shared fixture: for every
+ * size of a row of comparisons[] and both directions, in holds random points, the row's check
+ * fills ref through the reference path and out through the one under test, and returns the worst
+ * snr between them. Checks that must match to the bit call fail() themselves.
+ */
+struct fixture
+{
+    int n, inverse;
+    kiss_fft_cpx * in, * out, * ref; /* points*(n+1) each, see struct comparison */
+};
+
+struct comparison
+{
+    const char * what;
+    double (*check)(const struct fixture * f);
+    int points;
+    int sizes[10]; /* up to the first 0 */
+};
+
+static
+void fail(const char * why)
+{
+    printf( "\n%s\n", why );
+    exit(1);
+}
+
+/* The vectorised butterflies (_kiss_fft_vec.h) against the scalar ones. KISSFFT_SIMD=scalar is read
+   by kiss_fft_alloc. */
+static
+double check_vec_scalar(const struct fixture * f)
+{
+    const char * cap = getenv("KISSFFT_SIMD");
+    kiss_fft_cfg cfg = kiss_fft_alloc(f->n,f->inverse,0,0);
+    kiss_fft(cfg,f->in,f->out);
+    kiss_fft_free(cfg);
+
+    setenv("KISSFFT_SIMD","scalar",1);
+    cfg = kiss_fft_alloc(f->n,f->inverse,0,0);
+    kiss_fft(cfg,f->in,f->ref);
+    kiss_fft_free(cfg);
+    if (cap) setenv("KISSFFT_SIMD",cap,1);
+    else unsetenv("KISSFFT_SIMD");
+#ifdef FIXED_POINT
+    /* the int16 kernels round exactly as the scalar code does (_kiss_fft_vec_q15.h) */
+    if (memcmp(f->ref,f->out,sizeof(kiss_fft_cpx)*f->n) != 0)
+        fail("vectorised fixed point butterflies are not bit exact");
+#endif
+    return snr_compare(f->ref,f->out,f->n);
+}
+
+/* The Stockham engine against the recursive one (kiss_fft_alloc_engine), out of place and strided
+   in place; unit stride in place runs the same stages as out of place, so the bits match. */
+static
+double check_engines(const struct fixture * f)
+{
+    const int n = f->n;
+    kiss_fft_cfg rec = kiss_fft_alloc_engine(n,f->inverse,KISS_FFT_ENGINE_RECURSIVE,0,0);
+    kiss_fft_cfg stk = kiss_fft_alloc_engine(n,f->inverse,KISS_FFT_ENGINE_STOCKHAM,0,0);
+    double snr, snr2;
+
+    kiss_fft(rec,f->in,f->ref);
+    kiss_fft(stk,f->in,f->out);
+    snr = snr_compare(f->ref,f->out,n);
+
+    kiss_fft_stride(rec,f->in,f->ref,2);
+    memcpy(f->out,f->in,sizeof(kiss_fft_cpx)*2*n);
+    kiss_fft_stride(stk,f->out,f->out,2);
+    snr2 = snr_compare(f->ref,f->out,n);
+
+    kiss_fft(stk,f->in,f->ref);
+    memcpy(f->out,f->in,sizeof(kiss_fft_cpx)*n);
+    kiss_fft(stk,f->out,f->out);
+    if (memcmp(f->ref,f->out,sizeof(kiss_fft_cpx)*n) != 0)
+        fail("the Stockham engine in place disagrees with out of place");
+
+    kiss_fft_free(rec);
+    kiss_fft_free(stk);
+    return snr < snr2 ? snr : snr2;
+}
+
+/* A cfg placed in caller memory sized from lenmem, which covers the per-stage twiddle tables and
+   the scratch, gives the same bits as a malloc'd one. The 16 byte offset moves the tables'
+   alignment slack around. */
+static
+double check_user_mem(const struct fixture * f)
+{
+    double snr, worst = 1e10;
+    int engine;
+
+    for (engine=KISS_FFT_ENGINE_RECURSIVE;engine<=KISS_FFT_ENGINE_STOCKHAM;++engine) {
+        size_t len = 0;
+        char * mem;
+        kiss_fft_cfg cfg = kiss_fft_alloc_engine(f->n,f->inverse,engine,0,0);
+        kiss_fft(cfg,f->in,f->ref);
+        kiss_fft_free(cfg);
+
+        if (kiss_fft_alloc_engine(f->n,f->inverse,engine,NULL,&len) != NULL || len == 0)
+            fail("kiss_fft_alloc_engine did not report its size");
+        mem = (char*)KISS_FFT_MALLOC(len + 16);
+        cfg = kiss_fft_alloc_engine(f->n,f->inverse,engine,mem + 16,&len);
+        kiss_fft(cfg,f->in,f->out);
+        if (cfg != (kiss_fft_cfg)(mem + 16) || memcmp(f->ref,f->out,sizeof(kiss_fft_cpx)*f->n) != 0)
+            fail("a cfg in caller memory disagrees with a malloc'd one");
+        snr = snr_compare(f->ref,f->out,f->n);
+        if (snr < worst) worst = snr;
+        KISS_FFT_FREE(mem);
+    }
+    return worst;
+}
+
+#if !defined(FIXED_POINT) && !defined(USE_SIMD)
+/* Sizes with a large prime factor run as Bluestein convolutions (kf_bluestein); check them against a
+   direct DFT, out of place and strided in place, on both engines. Floating point only, like the path. */
+static
+double check_bluestein(const struct fixture * f)
+{
+    const double pi = 3.14159265358979323846264338327;
+    const int n = f->n;
+    double snr, worst = 1e10;
+    int i, k, engine;
+
+    for (k=0;k<n;++k) {
+        double re = 0, im = 0;
+        for (i=0;i<n;++i) {
+            double phase = (f->inverse ? 2 : -2)*pi*(double)((long long)i*k % n)/n;
+            re += f->in[i].r*cos(phase) - f->in[i].i*sin(phase);
+            im += f->in[i].r*sin(phase) + f->in[i].i*cos(phase);
+        }
+        f->ref[k].r = (kiss_fft_scalar)re;
+        f->ref[k].i = (kiss_fft_scalar)im;
+    }
+    for (engine=KISS_FFT_ENGINE_RECURSIVE;engine<=KISS_FFT_ENGINE_STOCKHAM;++engine) {
+        kiss_fft_cfg cfg = kiss_fft_alloc_engine(n,f->inverse,engine,0,0);
+        if (cfg->bluestein == NULL)
+            fail("the plan is not a Bluestein plan");
+        kiss_fft(cfg,f->in,f->out);
+        snr = snr_compare(f->ref,f->out,n);
+        if (snr < worst) worst = snr;
+
+        for (i=0;i<n;++i)
+            f->out[2*i] = f->in[i];
+        kiss_fft_stride(cfg,f->out,f->out,2);
+        snr = snr_compare(f->ref,f->out,n);
+        if (snr < worst) worst = snr;
+        kiss_fft_free(cfg);
+    }
+    return worst;
+}
+#endif
+
+/* kiss_fft_batch / kiss_fftr_batch / kiss_fftri_batch against one transform at a time: strided,
+   padded input with a batch that leaves a partial block, in place, and sizes past
+   KISS_FFT_BATCH_BYTES or with a generic radix that take the one at a time path. */
+#define BATCH_HOWMANY (2*KISS_FFT_BATCH + 3)
+
+static
+double check_batch(const struct fixture * f)
+{
+    const int n = f->n, howmany = BATCH_HOWMANY, dist = 2*n + 1, rdist = n + 2, nf = n/2 + 1;
+    kiss_fft_cfg cfg = kiss_fft_alloc_engine(n,f->inverse,KISS_FFT_ENGINE_AUTO,0,0);
+    kiss_fftr_cfg rcfg = kiss_fftr_alloc_engine(n,f->inverse,KISS_FFT_ENGINE_AUTO,0,0);
+    kiss_fft_scalar * rin = (kiss_fft_scalar*)f->in;
+    kiss_fft_scalar * rout = (kiss_fft_scalar*)f->out;
+    kiss_fft_scalar * rref = (kiss_fft_scalar*)f->ref;
+    double snr, worst = 1e10;
+    int j;
+
+    for (j=0;j<howmany;++j)
+        kiss_fft_stride(cfg,f->in + j*dist,f->ref + j*n,2);
+    kiss_fft_batch(cfg,howmany,f->in,2,dist,f->out,n);
+    for (j=0;j<howmany;++j) {
+        snr = snr_compare(f->ref + j*n,f->out + j*n,n);
+        if (snr < worst) worst = snr;
+    }
+    for (j=0;j<howmany*n;++j)
+        f->out[j] = f->in[j];
+    for (j=0;j<howmany;++j)
+        kiss_fft(cfg,f->out + j*n,f->ref + j*n);
+    kiss_fft_batch(cfg,howmany,f->out,1,n,f->out,n);
+    snr = snr_compare(f->ref,f->out,howmany*n);
+    if (snr < worst) worst = snr;
+
+    /* real: forward from in, and inverse from in read as half spectra */
+    for (j=0;j<howmany;++j) {
+        if (f->inverse)
+            kiss_fftri(rcfg,f->in + j*nf,rref + j*n);
+        else
+            kiss_fftr(rcfg,rin + j*rdist,f->ref + j*nf);
+    }
+    if (f->inverse) {
+        kiss_fftri_batch(rcfg,howmany,f->in,nf,rout,n);
+        snr = snr_compare(f->ref,f->out,howmany*n/2);
+    }else{
+        kiss_fftr_batch(rcfg,howmany,rin,rdist,f->out,nf);
+        snr = snr_compare(f->ref,f->out,howmany*nf);
+    }
+    if (snr < worst) worst = snr;
+
+    kiss_fft_free(cfg);
+    kiss_fftr_free(rcfg);
+    return worst;
+}
+
+static const struct comparison comparisons[] = {
+    { "vector vs scalar", check_vec_scalar, 1, { 64, 240, 1024, 2048, 4096 } },
+    /* odd radices, a generic prime factor (77) and a size past the thread crossover */
+    { "stockham vs recursive", check_engines, 2, { 8, 60, 77, 240, 1024, 2048, 4096, 16384 } },
+    { "caller memory vs malloc", check_user_mem, 1, { 60, 77, 1024, 4096 } },
+#if !defined(FIXED_POINT) && !defined(USE_SIMD)
+    { "bluestein vs dft", check_bluestein, 2, { 67, 606, 1009, 4099 } },
+#endif
+    { "batch vs one at a time", check_batch, 2*BATCH_HOWMANY, { 60, 64, 240, 1000, 1024, 2310, 8192 } },
+};
+
+static
+void compare_all(void)
+{
+    const double minsnr = 100;
+    size_t c, i;
+    int s;
+    double snr;
+
+    for (c=0;c<sizeof(comparisons)/sizeof(comparisons[0]);++c) {
+        const struct comparison * cmp = &comparisons[c];
+        for (s=0;cmp->sizes[s];++s) {
+            struct fixture f;
+            const size_t points = (size_t)cmp->points*(cmp->sizes[s] + 1);
+            f.n = cmp->sizes[s];
+            f.in = (kiss_fft_cpx*)KISS_FFT_MALLOC(sizeof(kiss_fft_cpx)*points);
+            f.out = (kiss_fft_cpx*)KISS_FFT_MALLOC(sizeof(kiss_fft_cpx)*points);
+            f.ref = (kiss_fft_cpx*)KISS_FFT_MALLOC(sizeof(kiss_fft_cpx)*points);
+            for (i=0;i<points;++i) {
+                f.in[i].r = rand_scalar();
+                f.in[i].i = rand_scalar();
+            }
+            for (f.inverse=0;f.inverse<2;++f.inverse) {
+                snr = cmp->check(&f);
+                printf( "nfft=%d, inverse=%d, %s snr=%g\n", f.n,f.inverse,cmp->what,snr );
+                if (snr < minsnr) {
+                    printf( "\n%s: the transforms disagree\n", cmp->what );
+                    exit(1);
+                }
+            }
+            KISS_FFT_FREE(f.in);
+            KISS_FFT_FREE(f.out);
+            KISS_FFT_FREE(f.ref);
+        }
+    }
+}
+
 #ifndef NUMFFTS
 #define NUMFFTS 10000
 #endif
@@ -175,5 +426,7 @@ int main(int argc,char ** argv)
     free(kiss_fft_state);
     free(kiss_fftr_state);
 
+    compare_all();
+
     return 0;
 }
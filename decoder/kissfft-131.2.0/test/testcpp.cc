@@ -10,6 +10,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <typeinfo>
+#include <limits>
 
 #include <sys/time.h>
 static inline
@@ -70,6 +71,64 @@ void dotest(int nfft)
     cout << " MSPS:" << ( (nits*nfft)*1e-6/ (t1-t0) ) << endl;
 }
 
+// The decoder's sizes, compiled in full: every member of kissfft_fixed is built, used or not
+template class kissfft_fixed<float,1024>;
+template class kissfft_fixed<float,2048>;
+template class kissfft_fixed<float,4096>;
+
+// kissfft_fixed against kissfft, which dotest checks against the DFT: same results, and the speed of each
+template <class T,std::size_t nfft>
+bool dotest_fixed()
+{
+    typedef std::complex<T> cpx_type;
+
+    cout << "type:" << typeid(T).name() << " fixed nfft:" << nfft;
+
+    kissfft<T> fft(nfft,false);
+    kissfft_fixed<T,nfft> fixed;
+
+    vector<cpx_type> inbuf(nfft);
+    vector<cpx_type> outbuf(nfft);
+    vector<cpx_type> fixedbuf(nfft);
+    vector<T> realbuf(2*nfft);
+    for (std::size_t k=0;k<nfft;++k)
+        inbuf[k]= cpx_type(
+                (T)(rand()/(double)RAND_MAX - .5),
+                (T)(rand()/(double)RAND_MAX - .5) );
+    for (std::size_t k=0;k<2*nfft;++k)
+        realbuf[k] = (T)(rand()/(double)RAND_MAX - .5);
+
+    long double totalpower=0;
+    long double difpower=0;
+    fft.transform( &inbuf[0] , &outbuf[0] );
+    fixed.transform( &inbuf[0] , &fixedbuf[0] );
+    for (std::size_t k=0;k<nfft;++k) {
+        totalpower += norm(complex<long double>(outbuf[k].real(),outbuf[k].imag()));
+        difpower += norm(complex<long double>(outbuf[k].real()-fixedbuf[k].real(),outbuf[k].imag()-fixedbuf[k].imag()));
+    }
+    fft.transform_real( &realbuf[0] , &outbuf[0] );
+    fixed.transform_real( &realbuf[0] , &fixedbuf[0] );
+    for (std::size_t k=0;k<nfft;++k) {
+        totalpower += norm(complex<long double>(outbuf[k].real(),outbuf[k].imag()));
+        difpower += norm(complex<long double>(outbuf[k].real()-fixedbuf[k].real(),outbuf[k].imag()-fixedbuf[k].imag()));
+    }
+    const long double rmse = sqrt(difpower/totalpower);
+    cout << " RMSE vs kissfft:" << rmse << "\t";
+
+    int nits=20e6/nfft;
+    double t0 = curtime();
+    for (int k=0;k<nits;++k)
+        fft.transform( &inbuf[0] , &outbuf[0] );
+    double t1 = curtime();
+    for (int k=0;k<nits;++k)
+        fixed.transform( &inbuf[0] , &fixedbuf[0] );
+    double t2 = curtime();
+    cout << " MSPS:" << ( (nits*nfft)*1e-6/ (t2-t1) ) << " (kissfft " << ( (nits*nfft)*1e-6/ (t1-t0) ) << ")" << endl;
+
+    // both round the same twiddles a little differently
+    return rmse < 10*std::numeric_limits<T>::epsilon();
+}
+
 int main(int argc,char ** argv)
 {
     if (argc>1) {
@@ -82,5 +141,9 @@ int main(int argc,char ** argv)
         dotest<float>(1024); dotest<double>(1024); dotest<long double>(1024);
         dotest<float>(840); dotest<double>(840); dotest<long double>(840);
     }
-    return 0;
+
+    bool ok = true;
+    ok &= dotest_fixed<float,1024>(); ok &= dotest_fixed<float,2048>(); ok &= dotest_fixed<float,4096>();
+    ok &= dotest_fixed<double,1024>(); ok &= dotest_fixed<double,840>(); ok &= dotest_fixed<long double,840>();
+    return ok ? 0 : 1;
 }
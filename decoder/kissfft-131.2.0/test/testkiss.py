@@ -68,8 +68,8 @@ def randmat(ndim):
         dims[-1] = (dims[-1] // 2) * 2  # force even last dimension if real
     return make_random(dims)
 
-def test_fft(ndim):
-    x = randmat(ndim)
+def test_fft(ndim, dims=None, amplitude=1.0):
+    x = randmat(ndim) if dims is None else amplitude * make_random(dims)
 
     if do_real:
         xver = np.fft.rfftn(x)
@@ -138,6 +138,15 @@ def main():
     for dim in range(1, 4):
         test_fft(dim)
 
+    # 1-D sizes big enough for the vectorised butterflies (run again with KISSFFT_SIMD=scalar for the scalar path).
+    # Half scale: a twiddled full-scale complex value can exceed the fixed point range and wrap.
+    for n in (64, 240, 1000, 1024, 2048, 4096):
+        test_fft(1, [n], 0.5)
+
+    # Large prime factors: Bluestein in floating point, kf_bfly_generic in fixed point
+    for n in (1009, 2 * 3 * 101):
+        test_fft(1, [n], 0.5)
+
 
 if __name__ == "__main__":
     main()
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2003-2010, Mark Borgerding. All rights reserved.
+#  This file is part of KISS FFT - https://github.com/mborgerding/kissfft
+#
+#  SPDX-License-Identifier: BSD-3-Clause
+#  See COPYING file for more information.
+#
+
+"""Generate _kiss_fft_codelets.h: straight-line leaf DFTs for kf_work.
+
+Each codelet is a complete split-radix DFT of 8, 16, 32 or 64 points, read
+with a stride and written contiguously, with every twiddle folded into a
+constant and the trivial ones (1, -1, +-i, (+-1+-i)/sqrt(2)) simplified away.
+
+    python3 tools/kf_codelets.py > _kiss_fft_codelets.h
+    python3 tools/kf_codelets.py --check _kiss_fft_codelets.h
+"""
+
+import math
+import sys
+
+SIZES = (64, 32, 16, 8)
+
+
+class Codelet:
+    def __init__(self, n, sign):
+        self.n = n
+        self.sign = sign        # -1 forward, +1 inverse
+        self.lines = []
+        self.ntmp = 0
+
+    def emit(self, re, im):
+        name = 't%d' % self.ntmp
+        self.ntmp += 1
+        self.lines.append('    const kiss_fft_scalar %sr = %s, %si = %s;' % (name, re, name, im))
+        return (name + 'r', name + 'i')
+
+    def add(self, a, b):
+        return self.emit('%s + %s' % (a[0], b[0]), '%s + %s' % (a[1], b[1]))
+
+    def sub(self, a, b):
+        return self.emit('%s - %s' % (a[0], b[0]), '%s - %s' % (a[1], b[1]))
+
+    def rot(self, a):
+        """a * (-i) for the forward transform, a * (+i) for the inverse"""
+        if self.sign < 0:
+            return self.emit(a[1], '-' + a[0])
+        return self.emit('-' + a[1], a[0])
+
+    def twiddle(self, a, k, n):
+        """a * exp(sign*2*pi*i*k/n)"""
+        k %= n
+        if k == 0:
+            return a
+        if (8 * k) % n == 0 and (8 * k // n) % 2 == 0:
+            q = 8 * k // n
+            if q == 4:
+                return self.emit('-' + a[0], '-' + a[1])
+            # k/n == 1/4 is the same quarter turn as rot() in either direction, 3/4 its opposite
+            return self.rot(a) if q == 2 else self.rot(self.emit('-' + a[0], '-' + a[1]))
+        c = math.cos(2 * math.pi * k / n)
+        s = self.sign * math.sin(2 * math.pi * k / n)
+        neg = '-' if c < 0 else ''
+        if (8 * k) % n == 0:
+            # |c| == |s| == sqrt(1/2): two multiplies instead of four
+            h = const(math.sqrt(0.5))
+            if (c > 0) == (s > 0):
+                return self.emit('%s(%s - %s)*%s' % (neg, a[0], a[1], h), '%s(%s + %s)*%s' % (neg, a[0], a[1], h))
+            return self.emit('%s(%s + %s)*%s' % (neg, a[0], a[1], h), '%s(%s - %s)*%s' % (neg, a[1], a[0], h))
+        re = '%s*%s %s %s*%s' % (a[0], const(c), '-' if s > 0 else '+', a[1], const(abs(s)))
+        im = '%s*%s %s %s*%s' % (a[1], const(c), '+' if s > 0 else '-', a[0], const(abs(s)))
+        return self.emit(re, im)
+
+    def dft(self, x):
+        n = len(x)
+        if n == 1:
+            return x
+        if n == 2:
+            return [self.add(x[0], x[1]), self.sub(x[0], x[1])]
+        u = self.dft(x[0::2])
+        z = self.dft(x[1::4])
+        z3 = self.dft(x[3::4])
+        q = n // 4
+        X = [None] * n
+        for k in range(q):
+            a = self.twiddle(z[k], k, n)
+            b = self.twiddle(z3[k], 3 * k, n)
+            s = self.add(a, b)
+            d = self.rot(self.sub(a, b))
+            X[k] = self.add(u[k], s)
+            X[k + 2 * q] = self.sub(u[k], s)
+            X[k + q] = self.add(u[k + q], d)
+            X[k + 3 * q] = self.sub(u[k + q], d)
+        return X
+
+    def function(self):
+        x = [('f[0].r', 'f[0].i'), ('f[fs].r', 'f[fs].i')]
+        x += [('f[%d*fs].r' % k, 'f[%d*fs].i' % k) for k in range(2, self.n)]
+        X = self.dft(x)
+        out = ['static void %s(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs)' % self.name(), '{']
+        out += self.lines
+        for k, v in enumerate(X):
+            out.append('    Fout[%d].r = %s; Fout[%d].i = %s;' % (k, v[0], k, v[1]))
+        out.append('}')
+        return '\n'.join(out)
+
+    def name(self):
+        return 'kf_leaf%d_%s' % (self.n, 'inv' if self.sign > 0 else 'fwd')
+
+
+def const(v):
+    return '(kiss_fft_scalar)%.17g' % v
+
+
+def generate():
+    out = ['''/*
+ *  Copyright (c) 2003-2010, Mark Borgerding. All rights reserved.
+ *  This file is part of KISS FFT - https://github.com/mborgerding/kissfft
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  See COPYING file for more information.
+ */
+
+/* _kiss_fft_codelets.h
+   GENERATED by tools/kf_codelets.py -- edit the generator, not this file.
+
+   Straight-line split-radix DFTs of %s points used by kf_work as leaves in place of the
+   last few radix-2/4 stages. Floating point only: fixed point would need the C_FIXDIV scaling.
+ */
+#ifndef _kiss_fft_codelets_h
+#define _kiss_fft_codelets_h
+
+#if !defined(FIXED_POINT) && !defined(USE_SIMD) && !defined(KISS_FFT_NO_CODELETS)
+#define KF_CODELETS 1
+''' % ', '.join(str(n) for n in sorted(SIZES))]
+    for n in SIZES:
+        for sign in (-1, 1):
+            out.append(Codelet(n, sign).function())
+            out.append('')
+    out.append('''/* Fout[0..n) = DFT of f[0], f[fs], ... f[(n-1)*fs]; n is one of the sizes above */
+static void kf_leaf(kiss_fft_cpx * Fout, const kiss_fft_cpx * f, const size_t fs, int n, int inverse)
+{
+    switch (n) {''')
+    for n in SIZES:
+        out.append('        case %d: if (inverse) kf_leaf%d_inv(Fout, f, fs); else kf_leaf%d_fwd(Fout, f, fs); break;' % (n, n, n))
+    out.append('''    }
+}
+
+/* Largest codelet to finish an n-point plan with. Prefers one that leaves a power of 4 above it,
+   so the remaining stages are all radix 4; 0 when none divides n. */
+static int kf_leaf_size(int n)
+{
+    static const int sizes[] = {%s};
+    size_t i;
+    for (i = 0; i < sizeof(sizes)/sizeof(sizes[0]); ++i) {
+        int r = n / sizes[i];
+        if (n %% sizes[i] == 0 && (r & (r - 1)) == 0 && (r & 0x55555555))
+            return sizes[i];
+    }
+    for (i = 0; i < sizeof(sizes)/sizeof(sizes[0]); ++i)
+        if (n %% sizes[i] == 0)
+            return sizes[i];
+    return 0;
+}
+
+#endif
+#endif''' % ', '.join(str(n) for n in SIZES))
+    return '\n'.join(out) + '\n'
+
+
+def main(argv):
+    text = generate()
+    if len(argv) == 3 and argv[1] == '--check':
+        with open(argv[2]) as f:
+            if f.read() != text:
+                sys.stderr.write('%s is out of date, rerun tools/kf_codelets.py\n' % argv[2])
+                return 1
+        return 0
+    if len(argv) != 1:
+        sys.stderr.write(__doc__)
+        return 2
+    sys.stdout.write(text)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
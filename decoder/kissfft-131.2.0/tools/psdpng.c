@@ -120,55 +120,60 @@ void transform_signal(void)
     kiss_fft_scalar *tbuf;
     kiss_fft_cpx *fbuf;
     float *mag2buf;
-    int i;
+    int i,j;
     int n;
-    int avgctr=0;
 
     int nfreqs=nfft/2+1;
 
-    CHECKNULL( cfg=kiss_fftr_alloc(nfft,0,0,0) );
+    /* the navg frames of a row go through the fft together */
+    CHECKNULL( cfg=kiss_fftr_alloc_engine(nfft,0,KISS_FFT_ENGINE_AUTO,0,0) );
     CHECKNULL( inbuf=(short*)malloc(sizeof(short)*2*nfft ) );
-    CHECKNULL( tbuf=(kiss_fft_scalar*)malloc(sizeof(kiss_fft_scalar)*nfft ) );
-    CHECKNULL( fbuf=(kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx)*nfreqs ) );
+    CHECKNULL( tbuf=(kiss_fft_scalar*)malloc(sizeof(kiss_fft_scalar)*nfft*navg ) );
+    CHECKNULL( fbuf=(kiss_fft_cpx*)malloc(sizeof(kiss_fft_cpx)*nfreqs*navg ) );
     CHECKNULL( mag2buf=(float*)calloc(nfreqs,sizeof(float) ) );
 
     while (1) {
-        if (stereo) {
-            n = fread(inbuf,sizeof(short)*2,nfft,fin);
-            if (n != nfft ) 
-                break;
-            for (i=0;i<nfft;++i) 
-                tbuf[i] = inbuf[2*i] + inbuf[2*i+1];
-        }else{
-            n = fread(inbuf,sizeof(short),nfft,fin);
-            if (n != nfft ) 
-                break;
-            for (i=0;i<nfft;++i) 
-                tbuf[i] = inbuf[i];
-        }
-
-        if (remove_dc) {
-            float avg = 0;
-            for (i=0;i<nfft;++i)  avg += tbuf[i];
-            avg /= nfft;
-            for (i=0;i<nfft;++i)  tbuf[i] -= (kiss_fft_scalar)avg;
+        for (j=0;j<navg;++j) {
+            kiss_fft_scalar *t = tbuf + j*nfft;
+            if (stereo) {
+                n = fread(inbuf,sizeof(short)*2,nfft,fin);
+                if (n != nfft ) 
+                    break;
+                for (i=0;i<nfft;++i) 
+                    t[i] = inbuf[2*i] + inbuf[2*i+1];
+            }else{
+                n = fread(inbuf,sizeof(short),nfft,fin);
+                if (n != nfft ) 
+                    break;
+                for (i=0;i<nfft;++i) 
+                    t[i] = inbuf[i];
+            }
+
+            if (remove_dc) {
+                float avg = 0;
+                for (i=0;i<nfft;++i)  avg += t[i];
+                avg /= nfft;
+                for (i=0;i<nfft;++i)  t[i] -= (kiss_fft_scalar)avg;
+            }
         }
+        if (j < navg)
+            break;
 
         /* do FFT */
-        kiss_fftr(cfg,tbuf,fbuf);
+        kiss_fftr_batch(cfg,navg,tbuf,nfft,fbuf,nfreqs);
 
-        for (i=0;i<nfreqs;++i)
-            mag2buf[i] += fbuf[i].r * fbuf[i].r + fbuf[i].i * fbuf[i].i;
-
-        if (++avgctr == navg) {
-            avgctr=0;
-            ++nrows;
-            CHECKNULL( vals = (float*)realloc(vals,sizeof(float)*nrows*nfreqs) );
-            float eps = 1;
+        for (j=0;j<navg;++j) {
+            const kiss_fft_cpx *f = fbuf + j*nfreqs;
             for (i=0;i<nfreqs;++i)
-                vals[(nrows - 1) * nfreqs + i] = 10 * log10 ( mag2buf[i] / navg + eps );
-            memset(mag2buf,0,sizeof(mag2buf[0])*nfreqs);
+                mag2buf[i] += f[i].r * f[i].r + f[i].i * f[i].i;
         }
+
+        ++nrows;
+        CHECKNULL( vals = (float*)realloc(vals,sizeof(float)*nrows*nfreqs) );
+        float eps = 1;
+        for (i=0;i<nfreqs;++i)
+            vals[(nrows - 1) * nfreqs + i] = 10 * log10 ( mag2buf[i] / navg + eps );
+        memset(mag2buf,0,sizeof(mag2buf[0])*nfreqs);
     }
 
     free(cfg);
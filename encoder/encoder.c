@@ -4,9 +4,29 @@
 #include <math.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "../common/crc32c.h"
+#include "../common/lt_code.h"
 
 #define PI 3.14159265358979323846 // Defined here for use in tone generation calculations
 #define REPEAT_IDX 256
+#define SYNC_MARKER 0xFD // Protocol v2 header (CRC-32C). Legacy v1 headers used 0xFE with an 8-bit sum.
+#define HDR_FLAG_HEADER_CRC 0x01 // headerCrc field is valid
+#define HDR_FLAG_FRAMED 0x02     // Payload is sent as CRC-checked blocks, each preceded by a FREQ_HEADER resync marker
+#define MAX_RANGES 32            // SendRanges entries
+#define SYNC_MARKER_CAROUSEL 0xFC  // Fountain-coded carousel packet
+#define CAROUSEL_NAME_ESI 0xFFFFFFFFu // Packet carries the file name instead of a symbol
+#define CAROUSEL_NAME_EVERY 8     // One name packet per this many symbol packets
+#define SYNC_MARKER_SESSION 0xFB  // Multi-file session manifest, sent in place of the header
+#define MAX_SESSION_FILES 64
+
+/* Every heap call in this file goes through CountedMalloc, so --alloc-check can show that writing the tones allocates
+   nothing once a transmission is set up. The C runtime's own (the FILE buffers of fopen) are not seen. */
+long g_HeapCalls = 0;
+long g_ToneLoopAllocs = 0; // Heap calls made while the last transmission's tones were written
+void *CountedMalloc(size_t n) { g_HeapCalls++; return malloc(n); }
 
 typedef struct {
     int SAMPLE_RATE;
@@ -20,6 +40,13 @@ typedef struct {
     float HELLO_DUR;
     float HEADER_DUR;
     char INPUT_FILE[256]; // Added for configurable input
+    bool HEADER_CRC;      // Protect the header itself so the decoder can reject it before the payload starts
+    bool FRAMED;          // Send the payload in short blocks the decoder can resync on
+    int BLOCK_SIZE;       // Payload bytes per block (1-255)
+    int RANGE_COUNT;      // Byte ranges to (re)send in framed mode; 0 means the whole file
+    uint32_t RANGES[MAX_RANGES][2];
+    bool CAROUSEL;        // Endless fountain-coded broadcast that receivers can join at any time
+    int CAROUSEL_PACKETS; // Symbols in one loop of transmit.wav; 0 picks twice the block count
 } EncoderConfig;
 
 #pragma pack(push, 1) // Saves current alignment and disables padding to prevent unfilled space errors in header struct.
@@ -27,10 +54,29 @@ typedef struct {
     uint8_t syncMarker; 
     char fileName[32];
     uint32_t fileSize;
-    uint8_t checksum;
-    uint8_t fileType;
+    uint32_t crc32c;    // CRC-32C of the payload
+    uint8_t flags;      // HDR_FLAG_* bits
+    uint8_t blockSize;  // Payload bytes per block if HDR_FLAG_FRAMED, else 0
+    uint32_t headerCrc; // CRC-32C of every header byte before this field (if HDR_FLAG_HEADER_CRC)
 } ChordHeader;
 
+/* Framed mode block, sent after a FREQ_HEADER marker tone: BlockHeader, `len` payload bytes, then a
+   CRC-32C of both. Block `seq` holds file bytes [seq * blockSize, seq * blockSize + len). */
+typedef struct {
+    uint16_t seq;
+    uint8_t len;
+} BlockHeader;
+
+/* Carousel packet, sent after a FREQ_HEADER marker tone with no HELLO: CarouselHeader, then blockSize bytes of
+   encoded symbol (or 32 bytes of file name for CAROUSEL_NAME_ESI), then a CRC-32C of everything before it. */
+typedef struct {
+    uint8_t syncMarker; // SYNC_MARKER_CAROUSEL
+    uint32_t fileId;    // CRC-32C of the whole file; identifies it and verifies the result
+    uint32_t fileSize;
+    uint8_t blockSize;
+    uint32_t esi;       // Encoding symbol id, selects which blocks are XORed together
+} CarouselHeader;
+
 typedef struct {
     char riff[4];
     uint32_t overall_size;
@@ -69,6 +115,22 @@ bool load_config(const char* filename, EncoderConfig* config) {
             else if (strcmp(key, "DataDur") == 0) config->DATA_DUR = atof(str_val);
             else if (strcmp(key, "ByteGap") == 0) config->BYTE_GAP = atof(str_val);
             else if (strcmp(key, "InputFile") == 0) strncpy(config->INPUT_FILE, str_val, 255);
+            else if (strcmp(key, "HeaderCrc") == 0) config->HEADER_CRC = atoi(str_val) != 0;
+            else if (strcmp(key, "Framed") == 0) config->FRAMED = atoi(str_val) != 0;
+            else if (strcmp(key, "BlockSize") == 0) config->BLOCK_SIZE = atoi(str_val);
+            else if (strcmp(key, "Carousel") == 0) config->CAROUSEL = atoi(str_val) != 0;
+            else if (strcmp(key, "CarouselPackets") == 0) config->CAROUSEL_PACKETS = atoi(str_val);
+            else if (strcmp(key, "SendRanges") == 0) { // e.g. SendRanges=128-191,512-575 as printed by the decoder
+                config->RANGE_COUNT = 0;
+                for (char *tok = strtok(str_val, ","); tok && config->RANGE_COUNT < MAX_RANGES; tok = strtok(NULL, ",")) {
+                    unsigned long a, b;
+                    if (sscanf(tok, "%lu-%lu", &a, &b) == 2 && a <= b) {
+                        config->RANGES[config->RANGE_COUNT][0] = (uint32_t)a;
+                        config->RANGES[config->RANGE_COUNT][1] = (uint32_t)b;
+                        config->RANGE_COUNT++;
+                    }
+                }
+            }
         }
     }
     fclose(file);
@@ -79,28 +141,31 @@ bool load_config(const char* filename, EncoderConfig* config) {
     return true;
 }
 
+#define TONE_CHUNK 4096 // Samples per fwrite; tones are written a chunk at a time from the stack, never the heap
+
 void write_tone(FILE *f, float freq, float duration, int sampleRate) {
     int total_samples = (int)(sampleRate * duration);
     if (total_samples <= 0) return;
 
-    int16_t *buffer = malloc(total_samples * sizeof(int16_t));
-    if (!buffer) return;
-
+    int16_t buffer[TONE_CHUNK];
     int fade_len = (int)(sampleRate * 0.005f); // 5ms fade to prevent clicks
     
-    for (int i = 0; i < total_samples; i++) {
-        float amplitude = 0.9f;
-        if (freq > 0) {
-            if (i < fade_len) amplitude *= (float)i / fade_len;
-            else if (i >= total_samples - fade_len) amplitude *= (float)(total_samples - 1 - i) / fade_len;
-        } else amplitude = 0.0f;
-
-        float sample_val = 0.0f;
-        if (freq > 0) sample_val = sinf(freq * 2.0f * PI * (float)i / sampleRate);
-        buffer[i] = (int16_t)(sample_val * amplitude * 32767.0f);
-    }
-    fwrite(buffer, sizeof(int16_t), total_samples, f);
-    free(buffer);
+    for (int start = 0; start < total_samples; start += TONE_CHUNK) {
+        int count = total_samples - start < TONE_CHUNK ? total_samples - start : TONE_CHUNK;
+        for (int j = 0; j < count; j++) {
+            int i = start + j;
+            float amplitude = 0.9f;
+            if (freq > 0) {
+                if (i < fade_len) amplitude *= (float)i / fade_len;
+                else if (i >= total_samples - fade_len) amplitude *= (float)(total_samples - 1 - i) / fade_len;
+            } else amplitude = 0.0f;
+
+            float sample_val = 0.0f;
+            if (freq > 0) sample_val = sinf(freq * 2.0f * PI * (float)i / sampleRate);
+            buffer[j] = (int16_t)(sample_val * amplitude * 32767.0f);
+        }
+        fwrite(buffer, sizeof(int16_t), count, f);
+    }
 }
 
 void print_progress(size_t current, size_t total, float total_time_s) {
@@ -118,41 +183,221 @@ void print_progress(size_t current, size_t total, float total_time_s) {
     fflush(stdout);
 }
 
-int main(void) {
-    EncoderConfig cfg = { .INPUT_FILE = "test.txt" }; // Default value
-    if (!load_config("encoder_config.ini", &cfg)) {
-        printf("Error: Could not load encoder_config.ini\n");
-        return 1;
-    }
+// Running state for the symbol stream: repeat detection and progress.
+typedef struct {
+    FILE *f;
+    const EncoderConfig *cfg;
+    int prev_byte;        // Last byte value sent, -1 after a marker
+    bool last_was_repeat;
+    size_t sent, total;   // Symbols written / planned, for the progress bar
+    float est_play_time;
+} TxState;
 
-    const char *out_filename = "transmit.wav";
+void tx_byte(TxState *tx, uint8_t byte) {
+    int val = byte;
+    if (val == tx->prev_byte && !tx->last_was_repeat) {
+        val = REPEAT_IDX; /* When multiple bytes with the same sound run in a row, the decoder can get confused
+          for when one byte ends and the next starts. By using a repeater value it splits up long chains of the same byte
+          and makes it easier for the decoder to stay in sync. 
+          The decoder treats this value as a signal to repeat the last valid byte. */
+        tx->last_was_repeat = true;
+    } else tx->last_was_repeat = false;
 
-    // 1. Read Payload using name from INI
-    FILE *fin = fopen(cfg.INPUT_FILE, "rb");
-    if (!fin) { printf("Error: %s not found\n", cfg.INPUT_FILE); return 1; }
+    write_tone(tx->f, tx->cfg->BASE_FREQ + (val * tx->cfg->BIN_SPACING), tx->cfg->DATA_DUR, tx->cfg->SAMPLE_RATE); //Calculating byte value with base frequency + spacing * byte value
+    write_tone(tx->f, 0, tx->cfg->BYTE_GAP, tx->cfg->SAMPLE_RATE); //Writing the byte gap of silence after each byte
+    tx->prev_byte = byte; // Store the actual byte value for repeat detection in the next iteration
+    if (tx->sent++ % 50 == 0 || tx->sent == tx->total) print_progress(tx->sent, tx->total, tx->est_play_time); // Update progress every 50 symbols or on the last one
+}
+
+void tx_bytes(TxState *tx, const void *data, size_t len) {
+    for (size_t i = 0; i < len; i++) tx_byte(tx, ((const uint8_t *)data)[i]);
+}
+
+// Block marker: a FREQ_HEADER tone the decoder can re-lock on. The next byte is never sent as a repeat,
+// since a receiver that just resynced has no previous byte to repeat.
+void tx_marker(TxState *tx) {
+    write_tone(tx->f, tx->cfg->FREQ_HEADER, tx->cfg->DATA_DUR, tx->cfg->SAMPLE_RATE);
+    write_tone(tx->f, 0, tx->cfg->BYTE_GAP, tx->cfg->SAMPLE_RATE);
+    tx->prev_byte = -1; tx->last_was_repeat = false;
+    tx->sent++;
+}
+
+void tx_carousel_packet(TxState *tx, const CarouselHeader *ch, const void *payload, size_t len) {
+    uint32_t packet_crc = crc32c_update(crc32c_update(0, ch, sizeof(CarouselHeader)), payload, len);
+    tx_marker(tx);
+    tx_bytes(tx, ch, sizeof(CarouselHeader));
+    tx_bytes(tx, payload, len);
+    tx_bytes(tx, &packet_crc, sizeof(packet_crc));
+}
+
+// In framed mode, whether block [start, end] should be sent given SendRanges.
+bool block_selected(const EncoderConfig *cfg, uint32_t start, uint32_t end) {
+    if (cfg->RANGE_COUNT == 0) return true;
+    for (int r = 0; r < cfg->RANGE_COUNT; r++)
+        if (start <= cfg->RANGES[r][1] && end >= cfg->RANGES[r][0]) return true;
+    return false;
+}
+
+// One file of the transmission. name is what the receiver saves it as: the base name, cut to 31 characters.
+typedef struct {
+    char path[256];
+    char name[32];
+    uint8_t *data;
+    uint32_t size;
+    uint32_t crc;
+} InputFile;
+
+static int cmp_input(const void *a, const void *b) { return strcmp(((const InputFile *)a)->path, ((const InputFile *)b)->path); }
+
+bool add_input(InputFile *files, int *count, const char *path) {
+    if (*count >= MAX_SESSION_FILES) { printf("Warning: a session holds at most %d files, skipping %s\n", MAX_SESSION_FILES, path); return false; }
+    InputFile *in = &files[(*count)++];
+    memset(in, 0, sizeof(*in));
+    strncpy(in->path, path, sizeof(in->path) - 1);
+    const char *base = path;
+    for (const char *c = path; *c; c++) if (*c == '/' || *c == '\\') base = c + 1;
+    strncpy(in->name, base, sizeof(in->name) - 1);
+    return true;
+}
+
+/* Expands one InputFile entry. A directory contributes its regular files (not recursively, sorted by name so the
+   order is the same on every run). Returns false if the path does not exist. */
+bool collect_input(InputFile *files, int *count, const char *path, bool *sawDir) {
+    struct stat st;
+    if (stat(path, &st) != 0) { printf("Error: %s not found\n", path); return false; }
+    if (!S_ISDIR(st.st_mode)) { add_input(files, count, path); return true; }
+
+    *sawDir = true;
+    DIR *dir = opendir(path);
+    if (!dir) { printf("Error: could not open directory %s\n", path); return false; }
+    int first = *count;
+    struct dirent *de;
+    char full[512];
+    while ((de = readdir(dir)) != NULL) {
+        if (de->d_name[0] == '.') continue;
+        snprintf(full, sizeof(full), "%s/%s", path, de->d_name);
+        if (stat(full, &st) == 0 && S_ISREG(st.st_mode) && !add_input(files, count, full)) break;
+    }
+    closedir(dir);
+    qsort(files + first, *count - first, sizeof(InputFile), cmp_input);
+    return true;
+}
+
+bool load_input(InputFile *in) {
+    FILE *fin = fopen(in->path, "rb");
+    if (!fin) { printf("Error: %s not found\n", in->path); return false; }
 
     fseek(fin, 0, SEEK_END);
     long fsize = ftell(fin);
     fseek(fin, 0, SEEK_SET);
 
-    uint8_t *file_data = malloc(fsize);
-    fread(file_data, 1, fsize, fin);
+    in->data = CountedMalloc(fsize ? fsize : 1);
+    in->size = (uint32_t)fsize;
+    in->crc = 0;
+    for (long got = 0; got < fsize; ) { // Checksum each chunk while it is still in cache instead of a second pass
+        size_t n = fread(in->data + got, 1, (fsize - got) < 65536 ? (size_t)(fsize - got) : 65536, fin);
+        if (n == 0) { printf("Error: could not read %s\n", in->path); fclose(fin); return false; }
+        in->crc = crc32c_update(in->crc, in->data + got, n);
+        got += (long)n;
+    }
     fclose(fin);
+    return true;
+}
+
+static size_t put_varint(uint8_t *out, uint32_t v) { // LEB128: 7 bits per byte, high bit set on all but the last
+    size_t n = 0;
+    do { out[n++] = (uint8_t)((v & 0x7F) | (v > 0x7F ? 0x80 : 0)); v >>= 7; } while (v);
+    return n;
+}
+
+/* Session manifest: [0xFB][varint fileCount] then per file [varint size][u8 nameLen][name], closed by a CRC-32C of
+   everything before it. Each file then follows as a record of its bytes plus their CRC-32C. */
+size_t build_manifest(const InputFile *files, int count, uint8_t *out) {
+    size_t n = 0;
+    out[n++] = SYNC_MARKER_SESSION;
+    n += put_varint(out + n, (uint32_t)count);
+    for (int i = 0; i < count; i++) {
+        size_t len = strlen(files[i].name);
+        n += put_varint(out + n, files[i].size);
+        out[n++] = (uint8_t)len;
+        memcpy(out + n, files[i].name, len);
+        n += len;
+    }
+    uint32_t crc = crc32c_update(0, out, n);
+    memcpy(out + n, &crc, sizeof(crc));
+    return n + sizeof(crc);
+}
+
+/* Encodes the files named in specs (InputFile= when there are none) into out_filename. A non-interactive run skips the
+   confirmation for long transmissions. Returns the process exit code. */
+int encode(EncoderConfig cfg, int spec_count, char **specs, const char *out_filename, bool interactive) {
+    // 1. Read Payload. Command line arguments replace InputFile=; either may list several files or directories.
+    static InputFile files[MAX_SESSION_FILES];
+    int file_count = 0;
+    bool saw_dir = false;
+    if (spec_count == 0) spec_count = 1;
+    for (int a = 0; a < spec_count; a++) {
+        char *spec = specs ? specs[a] : cfg.INPUT_FILE;
+        for (char *tok = strtok(spec, ","); tok; tok = strtok(NULL, ",")) {
+            while (*tok == ' ') tok++;
+            if (*tok && !collect_input(files, &file_count, tok, &saw_dir)) return 1;
+        }
+    }
+    if (file_count == 0) { printf("Error: no input files\n"); return 1; }
+    for (int i = 0; i < file_count; i++)
+        if (!load_input(&files[i])) { for (int j = 0; j <= i; j++) free(files[j].data); return 1; }
+
+    // A lone file keeps the single-file header; anything else shares one handshake through a session manifest.
+    bool session = file_count > 1 || saw_dir;
+    if (session && (cfg.CAROUSEL || cfg.FRAMED)) {
+        printf("Error: Carousel and Framed modes send a single file; %d inputs given.\n", file_count);
+        for (int i = 0; i < file_count; i++) free(files[i].data);
+        return 1;
+    }
+    uint8_t *manifest = NULL;
+    size_t manifest_len = 0;
+    if (session) {
+        manifest = CountedMalloc(1 + 5 + MAX_SESSION_FILES * (5 + 1 + 31) + sizeof(uint32_t));
+        manifest_len = build_manifest(files, file_count, manifest);
+    }
+    long fsize = files[0].size;
+    uint8_t *file_data = files[0].data;
+    uint32_t crc = files[0].crc;
 
     // 2. Build ChordCast Packet
-    ChordHeader header = { .syncMarker = 0xFE, .fileSize = (uint32_t)fsize };
-    uint32_t sum = 0;
-    for (long i = 0; i < fsize; i++) sum += file_data[i];
-    header.checksum = sum % 256;
-    strncpy(header.fileName, cfg.INPUT_FILE, 31);
-    
-    size_t total_len = sizeof(ChordHeader) + fsize;
-    uint8_t *all_data = malloc(total_len);
-    memcpy(all_data, &header, sizeof(ChordHeader));
-    memcpy(all_data + sizeof(ChordHeader), file_data, fsize);
+    ChordHeader header = { .syncMarker = SYNC_MARKER, .fileSize = (uint32_t)fsize, .crc32c = crc };
+    strncpy(header.fileName, files[0].name, 31);
+    uint32_t block_count = 0;
+    if (cfg.BLOCK_SIZE < 1 || cfg.BLOCK_SIZE > 255) cfg.BLOCK_SIZE = 64;
+    uint32_t carousel_k = 0, carousel_packets = 0;
+    if (cfg.CAROUSEL) {
+        carousel_k = fsize ? (uint32_t)((fsize + cfg.BLOCK_SIZE - 1) / cfg.BLOCK_SIZE) : 1;
+        if (carousel_k > CAROUSEL_MAX_BLOCKS) { printf("Error: file needs %u blocks, carousel mode allows %d. Raise BlockSize.\n", carousel_k, CAROUSEL_MAX_BLOCKS); free(file_data); return 1; }
+        carousel_packets = cfg.CAROUSEL_PACKETS > 0 ? (uint32_t)cfg.CAROUSEL_PACKETS : carousel_k * 2;
+    } else if (cfg.FRAMED) {
+        block_count = (uint32_t)((fsize + cfg.BLOCK_SIZE - 1) / cfg.BLOCK_SIZE);
+        if (block_count > 65536) { printf("Error: file needs %u blocks, framed mode allows 65536. Raise BlockSize.\n", block_count); free(file_data); return 1; }
+        header.flags |= HDR_FLAG_FRAMED;
+        header.blockSize = (uint8_t)cfg.BLOCK_SIZE;
+    }
+    if (cfg.HEADER_CRC) {
+        header.flags |= HDR_FLAG_HEADER_CRC;
+        header.headerCrc = crc32c_update(0, &header, offsetof(ChordHeader, headerCrc));
+    }
+
+    // Every marker and byte costs one DATA_DUR + BYTE_GAP slot
+    size_t total_len = cfg.CAROUSEL ? 0 : session ? manifest_len : sizeof(ChordHeader) + (cfg.FRAMED ? 0 : fsize);
+    for (int i = 0; session && i < file_count; i++) total_len += files[i].size + sizeof(uint32_t);
+    for (uint32_t n = 0; n < carousel_packets; n++)
+        total_len += 1 + sizeof(CarouselHeader) + cfg.BLOCK_SIZE + sizeof(uint32_t) +
+                     (n % CAROUSEL_NAME_EVERY == 0 ? 1 + sizeof(CarouselHeader) + sizeof(header.fileName) + sizeof(uint32_t) : 0);
+    for (uint32_t b = 0; b < block_count; b++) {
+        uint32_t start = b * cfg.BLOCK_SIZE, len = (uint32_t)(fsize - start) < (uint32_t)cfg.BLOCK_SIZE ? (uint32_t)(fsize - start) : (uint32_t)cfg.BLOCK_SIZE;
+        if (block_selected(&cfg, start, start + len - 1)) total_len += 1 + sizeof(BlockHeader) + len + sizeof(uint32_t);
+    }
 
     // 3. Estimates
-    float est_play_time = cfg.HELLO_DUR + cfg.HEADER_DUR + (cfg.BYTE_GAP * 4) + (total_len * (cfg.DATA_DUR + cfg.BYTE_GAP)) + 1.0f;
+    float est_play_time = (cfg.CAROUSEL ? 0.0f : cfg.HELLO_DUR + cfg.HEADER_DUR) + (cfg.BYTE_GAP * 4) + (total_len * (cfg.DATA_DUR + cfg.BYTE_GAP)) + 1.0f;
     double expected_wav_size = (double)cfg.SAMPLE_RATE * 2 * est_play_time;
 
     // --- SESSION REPORT (MATCHED TO DECODER STYLE) ---
@@ -168,8 +413,12 @@ int main(void) {
     printf("FreqHeader=%.3f\n", cfg.FREQ_HEADER);
     printf("FreqTerm=%.3f\n", cfg.FREQ_TERM);
     printf("\n[Payload]\n");
-    printf("InputFile=%s\n", cfg.INPUT_FILE);
+    if (session) printf("Files=%d (manifest %zu bytes)\n", file_count, manifest_len);
+    for (int i = 0; session && i < file_count; i++) printf("  %-31s %u bytes\n", files[i].name, files[i].size);
+    if (!session) printf("InputFile=%s\n", files[0].path);
     printf("TotalBytes=%zu\n", total_len);
+    if (cfg.FRAMED) printf("Framing=%u blocks of %d bytes%s\n", block_count, cfg.BLOCK_SIZE, cfg.RANGE_COUNT ? " (SendRanges only)" : "");
+    if (cfg.CAROUSEL) printf("Carousel=%u packets per loop for %u blocks of %d bytes (play on repeat)\n", carousel_packets, carousel_k, cfg.BLOCK_SIZE);
     printf("\n[Estimates]\n");
     printf("TransmissionTime=%.2f min\n", est_play_time / 60.0f);
     printf("WavFileSize=%.2f MB\n", (float)(expected_wav_size / (1024.0 * 1024.0)));
@@ -177,11 +426,12 @@ int main(void) {
     printf("ENCODER STATUS: Ready to generate %s\n", out_filename);
     printf("============================================\n\n");
 
-    if (est_play_time > 120.0f) {
+    if (interactive && est_play_time > 120.0f) {
         printf("WARNING: Transmission exceeds 2 minutes. Continue? (y/n): ");
         char confirm;
         if (scanf(" %c", &confirm) != 1 || (confirm != 'y' && confirm != 'Y')) {
-            free(file_data); free(all_data); return 0;
+            for (int i = 0; i < file_count; i++) free(files[i].data);
+            free(manifest); return 0;
         }
     }
 
@@ -195,36 +445,72 @@ int main(void) {
     };
     fwrite(&wav, sizeof(WavHeader), 1, fout);
 
-    //Start of protocol transmission
-    write_tone(fout, cfg.FREQ_HELLO, cfg.HELLO_DUR, cfg.SAMPLE_RATE); 
-    write_tone(fout, 0, cfg.BYTE_GAP, cfg.SAMPLE_RATE);
-    write_tone(fout, cfg.FREQ_HEADER, cfg.HEADER_DUR, cfg.SAMPLE_RATE);
-    write_tone(fout, 0, cfg.BYTE_GAP, cfg.SAMPLE_RATE);
-
-    int prev_byte = -1;
-    bool last_was_repeat = false;
-    for (size_t i = 0; i < total_len; i++) { //
-        int val = all_data[i];
-        if (val == prev_byte && !last_was_repeat) {
-            val = REPEAT_IDX; /* When multiple bytes with the same sound run in a row, the decoder can get confused
-              for when one byte ends and the next starts. By using a repeater value it splits up long chains of the same byte
-              and makes it easier for the decoder to stay in sync. 
-              The decoder treats this value as a signal to repeat the last valid byte. */
-            last_was_repeat = true;
-        } else last_was_repeat = false;
-
-        write_tone(fout, cfg.BASE_FREQ + (val * cfg.BIN_SPACING), cfg.DATA_DUR, cfg.SAMPLE_RATE); //Calculating byte value with base frequency + spacing * byte value
-        write_tone(fout, 0, cfg.BYTE_GAP, cfg.SAMPLE_RATE); //Writing the byte gap of silence after each byte
-        prev_byte = all_data[i]; // Store the actual byte value for repeat detection in the next iteration
-        if (i % 50 == 0 || i == total_len - 1) print_progress(i + 1, total_len, est_play_time); // Update progress every 50 bytes or on the last byte, showing percentage and estimated time remaining
-    }
-
-    write_tone(fout, 0, cfg.BYTE_GAP, cfg.SAMPLE_RATE); //Simple byte gap of silence before termination tones
-    for (int k = 0; k < 3; k++) { 
-        write_tone(fout, cfg.FREQ_TERM, 0.1f, cfg.SAMPLE_RATE); //We play the termination tone 3 times to ensure the decoder detects it, 
-        // especially in noisy environments. Each tone is short to save time.
-        write_tone(fout, 0, 0.02f, cfg.SAMPLE_RATE);
+    TxState tx = { .f = fout, .cfg = &cfg, .prev_byte = -1, .total = total_len, .est_play_time = est_play_time };
+    uint32_t *cdf = NULL, *nbrs = NULL;
+    if (cfg.CAROUSEL) {
+        cdf = CountedMalloc(carousel_k * sizeof(uint32_t)); nbrs = CountedMalloc(carousel_k * sizeof(uint32_t));
+        lt_dist_init(cdf, carousel_k);
+    }
+    long heap_before_tones = g_HeapCalls; // Everything the tones need is allocated by now
+    if (cfg.CAROUSEL) {
+        /* No HELLO/TERM: the file loops forever and listeners join whenever. Any ~k distinct packets rebuild the
+           file, wherever in the loop a receiver started. */
+        uint8_t symbol[255];
+        write_tone(fout, 0, cfg.BYTE_GAP, cfg.SAMPLE_RATE);
+        for (uint32_t n = 0; n < carousel_packets; n++) {
+            CarouselHeader ch = { .syncMarker = SYNC_MARKER_CAROUSEL, .fileId = crc, .fileSize = (uint32_t)fsize, .blockSize = (uint8_t)cfg.BLOCK_SIZE };
+            if (n % CAROUSEL_NAME_EVERY == 0) {
+                ch.esi = CAROUSEL_NAME_ESI;
+                tx_carousel_packet(&tx, &ch, header.fileName, sizeof(header.fileName));
+            }
+            ch.esi = n;
+            uint32_t degree = lt_neighbors(cdf, carousel_k, crc, n, nbrs);
+            memset(symbol, 0, cfg.BLOCK_SIZE);
+            for (uint32_t j = 0; j < degree; j++) { // The last block is zero padded to blockSize
+                uint32_t start = nbrs[j] * cfg.BLOCK_SIZE;
+                for (uint32_t i = 0; i < (uint32_t)cfg.BLOCK_SIZE && start + i < (uint32_t)fsize; i++) symbol[i] ^= file_data[start + i];
+            }
+            tx_carousel_packet(&tx, &ch, symbol, cfg.BLOCK_SIZE);
+        }
+    } else {
+        //Start of protocol transmission
+        write_tone(fout, cfg.FREQ_HELLO, cfg.HELLO_DUR, cfg.SAMPLE_RATE); 
+        write_tone(fout, 0, cfg.BYTE_GAP, cfg.SAMPLE_RATE);
+        write_tone(fout, cfg.FREQ_HEADER, cfg.HEADER_DUR, cfg.SAMPLE_RATE);
+        write_tone(fout, 0, cfg.BYTE_GAP, cfg.SAMPLE_RATE);
+
+        if (session) {
+            tx_bytes(&tx, manifest, manifest_len);
+            for (int i = 0; i < file_count; i++) { // Back to back: the manifest sizes say where each record ends
+                tx_bytes(&tx, files[i].data, files[i].size);
+                tx_bytes(&tx, &files[i].crc, sizeof(uint32_t));
+            }
+        } else {
+            tx_bytes(&tx, &header, sizeof(ChordHeader));
+            if (!cfg.FRAMED) tx_bytes(&tx, file_data, fsize);
+        }
+        for (uint32_t b = 0; b < block_count; b++) {
+            BlockHeader bh = { .seq = (uint16_t)b };
+            uint32_t start = b * cfg.BLOCK_SIZE;
+            bh.len = (uint8_t)((uint32_t)(fsize - start) < (uint32_t)cfg.BLOCK_SIZE ? (uint32_t)(fsize - start) : (uint32_t)cfg.BLOCK_SIZE);
+            if (!block_selected(&cfg, start, start + bh.len - 1)) continue;
+
+            uint32_t block_crc = crc32c_update(crc32c_update(0, &bh, sizeof(BlockHeader)), file_data + start, bh.len);
+            tx_marker(&tx);
+            tx_bytes(&tx, &bh, sizeof(BlockHeader));
+            tx_bytes(&tx, file_data + start, bh.len);
+            tx_bytes(&tx, &block_crc, sizeof(block_crc));
+        }
+
+        write_tone(fout, 0, cfg.BYTE_GAP, cfg.SAMPLE_RATE); //Simple byte gap of silence before termination tones
+        for (int k = 0; k < 3; k++) { 
+            write_tone(fout, cfg.FREQ_TERM, 0.1f, cfg.SAMPLE_RATE); //We play the termination tone 3 times to ensure the decoder detects it, 
+            // especially in noisy environments. Each tone is short to save time.
+            write_tone(fout, 0, 0.02f, cfg.SAMPLE_RATE);
+        }
     }
+    g_ToneLoopAllocs = g_HeapCalls - heap_before_tones;
+    free(cdf); free(nbrs);
 
     long f_len = ftell(fout);
     uint32_t r_len = (uint32_t)f_len - 8, d_len = (uint32_t)f_len - sizeof(WavHeader);
@@ -232,10 +518,45 @@ int main(void) {
     fseek(fout, 40, SEEK_SET); fwrite(&d_len, 4, 1, fout); //Write the data chunk size (total file size - header size).
 
     fclose(fout);
-    free(file_data); free(all_data);
+    for (int i = 0; i < file_count; i++) free(files[i].data);
+    free(manifest);
     printf("\n\nEncoding Complete: %s\n", out_filename);
-
-    printf("\nPress Enter to exit...");
-    getchar();
     return 0;
+}
+
+/* encoder.exe --alloc-check encodes InputFile as a framed and then as a carousel transmission into alloc_check.wav
+   and fails if writing the tones made any heap call. Setup may allocate (the payload, the carousel's degree table);
+   the per-symbol loop must not. */
+int RunAllocCheck(const EncoderConfig *base) {
+    static const char *modes[] = { "framed", "carousel" };
+    int failures = 0;
+    for (int m = 0; m < 2; m++) {
+        EncoderConfig cfg = *base;
+        cfg.FRAMED = m == 0; cfg.CAROUSEL = m == 1; cfg.RANGE_COUNT = 0;
+        long before = g_HeapCalls;
+        if (encode(cfg, 0, NULL, "alloc_check.wav", false) != 0) return 1;
+        printf("ALLOC CHECK: %s: %ld allocation(s) in setup, %ld while writing tones\n", modes[m],
+               g_HeapCalls - before - g_ToneLoopAllocs, g_ToneLoopAllocs);
+        if (g_ToneLoopAllocs) failures++;
+    }
+    remove("alloc_check.wav");
+    printf(failures ? "ALLOC CHECK: FAIL\n" : "ALLOC CHECK: PASS\n");
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    EncoderConfig cfg = { .INPUT_FILE = "test.txt", .HEADER_CRC = true, .BLOCK_SIZE = 64 }; // Default value
+    if (!load_config("encoder_config.ini", &cfg)) {
+        printf("Error: Could not load encoder_config.ini\n");
+        return 1;
+    }
+    crc32c_init();
+    if (argc > 1 && strcmp(argv[1], "--alloc-check") == 0) return RunAllocCheck(&cfg);
+
+    int exitCode = encode(cfg, argc - 1, argc > 1 ? argv + 1 : NULL, "transmit.wav", true);
+    if (exitCode == 0) {
+        printf("\nPress Enter to exit...");
+        getchar();
+    }
+    return exitCode;
 }
\ No newline at end of file